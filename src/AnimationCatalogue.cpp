@@ -0,0 +1,180 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      AnimationCatalogue.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AnimationCatalogue.hpp"
+
+#include <cstdio>
+#include <cerrno>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace LEDSpicerUI;
+
+string AnimationCatalogue::directory;
+std::map<string, AnimationCatalogue::Entry> AnimationCatalogue::entries;
+
+size_t AnimationCatalogue::open(const string& workingDirectory) {
+	close();
+	directory = workingDirectory + ANIMATIONS_DIRECTORY;
+	if (not Glib::file_test(directory, Glib::FileTest::FILE_TEST_IS_DIR))
+		return 0;
+
+	Glib::Dir dir(directory);
+	for (const string& file : dir) {
+		if (file.size() <= sizeof(ANIMATIONS_EXTENSION) - 1 or not Glib::str_has_suffix(file, ANIMATIONS_EXTENSION))
+			continue;
+		Entry entry;
+		if (not scan(directory + file, entry)) {
+			Diagnostics::setSource(directory + file);
+			Diagnostics::error("Unable to read the animation file");
+			continue;
+		}
+		entries.emplace(AnimationFile::extractName(file), std::move(entry));
+	}
+	return entries.size();
+}
+
+void AnimationCatalogue::close() {
+	entries.clear();
+	directory.clear();
+}
+
+const AnimationCatalogue::Entry* AnimationCatalogue::find(const string& name) {
+	auto entry(entries.find(name));
+	return entry == entries.end() ? nullptr : &entry->second;
+}
+
+vector<string> AnimationCatalogue::getNames() {
+	vector<string> names;
+	names.reserve(entries.size());
+	for (const auto& entry : entries)
+		names.push_back(entry.first);
+	return names;
+}
+
+vector<unordered_map<string, string>> AnimationCatalogue::load(const string& name) {
+	AnimationFile file(createFileName(name));
+	auto& actors(file.getData(COLLECTION_ANIMATIONS));
+	// Whatever is on disk now is what the index knows.
+	entries[name] = createEntry(actors);
+	return std::move(actors);
+}
+
+void AnimationCatalogue::save(const string& name, const vector<unordered_map<string, string>>& actors, const string& xmlData) {
+	XMLHelper::write(createFileName(name), xmlData);
+	entries[name] = createEntry(actors);
+}
+
+void AnimationCatalogue::remove(const string& name) {
+	if (std::remove(createFileName(name).c_str()) and errno != ENOENT)
+		throw Message("Unable to delete the animation " + name);
+	entries.erase(name);
+}
+
+AnimationCatalogue::Entry AnimationCatalogue::createEntry(const vector<unordered_map<string, string>>& actors) {
+	Entry entry;
+	for (const auto& actor : actors) {
+		entry.types.push_back(XMLHelper::valueOf(actor, TYPE));
+		addTarget(entry, XMLHelper::valueOf(actor, ACTOR_TARGET));
+	}
+	return entry;
+}
+
+bool AnimationCatalogue::scan(const string& fileName, Entry& entry) {
+	// Mapped, the file is read once and never copied.
+	int fd = ::open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return false;
+	struct stat st;
+	if (fstat(fd, &st)) {
+		::close(fd);
+		return false;
+	}
+	if (not st.st_size) {
+		::close(fd);
+		return true;
+	}
+	void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (map == MAP_FAILED)
+		return false;
+	madvise(map, st.st_size, MADV_SEQUENTIAL);
+	const string_view data(static_cast<const char*>(map), st.st_size);
+
+	// Only the actor tags are looked at, the file is checked when loaded.
+	const string_view actorTag("<" ACTOR);
+	size_t pos = 0;
+	while ((pos = data.find(actorTag, pos)) != string_view::npos) {
+		pos += actorTag.size();
+		if (pos >= data.size() or not std::isspace(static_cast<unsigned char>(data[pos])))
+			continue;
+		size_t end = data.find('>', pos);
+		if (end == string_view::npos)
+			break;
+		string_view tag(data.substr(pos, end - pos));
+		entry.types.emplace_back(attribute(tag, TYPE));
+		addTarget(entry, attribute(tag, ACTOR_TARGET));
+		pos = end;
+	}
+	munmap(map, st.st_size);
+	return true;
+}
+
+string_view AnimationCatalogue::attribute(string_view tag, string_view name) {
+	size_t pos = 0;
+	while ((pos = tag.find(name, pos)) != string_view::npos) {
+		size_t value = pos + name.size();
+		// Needs to be a whole attribute name, files written here have one attribute per line.
+		// Other tools may quote with ' or add spaces around the =.
+		if (pos and std::isspace(static_cast<unsigned char>(tag[pos - 1]))) {
+			while (value < tag.size() and std::isspace(static_cast<unsigned char>(tag[value])))
+				++value;
+			if (value < tag.size() and tag[value] == '=') {
+				++value;
+				while (value < tag.size() and std::isspace(static_cast<unsigned char>(tag[value])))
+					++value;
+				if (value < tag.size() and (tag[value] == '"' or tag[value] == '\'')) {
+					const char quote(tag[value++]);
+					size_t end = tag.find(quote, value);
+					return end == string_view::npos ? string_view() : tag.substr(value, end - value);
+				}
+			}
+		}
+		pos = value;
+	}
+	return {};
+}
+
+void AnimationCatalogue::addTarget(Entry& entry, string_view target) {
+	if (target.empty())
+		return;
+	for (const string& t : entry.targets)
+		if (t == target)
+			return;
+	entry.targets.emplace_back(target);
+}
+
+string AnimationCatalogue::createFileName(const string& name) {
+	return directory + name + ANIMATIONS_EXTENSION;
+}
@@ -0,0 +1,155 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      AnimationCatalogue.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AnimationFile.hpp"
+
+#include <map>
+#include <string_view>
+
+#ifndef ANIMATIONCATALOGUE_HPP_
+#define ANIMATIONCATALOGUE_HPP_ 1
+
+#define ANIMATIONS_DIRECTORY "/animations/"
+#define ANIMATIONS_EXTENSION ".xml"
+
+namespace LEDSpicerUI {
+
+using std::string_view;
+
+/**
+ * LEDSpicerUI::AnimationCatalogue
+ * Index of the animations in the project animations directory.
+ * Opening only scans the actors tags for the type and target, files are parsed when one is loaded.
+ */
+class AnimationCatalogue {
+
+public:
+
+	/**
+	 * What is known about an animation without parsing it.
+	 */
+	struct Entry {
+		/// Actor types, in file order.
+		vector<string> types;
+		/// Groups used by the actors, no duplicates.
+		vector<string> targets;
+	};
+
+	AnimationCatalogue() = delete;
+
+	virtual ~AnimationCatalogue() = default;
+
+	/**
+	 * Indexes the animations directory, any previous index is dropped.
+	 * A missing directory is an empty catalogue.
+	 * @param workingDirectory the project directory, without / at the end.
+	 * @return the number of animations found.
+	 */
+	static size_t open(const string& workingDirectory);
+
+	/**
+	 * Drops the index.
+	 */
+	static void close();
+
+	/**
+	 * @param name
+	 * @return the entry or nullptr if the animation is not on disk.
+	 */
+	static const Entry* find(const string& name);
+
+	/**
+	 * @return the names of every animation on disk, sorted.
+	 */
+	static vector<string> getNames();
+
+	/**
+	 * Parses an animation file.
+	 * @param name
+	 * @return the actors.
+	 * @throws Message if the file cannot be read.
+	 */
+	static vector<unordered_map<string, string>> load(const string& name);
+
+	/**
+	 * Writes an animation file and updates its entry.
+	 * @param name
+	 * @param actors
+	 * @param xmlData the file contents.
+	 * @throws Message
+	 */
+	static void save(const string& name, const vector<unordered_map<string, string>>& actors, const string& xmlData);
+
+	/**
+	 * Deletes an animation file and its entry.
+	 * @param name
+	 * @throws Message
+	 */
+	static void remove(const string& name);
+
+	/**
+	 * @param actors
+	 * @return the entry for those actors.
+	 */
+	static Entry createEntry(const vector<unordered_map<string, string>>& actors);
+
+protected:
+
+	/// The animations directory, with / at the end.
+	static string directory;
+
+	/// Animation name to entry.
+	static std::map<string, Entry> entries;
+
+	/**
+	 * Scans the actor tags in a file.
+	 * @param fileName
+	 * @param entry where the types and targets are stored.
+	 * @return false if the file cannot be read.
+	 */
+	static bool scan(const string& fileName, Entry& entry);
+
+	/**
+	 * @param tag a xml tag.
+	 * @param name
+	 * @return the value of the attribute, empty if not found.
+	 */
+	static string_view attribute(string_view tag, string_view name);
+
+	/**
+	 * Adds a target if not already there.
+	 * @param entry
+	 * @param target
+	 */
+	static void addTarget(Entry& entry, string_view target);
+
+	/**
+	 * @param name
+	 * @return the full path of an animation.
+	 */
+	static string createFileName(const string& name);
+
+};
+
+} /* namespace LEDSpicerUI */
+
+#endif /* ANIMATIONCATALOGUE_HPP_ */
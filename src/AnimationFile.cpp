@@ -0,0 +1,50 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      AnimationFile.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AnimationFile.hpp"
+
+using namespace LEDSpicerUI;
+
+AnimationFile::AnimationFile(const string& animationFile) : XMLHelper(animationFile, "Animation") {
+	Diagnostics::setSource(animationFile);
+	const string name(extractName(animationFile));
+	vector<unordered_map<string, string>> actors;
+	for (tinyxml2::XMLElement* actorNode = root->FirstChildElement(ACTOR); actorNode; actorNode = actorNode->NextSiblingElement(ACTOR)) {
+		unordered_map<string, string> actor(processNode(actorNode));
+		string error(checkAttributes({TYPE, ACTOR_TARGET}, actor, "actor"));
+		if (not error.empty()) {
+			Diagnostics::error(error, name, actorNode->GetLineNum());
+			continue;
+		}
+		actors.push_back(std::move(actor));
+	}
+	if (actors.empty())
+		Diagnostics::warning("Animation without actors", name);
+	extractedData.emplace(COLLECTION_ANIMATIONS, std::move(actors));
+}
+
+string AnimationFile::extractName(const string& fileName) {
+	auto file(Defaults::explode(Glib::path_get_basename(fileName), '.'));
+	if (file.size() > 1)
+		file.pop_back();
+	return Defaults::implode(file, '.');
+}
@@ -0,0 +1,54 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      AnimationFile.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "XMLHelper.hpp"
+
+#ifndef ANIMATIONFILE_HPP_
+#define ANIMATIONFILE_HPP_ 1
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::AnimationFile
+ * Reads an animation file, the actors are stored into the animations collection.
+ */
+class AnimationFile: public XMLHelper {
+
+public:
+
+	AnimationFile() = delete;
+
+	AnimationFile(const string& animationFile);
+
+	virtual ~AnimationFile() = default;
+
+	/**
+	 * @param fileName
+	 * @return the file name without directory and extension.
+	 */
+	static string extractName(const string& fileName);
+
+};
+
+} /* namespace LEDSpicerUI */
+
+#endif /* ANIMATIONFILE_HPP_ */
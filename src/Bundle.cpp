@@ -0,0 +1,336 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Bundle.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Bundle.hpp"
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include <memory>
+#include <cstdio>
+
+using namespace LEDSpicerUI;
+
+Bundle::Bundle(const string& fileName) :
+	fileName(fileName),
+	file(fileName, std::ios::binary)
+{
+	if (not file)
+		throw Message("Unable to open " + fileName);
+	file.seekg(0, std::ios::end);
+	const uint64_t size = file.tellg();
+	if (size < sizeof(MAGIC) + FOOTER_SIZE)
+		throw Message(fileName + " is not a project bundle");
+
+	string footer(FOOTER_SIZE, '\0');
+	file.seekg(size - FOOTER_SIZE);
+	file.read(&footer[0], FOOTER_SIZE);
+	if (not file or footer.compare(8, sizeof(MAGIC), MAGIC, sizeof(MAGIC)))
+		throw Message(fileName + " is not a project bundle");
+	size_t position = 0;
+	const uint64_t indexOffset = get(footer, position, 8);
+	if (indexOffset < sizeof(MAGIC) or indexOffset > size - FOOTER_SIZE)
+		throw Message(fileName + " is damaged");
+
+	string index(size - FOOTER_SIZE - indexOffset, '\0');
+	file.seekg(indexOffset);
+	file.read(&index[0], index.size());
+	if (not file)
+		throw Message(fileName + " is damaged");
+
+	position = 0;
+	const uint32_t count = get(index, position, 4);
+	for (uint32_t c = 0; c < count; ++c) {
+		Entry entry;
+		const size_t length = get(index, position, 2);
+		if (position + length > index.size())
+			throw Message(fileName + " is damaged");
+		entry.path    = index.substr(position, length);
+		position     += length;
+		entry.method  = static_cast<Methods>(get(index, position, 1));
+		entry.offset  = get(index, position, 8);
+		entry.size    = get(index, position, 8);
+		entry.length  = get(index, position, 8);
+		entry.hash    = get(index, position, 8);
+		if (
+			entry.method > Methods::ZSTD or
+			entry.offset < sizeof(MAGIC) or entry.offset > indexOffset or entry.size > indexOffset - entry.offset or
+			(entry.method == Methods::STORED and entry.length != entry.size)
+		)
+			throw Message(fileName + " is damaged");
+		entries.push_back(std::move(entry));
+	}
+}
+
+const vector<Bundle::Entry>& Bundle::getEntries() const {
+	return entries;
+}
+
+const Bundle::Entry* Bundle::find(const string& path) const {
+	for (const auto& entry : entries)
+		if (entry.path == path)
+			return &entry;
+	return nullptr;
+}
+
+string Bundle::read(const Entry& entry) const {
+	string data(decompress(readStored(entry), entry));
+	if (data.size() != entry.length or hash(data.data(), data.size()) != entry.hash)
+		throw Message(entry.path + " is damaged inside " + fileName);
+	return data;
+}
+
+Bundle::Result Bundle::extract(const string& directory, const string& path) const {
+	Result result;
+	if (not path.empty() and not find(path))
+		throw Message(path + " is not in " + fileName);
+	for (const auto& entry : entries) {
+		if (not path.empty() and entry.path != path)
+			continue;
+		// Never write outside the directory.
+		if (entry.path.empty() or entry.path[0] == '/' or entry.path.find("..") != string::npos)
+			throw Message(fileName + " has an invalid path " + entry.path);
+		const string target(directory + "/" + entry.path);
+		try {
+			const string current(Glib::file_get_contents(target));
+			if (current.size() == entry.length and hash(current.data(), current.size()) == entry.hash) {
+				++result.skipped;
+				continue;
+			}
+		}
+		catch (const Glib::FileError& e) {}
+
+		const string data(read(entry));
+		if (g_mkdir_with_parents(Glib::path_get_dirname(target).c_str(), 0755))
+			throw Message("Unable to create the directory for " + target);
+		try {
+			Glib::file_set_contents(target, data);
+		}
+		catch (const Glib::FileError& e) {
+			throw Message("Failed to write " + target + " " + string(e.what()));
+		}
+		++result.written;
+	}
+	return result;
+}
+
+Bundle::Result Bundle::create(const string& fileName, const string& projectDirectory) {
+	Result result;
+	const vector<string> paths(listProject(projectDirectory));
+
+	// The previous export gives the already compressed data of the files that did not change.
+	std::unique_ptr<Bundle> previous;
+	if (Glib::file_test(fileName, Glib::FileTest::FILE_TEST_EXISTS)) {
+		try {
+			previous.reset(new Bundle(fileName));
+		}
+		catch (Message& e) {}
+	}
+
+	// Writes aside and renames.
+	const string temporal(fileName + ".tmp");
+	std::ofstream out(temporal, std::ios::binary | std::ios::trunc);
+	if (not out)
+		throw Message("Unable to write " + temporal);
+	out.write(MAGIC, sizeof(MAGIC));
+	uint64_t offset = sizeof(MAGIC);
+
+	vector<Entry> entries;
+	for (const string& path : paths) {
+		string content;
+		try {
+			content = Glib::file_get_contents(projectDirectory + "/" + path);
+		}
+		catch (const Glib::FileError& e) {
+			out.close();
+			std::remove(temporal.c_str());
+			throw Message("Unable to read " + path + " " + string(e.what()));
+		}
+		Entry entry;
+		entry.path   = path;
+		entry.length = content.size();
+		entry.hash   = hash(content.data(), content.size());
+		string data;
+		auto old(previous ? previous->find(path) : nullptr);
+		if (old and old->hash == entry.hash and old->length == entry.length) {
+			entry.method = old->method;
+			data = previous->readStored(*old);
+			++result.skipped;
+		}
+		else {
+			data = compress(content, entry.method);
+			++result.written;
+		}
+		entry.offset = offset;
+		entry.size   = data.size();
+		out.write(data.data(), data.size());
+		offset += data.size();
+		entries.push_back(std::move(entry));
+	}
+
+	string index;
+	put(index, entries.size(), 4);
+	for (const auto& entry : entries) {
+		put(index, entry.path.size(), 2);
+		index += entry.path;
+		put(index, static_cast<uint8_t>(entry.method), 1);
+		put(index, entry.offset, 8);
+		put(index, entry.size,   8);
+		put(index, entry.length, 8);
+		put(index, entry.hash,   8);
+	}
+	put(index, offset, 8);
+	index.append(MAGIC, sizeof(MAGIC));
+	out.write(index.data(), index.size());
+	out.close();
+	previous.reset();
+	if (not out or std::rename(temporal.c_str(), fileName.c_str())) {
+		std::remove(temporal.c_str());
+		throw Message("Unable to write " + fileName);
+	}
+	return result;
+}
+
+vector<string> Bundle::listProject(const string& projectDirectory) {
+	const string config(string(CONFIG_FILE).substr(1));
+	if (not Glib::file_test(projectDirectory + CONFIG_FILE, Glib::FileTest::FILE_TEST_IS_REGULAR))
+		throw Message("No project found in " + projectDirectory);
+
+	vector<string> paths{config};
+	for (const string directory : {"", "inputs/", "profiles/", "animations/"}) {
+		vector<string> files;
+		try {
+			for (const string& name : Glib::Dir(projectDirectory + "/" + directory)) {
+				const string path(directory + name);
+				// The root only has the config and loose input files.
+				if (directory.empty() and (name.size() < 5 or name.compare(name.size() - 4, 4, ".xml")))
+					continue;
+				if (Glib::file_test(projectDirectory + "/" + path, Glib::FileTest::FILE_TEST_IS_REGULAR))
+					files.push_back(path);
+			}
+		}
+		catch (const Glib::FileError& e) {}
+		std::sort(files.begin(), files.end());
+		paths.insert(paths.end(), files.begin(), files.end());
+	}
+	return paths;
+}
+
+uint64_t Bundle::hash(const char* data, size_t size) {
+	uint64_t h = 0xcbf29ce484222325ULL;
+	for (size_t c = 0; c < size; ++c) {
+		h ^= static_cast<uint8_t>(data[c]);
+		h *= 0x100000001b3ULL;
+	}
+	return h;
+}
+
+string Bundle::readStored(const Entry& entry) const {
+	string data(entry.size, '\0');
+	file.clear();
+	file.seekg(entry.offset);
+	file.read(&data[0], entry.size);
+	if (not file)
+		throw Message(entry.path + " is damaged inside " + fileName);
+	return data;
+}
+
+string Bundle::compress(const string& data, Methods& method) {
+	method = Methods::STORED;
+	string r;
+#if defined(HAVE_ZSTD)
+	r.resize(ZSTD_compressBound(data.size()));
+	const size_t size = ZSTD_compress(&r[0], r.size(), data.data(), data.size(), 9);
+	if (ZSTD_isError(size))
+		return data;
+	r.resize(size);
+	method = Methods::ZSTD;
+#elif defined(HAVE_ZLIB)
+	uLongf size = compressBound(data.size());
+	r.resize(size);
+	if (compress2(reinterpret_cast<Bytef*>(&r[0]), &size, reinterpret_cast<const Bytef*>(data.data()), data.size(), Z_BEST_COMPRESSION) != Z_OK)
+		return data;
+	r.resize(size);
+	method = Methods::DEFLATE;
+#endif
+	if (r.empty() or r.size() >= data.size()) {
+		method = Methods::STORED;
+		return data;
+	}
+	return r;
+}
+
+string Bundle::decompress(const string& data, const Entry& entry) const {
+	string r;
+	switch (entry.method) {
+	case Methods::STORED:
+		return data;
+	case Methods::DEFLATE: {
+#ifdef HAVE_ZLIB
+		// A length over the inflate limits is a damaged index.
+		if (entry.length > data.size() * MAX_DEFLATE_RATIO or entry.length > MAX_INFLATED_SIZE)
+			throw Message(entry.path + " is damaged inside " + fileName);
+		uLongf size = entry.length;
+		r.resize(size);
+		if (uncompress(reinterpret_cast<Bytef*>(&r[0]), &size, reinterpret_cast<const Bytef*>(data.data()), data.size()) != Z_OK or size != entry.length)
+			throw Message(entry.path + " is damaged inside " + fileName);
+		return r;
+#else
+		throw Message(entry.path + " is compressed with deflate, and gzip support was not built");
+#endif
+	}
+	case Methods::ZSTD: {
+#ifdef HAVE_ZSTD
+		// The frame knows its size, the index length is not trusted before allocating.
+		if (entry.length > MAX_INFLATED_SIZE or ZSTD_getFrameContentSize(data.data(), data.size()) != entry.length)
+			throw Message(entry.path + " is damaged inside " + fileName);
+		r.resize(entry.length);
+		const size_t size = ZSTD_decompress(&r[0], r.size(), data.data(), data.size());
+		if (ZSTD_isError(size) or size != entry.length)
+			throw Message(entry.path + " is damaged inside " + fileName);
+		return r;
+#else
+		throw Message(entry.path + " is compressed with zstd, and zstd support was not built");
+#endif
+	}
+	}
+	throw Message(entry.path + " is damaged inside " + fileName);
+}
+
+void Bundle::put(string& out, uint64_t value, uint8_t bytes) {
+	for (uint8_t c = 0; c < bytes; ++c)
+		out += static_cast<char>((value >> (8 * c)) & 0xff);
+}
+
+uint64_t Bundle::get(const string& in, size_t& position, uint8_t bytes) {
+	if (position + bytes > in.size())
+		throw Message("Bundle index is damaged");
+	uint64_t value = 0;
+	for (uint8_t c = 0; c < bytes; ++c)
+		value |= static_cast<uint64_t>(static_cast<uint8_t>(in[position + c])) << (8 * c);
+	position += bytes;
+	return value;
+}
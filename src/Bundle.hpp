@@ -0,0 +1,194 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Bundle.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Message.hpp"
+
+#include <fstream>
+
+#ifndef BUNDLE_HPP_
+#define BUNDLE_HPP_ 1
+
+#define BUNDLE_EXTENSION ".lsbundle"
+
+namespace LEDSpicerUI {
+
+using Ui::Message;
+
+/**
+ * LEDSpicerUI::Bundle
+ * A whole project in a single file, to copy it into cabinets in one go.
+ * Every file is compressed on its own and written as soon as it is read, an index at the end points to each one,
+ * so one file can be read without touching the others.
+ * Files with the same hash are not compressed again when exporting, nor written again when importing.
+ *
+ * Layout: magic, the files data, the index and a footer with the index position and the magic again.
+ * Numbers are stored little endian.
+ */
+class Bundle {
+
+public:
+
+	/// How a file is stored.
+	enum class Methods : uint8_t {STORED, DEFLATE, ZSTD};
+
+	/**
+	 * A file inside the bundle.
+	 */
+	struct Entry {
+		/// Relative to the project directory, like inputs/mame.xml.
+		string   path;
+		Methods  method = Methods::STORED;
+		/// Position of the data inside the bundle.
+		uint64_t offset = 0;
+		/// Stored size.
+		uint64_t size   = 0;
+		/// Original size.
+		uint64_t length = 0;
+		/// Hash of the original content.
+		uint64_t hash   = 0;
+	};
+
+	/**
+	 * What an export or an import did.
+	 */
+	struct Result {
+		size_t
+			written = 0,
+			skipped = 0;
+	};
+
+	/**
+	 * Opens a bundle and reads its index.
+	 * @param fileName
+	 * @throws Message if the file is not a bundle or is damaged.
+	 */
+	Bundle(const string& fileName);
+
+	virtual ~Bundle() = default;
+
+	/**
+	 * @return the files, in the order they were written.
+	 */
+	const vector<Entry>& getEntries() const;
+
+	/**
+	 * @param path
+	 * @return the entry or nullptr.
+	 */
+	const Entry* find(const string& path) const;
+
+	/**
+	 * Reads one file.
+	 * @param entry
+	 * @return the original content.
+	 * @throws Message
+	 */
+	string read(const Entry& entry) const;
+
+	/**
+	 * Writes the files into a directory, files with the same content are left untouched.
+	 * @param directory
+	 * @param path only this file if not empty.
+	 * @return
+	 * @throws Message
+	 */
+	Result extract(const string& directory, const string& path = "") const;
+
+	/**
+	 * Writes a bundle with the project files, if the bundle exists its unchanged files are copied without compressing them again.
+	 * @param fileName
+	 * @param projectDirectory
+	 * @return
+	 * @throws Message
+	 */
+	static Result create(const string& fileName, const string& projectDirectory);
+
+	/**
+	 * @param projectDirectory
+	 * @return the project files, relative to the directory.
+	 */
+	static vector<string> listProject(const string& projectDirectory);
+
+	/**
+	 * 64 bits FNV-1a.
+	 * @param data
+	 * @param size
+	 * @return
+	 */
+	static uint64_t hash(const char* data, size_t size);
+
+protected:
+
+	static constexpr char MAGIC[8] = {'L', 'S', 'U', 'I', 'B', 'N', 'D', '1'};
+
+	/// Index position and magic.
+	static constexpr size_t FOOTER_SIZE = 16;
+
+	string fileName;
+
+	/// The bundle, kept open to read the files.
+	mutable std::ifstream file;
+
+	vector<Entry> entries;
+
+	/**
+	 * @param entry
+	 * @return the data as stored.
+	 * @throws Message
+	 */
+	string readStored(const Entry& entry) const;
+
+	/**
+	 * @param data
+	 * @param method the best method available.
+	 * @return the compressed data, or the same data if compression does not help.
+	 */
+	static string compress(const string& data, Methods& method);
+
+	/**
+	 * @param data
+	 * @param entry
+	 * @return
+	 * @throws Message
+	 */
+	string decompress(const string& data, const Entry& entry) const;
+
+	/**
+	 * @param out
+	 * @param value
+	 * @param bytes
+	 */
+	static void put(string& out, uint64_t value, uint8_t bytes);
+
+	/**
+	 * @param in
+	 * @param position moves after the value.
+	 * @param bytes
+	 * @return
+	 * @throws Message if there is no data.
+	 */
+	static uint64_t get(const string& in, size_t& position, uint8_t bytes);
+};
+
+} /* namespace */
+
+#endif /* BUNDLE_HPP_ */
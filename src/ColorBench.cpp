@@ -0,0 +1,135 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ColorBench.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * Microbenchmark for the color kernels, build it with "make colorbench".
+ * Runs every kernel on every path the CPU supports, checks they all give the same result than the scalar one
+ * and prints the time per call.
+ * Usage: colorbench [colors] [rounds]
+ */
+
+#include "ColorKernels.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+
+using namespace LEDSpicerUI;
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @param rounds
+ * @param kernel
+ * @return nanoseconds per call.
+ */
+static double measure(size_t rounds, const std::function<void()>& kernel) {
+	kernel();
+	auto start = Clock::now();
+	for (size_t c = 0; c < rounds; ++c)
+		kernel();
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / rounds;
+}
+
+/**
+ * @param rounds
+ * @param from
+ * @param to
+ * @param palette
+ * @return all the kernel outputs one after the other, to compare paths.
+ */
+static vector<uint8_t> run(size_t rounds, const ColorKernels::Buffer& from, const ColorKernels::Buffer& to, const ColorKernels::Buffer& palette) {
+	ColorKernels::Buffer out(from.size()), work(from);
+	vector<uint8_t> luma, indexes, result;
+	uint8_t amount = 0;
+
+	// Scale works in place, its time includes restoring the buffer.
+	double
+		lerp = measure(rounds, [&]() { ColorKernels::lerp(from, to, amount++, out); }),
+		scale = measure(rounds, [&]() { work = from; ColorKernels::scale(work, 200); }),
+		luminance = measure(rounds, [&]() { ColorKernels::luminance(from, luma); }),
+		nearest = measure(rounds / 16 + 1, [&]() { ColorKernels::nearest(from, palette, indexes); });
+
+	std::printf(
+		"%-7s lerp %9.0f ns  scale %9.0f ns  luminance %9.0f ns  nearest(%zu) %11.0f ns\n",
+		ColorKernels::toString(ColorKernels::getPath()).c_str(),
+		lerp, scale, luminance, palette.size(), nearest
+	);
+
+	// Results for a fixed set of parameters.
+	for (uint16_t a : {0, 1, 127, 128, 254, 255}) {
+		ColorKernels::lerp(from, to, a, out);
+		for (auto plane : {&out.r, &out.g, &out.b})
+			result.insert(result.end(), plane->begin(), plane->end());
+	}
+	work = from;
+	ColorKernels::scale(work, 200);
+	ColorKernels::gamma(work);
+	for (auto plane : {&work.r, &work.g, &work.b})
+		result.insert(result.end(), plane->begin(), plane->end());
+	result.insert(result.end(), luma.begin(), luma.end());
+	result.insert(result.end(), indexes.begin(), indexes.end());
+	return result;
+}
+
+int main(int argc, char** argv) {
+
+	// Odd default so the scalar tails run too.
+	size_t
+		colors = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 7621,
+		rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+
+	ColorKernels::Buffer from(colors), to(colors), palette(64);
+	std::srand(1);
+	for (size_t c = 0; c < colors; ++c) {
+		from.set(c, std::rand(), std::rand(), std::rand());
+		to.set(c, std::rand(), std::rand(), std::rand());
+	}
+	for (size_t c = 0; c < palette.size(); ++c)
+		palette.set(c, std::rand(), std::rand(), std::rand());
+	// Repeated colors, ties must resolve the same way.
+	palette.set(palette.size() - 1, palette.r[0], palette.g[0], palette.b[0]);
+
+	std::printf("%zu colors, %zu rounds\n", colors, rounds);
+
+	// Gamma is the same table lookup on every path, timed once.
+	ColorKernels::Buffer work(from);
+	std::printf("gamma   %9.0f ns, restoring the buffer included\n", measure(rounds, [&]() { work = from; ColorKernels::gamma(work); }));
+
+	vector<uint8_t> reference;
+	int errors = 0;
+	for (auto path : {ColorKernels::Paths::SCALAR, ColorKernels::Paths::SSE2, ColorKernels::Paths::AVX2, ColorKernels::Paths::NEON}) {
+		if (not ColorKernels::isSupported(path))
+			continue;
+		ColorKernels::setPath(path);
+		auto result = run(rounds, from, to, palette);
+		if (reference.empty())
+			reference = std::move(result);
+		else if (result != reference) {
+			std::printf("%s results differ from scalar\n", ColorKernels::toString(path).c_str());
+			++errors;
+		}
+	}
+	return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
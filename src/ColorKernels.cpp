@@ -0,0 +1,583 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ColorKernels.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ColorKernels.hpp"
+
+#include <climits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_X86 1
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+using namespace LEDSpicerUI;
+
+ColorKernels::Paths ColorKernels::path = ColorKernels::detect();
+
+ColorKernels::Buffer::Buffer(size_t size) {
+	resize(size);
+}
+
+void ColorKernels::Buffer::resize(size_t size) {
+	r.resize(size);
+	g.resize(size);
+	b.resize(size);
+}
+
+size_t ColorKernels::Buffer::size() const {
+	return r.size();
+}
+
+void ColorKernels::Buffer::set(size_t index, uint8_t red, uint8_t green, uint8_t blue) {
+	r[index] = red;
+	g[index] = green;
+	b[index] = blue;
+}
+
+bool ColorKernels::Buffer::set(size_t index, const string& hex) {
+	uint32_t value = 0;
+	if (hex.size() != 6) {
+		set(index, 0, 0, 0);
+		return false;
+	}
+	for (char c : hex) {
+		value <<= 4;
+		if (c >= '0' and c <= '9')
+			value |= c - '0';
+		else if (c >= 'a' and c <= 'f')
+			value |= c - 'a' + 10;
+		else if (c >= 'A' and c <= 'F')
+			value |= c - 'A' + 10;
+		else {
+			set(index, 0, 0, 0);
+			return false;
+		}
+	}
+	set(index, value >> 16, (value >> 8) & 0xFF, value & 0xFF);
+	return true;
+}
+
+ColorKernels::Paths ColorKernels::getPath() {
+	return path;
+}
+
+ColorKernels::Paths ColorKernels::setPath(Paths path) {
+	ColorKernels::path = isSupported(path) ? path : detect();
+	return ColorKernels::path;
+}
+
+bool ColorKernels::isSupported(Paths path) {
+	switch (path) {
+	case Paths::SCALAR:
+		return true;
+#ifdef SIMD_X86
+	case Paths::SSE2:
+		return __builtin_cpu_supports("sse2");
+	case Paths::AVX2:
+		return __builtin_cpu_supports("avx2");
+#endif
+#if defined(__ARM_NEON)
+	case Paths::NEON:
+		return true;
+#endif
+	default:
+		return false;
+	}
+}
+
+string ColorKernels::toString(Paths path) {
+	switch (path) {
+	case Paths::SSE2:
+		return "SSE2";
+	case Paths::AVX2:
+		return "AVX2";
+	case Paths::NEON:
+		return "NEON";
+	default:
+		return "Scalar";
+	}
+}
+
+void ColorKernels::lerp(const Buffer& from, const Buffer& to, uint8_t amount, Buffer& out) {
+	uint16_t weight = toWeight(amount);
+	size_t size = from.size();
+	const uint8_t* f[] = {from.r.data(), from.g.data(), from.b.data()};
+	const uint8_t* t[] = {to.r.data(), to.g.data(), to.b.data()};
+	uint8_t* o[] = {out.r.data(), out.g.data(), out.b.data()};
+	for (uint8_t c = 0; c < 3; ++c) {
+		switch (path) {
+#ifdef SIMD_X86
+		case Paths::AVX2:
+			lerpAvx2(f[c], t[c], weight, o[c], size);
+			break;
+		case Paths::SSE2:
+			lerpSse2(f[c], t[c], weight, o[c], size);
+			break;
+#endif
+#if defined(__ARM_NEON)
+		case Paths::NEON:
+			lerpNeon(f[c], t[c], weight, o[c], size);
+			break;
+#endif
+		default:
+			lerpScalar(f[c], t[c], weight, o[c], size);
+		}
+	}
+}
+
+void ColorKernels::scale(Buffer& buffer, uint8_t level) {
+	if (level == 255)
+		return;
+	uint16_t weight = toWeight(level);
+	size_t size = buffer.size();
+	for (auto plane : {&buffer.r, &buffer.g, &buffer.b}) {
+		switch (path) {
+#ifdef SIMD_X86
+		case Paths::AVX2:
+			scaleAvx2(plane->data(), weight, size);
+			break;
+		case Paths::SSE2:
+			scaleSse2(plane->data(), weight, size);
+			break;
+#endif
+#if defined(__ARM_NEON)
+		case Paths::NEON:
+			scaleNeon(plane->data(), weight, size);
+			break;
+#endif
+		default:
+			scaleScalar(plane->data(), weight, size);
+		}
+	}
+}
+
+void ColorKernels::gamma(Buffer& buffer) {
+	// A table lookup is a gather, not worth vectorizing for 8 bits.
+	for (auto plane : {&buffer.r, &buffer.g, &buffer.b})
+		for (auto& v : *plane)
+			v = GAMMA[v];
+}
+
+void ColorKernels::luminance(const Buffer& buffer, vector<uint8_t>& out) {
+	out.resize(buffer.size());
+	switch (path) {
+#ifdef SIMD_X86
+	case Paths::AVX2:
+		luminanceAvx2(buffer.r.data(), buffer.g.data(), buffer.b.data(), out.data(), out.size());
+		break;
+	case Paths::SSE2:
+		luminanceSse2(buffer.r.data(), buffer.g.data(), buffer.b.data(), out.data(), out.size());
+		break;
+#endif
+#if defined(__ARM_NEON)
+	case Paths::NEON:
+		luminanceNeon(buffer.r.data(), buffer.g.data(), buffer.b.data(), out.data(), out.size());
+		break;
+#endif
+	default:
+		luminanceScalar(buffer.r.data(), buffer.g.data(), buffer.b.data(), out.data(), out.size());
+	}
+}
+
+void ColorKernels::nearest(const Buffer& buffer, const Buffer& palette, vector<uint8_t>& out) {
+	out.assign(buffer.size(), 0);
+	if (palette.size() < 2)
+		return;
+	switch (path) {
+#ifdef SIMD_X86
+	case Paths::AVX2:
+		nearestAvx2(buffer.r.data(), buffer.g.data(), buffer.b.data(), palette, out.data(), out.size());
+		break;
+	case Paths::SSE2:
+		nearestSse2(buffer.r.data(), buffer.g.data(), buffer.b.data(), palette, out.data(), out.size());
+		break;
+#endif
+#if defined(__ARM_NEON)
+	case Paths::NEON:
+		nearestNeon(buffer.r.data(), buffer.g.data(), buffer.b.data(), palette, out.data(), out.size());
+		break;
+#endif
+	default:
+		nearestScalar(buffer.r.data(), buffer.g.data(), buffer.b.data(), palette, out.data(), out.size());
+	}
+}
+
+double ColorKernels::luminance(const string& hex) {
+	Buffer color(1);
+	if (not color.set(0, hex))
+		return 0;
+	uint8_t luma;
+	luminanceScalar(color.r.data(), color.g.data(), color.b.data(), &luma, 1);
+	return luma / 255.0;
+}
+
+ColorKernels::Paths ColorKernels::detect() {
+#ifdef SIMD_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return Paths::AVX2;
+	if (__builtin_cpu_supports("sse2"))
+		return Paths::SSE2;
+#endif
+#if defined(__ARM_NEON)
+	return Paths::NEON;
+#endif
+	return Paths::SCALAR;
+}
+
+uint16_t ColorKernels::toWeight(uint8_t amount) {
+	return amount + (amount >> 7);
+}
+
+void ColorKernels::lerpScalar(const uint8_t* from, const uint8_t* to, uint16_t weight, uint8_t* out, size_t size) {
+	uint16_t inverse = 256 - weight;
+	for (size_t c = 0; c < size; ++c)
+		out[c] = (from[c] * inverse + to[c] * weight) >> 8;
+}
+
+void ColorKernels::scaleScalar(uint8_t* data, uint16_t weight, size_t size) {
+	for (size_t c = 0; c < size; ++c)
+		data[c] = (data[c] * weight) >> 8;
+}
+
+void ColorKernels::luminanceScalar(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t size) {
+	for (size_t c = 0; c < size; ++c)
+		out[c] = (r[c] * LUMA_R + g[c] * LUMA_G + b[c] * LUMA_B) >> 8;
+}
+
+void ColorKernels::nearestScalar(const uint8_t* r, const uint8_t* g, const uint8_t* b, const Buffer& palette, uint8_t* out, size_t size) {
+	for (size_t c = 0; c < size; ++c) {
+		int32_t best = INT32_MAX;
+		for (size_t p = 0; p < palette.size(); ++p) {
+			int32_t
+				dr = r[c] - palette.r[p],
+				dg = g[c] - palette.g[p],
+				db = b[c] - palette.b[p],
+				distance = dr * dr + dg * dg + db * db;
+			// Strictly less, on a tie the first color wins in every path.
+			if (distance < best) {
+				best   = distance;
+				out[c] = p;
+			}
+		}
+	}
+}
+
+#ifdef SIMD_X86
+
+TARGET_SSE2
+void ColorKernels::lerpSse2(const uint8_t* from, const uint8_t* to, uint16_t weight, uint8_t* out, size_t size) {
+	const __m128i
+		zero = _mm_setzero_si128(),
+		wTo  = _mm_set1_epi16(weight),
+		wFr  = _mm_set1_epi16(256 - weight);
+	size_t c = 0;
+	for (; c + 16 <= size; c += 16) {
+		__m128i
+			f  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + c)),
+			t  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(to + c)),
+			lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(f, zero), wFr), _mm_mullo_epi16(_mm_unpacklo_epi8(t, zero), wTo)),
+			hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(f, zero), wFr), _mm_mullo_epi16(_mm_unpackhi_epi8(t, zero), wTo));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + c), _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+	}
+	lerpScalar(from + c, to + c, weight, out + c, size - c);
+}
+
+TARGET_SSE2
+void ColorKernels::scaleSse2(uint8_t* data, uint16_t weight, size_t size) {
+	const __m128i
+		zero = _mm_setzero_si128(),
+		w    = _mm_set1_epi16(weight);
+	size_t c = 0;
+	for (; c + 16 <= size; c += 16) {
+		__m128i
+			v  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + c)),
+			lo = _mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), w),
+			hi = _mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), w);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(data + c), _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+	}
+	scaleScalar(data + c, weight, size - c);
+}
+
+TARGET_SSE2
+void ColorKernels::luminanceSse2(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t size) {
+	const __m128i
+		zero = _mm_setzero_si128(),
+		wR   = _mm_set1_epi16(LUMA_R),
+		wG   = _mm_set1_epi16(LUMA_G),
+		wB   = _mm_set1_epi16(LUMA_B);
+	size_t c = 0;
+	for (; c + 16 <= size; c += 16) {
+		__m128i
+			vr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r + c)),
+			vg = _mm_loadu_si128(reinterpret_cast<const __m128i*>(g + c)),
+			vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + c)),
+			lo = _mm_add_epi16(_mm_add_epi16(
+				_mm_mullo_epi16(_mm_unpacklo_epi8(vr, zero), wR),
+				_mm_mullo_epi16(_mm_unpacklo_epi8(vg, zero), wG)),
+				_mm_mullo_epi16(_mm_unpacklo_epi8(vb, zero), wB)),
+			hi = _mm_add_epi16(_mm_add_epi16(
+				_mm_mullo_epi16(_mm_unpackhi_epi8(vr, zero), wR),
+				_mm_mullo_epi16(_mm_unpackhi_epi8(vg, zero), wG)),
+				_mm_mullo_epi16(_mm_unpackhi_epi8(vb, zero), wB));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + c), _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+	}
+	luminanceScalar(r + c, g + c, b + c, out + c, size - c);
+}
+
+TARGET_SSE2
+void ColorKernels::nearestSse2(const uint8_t* r, const uint8_t* g, const uint8_t* b, const Buffer& palette, uint8_t* out, size_t size) {
+	const __m128i zero = _mm_setzero_si128();
+	size_t c = 0;
+	// 8 colors per round, the distance is dr² + dg² and db² + 0 by multiply-add of interleaved 16 bits pairs.
+	for (; c + 8 <= size; c += 8) {
+		__m128i
+			vr     = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(r + c)), zero),
+			vg     = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(g + c)), zero),
+			vb     = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(b + c)), zero),
+			bestLo = _mm_set1_epi32(INT32_MAX),
+			bestHi = bestLo,
+			idxLo  = zero,
+			idxHi  = zero;
+		for (size_t p = 0; p < palette.size(); ++p) {
+			__m128i
+				dr    = _mm_sub_epi16(vr, _mm_set1_epi16(palette.r[p])),
+				dg    = _mm_sub_epi16(vg, _mm_set1_epi16(palette.g[p])),
+				db    = _mm_sub_epi16(vb, _mm_set1_epi16(palette.b[p])),
+				rgLo  = _mm_unpacklo_epi16(dr, dg),
+				rgHi  = _mm_unpackhi_epi16(dr, dg),
+				bLo   = _mm_unpacklo_epi16(db, zero),
+				bHi   = _mm_unpackhi_epi16(db, zero),
+				dLo   = _mm_add_epi32(_mm_madd_epi16(rgLo, rgLo), _mm_madd_epi16(bLo, bLo)),
+				dHi   = _mm_add_epi32(_mm_madd_epi16(rgHi, rgHi), _mm_madd_epi16(bHi, bHi)),
+				mLo   = _mm_cmplt_epi32(dLo, bestLo),
+				mHi   = _mm_cmplt_epi32(dHi, bestHi),
+				index = _mm_set1_epi32(p);
+			bestLo = _mm_or_si128(_mm_and_si128(mLo, dLo), _mm_andnot_si128(mLo, bestLo));
+			bestHi = _mm_or_si128(_mm_and_si128(mHi, dHi), _mm_andnot_si128(mHi, bestHi));
+			idxLo  = _mm_or_si128(_mm_and_si128(mLo, index), _mm_andnot_si128(mLo, idxLo));
+			idxHi  = _mm_or_si128(_mm_and_si128(mHi, index), _mm_andnot_si128(mHi, idxHi));
+		}
+		__m128i packed = _mm_packs_epi32(idxLo, idxHi);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(out + c), _mm_packus_epi16(packed, packed));
+	}
+	nearestScalar(r + c, g + c, b + c, palette, out + c, size - c);
+}
+
+TARGET_AVX2
+void ColorKernels::lerpAvx2(const uint8_t* from, const uint8_t* to, uint16_t weight, uint8_t* out, size_t size) {
+	const __m256i
+		zero = _mm256_setzero_si256(),
+		wTo  = _mm256_set1_epi16(weight),
+		wFr  = _mm256_set1_epi16(256 - weight);
+	size_t c = 0;
+	// Unpack and pack work inside each 128 bits lane, so the order is kept.
+	for (; c + 32 <= size; c += 32) {
+		__m256i
+			f  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + c)),
+			t  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(to + c)),
+			lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(f, zero), wFr), _mm256_mullo_epi16(_mm256_unpacklo_epi8(t, zero), wTo)),
+			hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(f, zero), wFr), _mm256_mullo_epi16(_mm256_unpackhi_epi8(t, zero), wTo));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + c), _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8)));
+	}
+	lerpScalar(from + c, to + c, weight, out + c, size - c);
+}
+
+TARGET_AVX2
+void ColorKernels::scaleAvx2(uint8_t* data, uint16_t weight, size_t size) {
+	const __m256i
+		zero = _mm256_setzero_si256(),
+		w    = _mm256_set1_epi16(weight);
+	size_t c = 0;
+	for (; c + 32 <= size; c += 32) {
+		__m256i
+			v  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + c)),
+			lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(v, zero), w),
+			hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(v, zero), w);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(data + c), _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8)));
+	}
+	scaleScalar(data + c, weight, size - c);
+}
+
+TARGET_AVX2
+void ColorKernels::luminanceAvx2(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t size) {
+	const __m256i
+		zero = _mm256_setzero_si256(),
+		wR   = _mm256_set1_epi16(LUMA_R),
+		wG   = _mm256_set1_epi16(LUMA_G),
+		wB   = _mm256_set1_epi16(LUMA_B);
+	size_t c = 0;
+	for (; c + 32 <= size; c += 32) {
+		__m256i
+			vr = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(r + c)),
+			vg = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(g + c)),
+			vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + c)),
+			lo = _mm256_add_epi16(_mm256_add_epi16(
+				_mm256_mullo_epi16(_mm256_unpacklo_epi8(vr, zero), wR),
+				_mm256_mullo_epi16(_mm256_unpacklo_epi8(vg, zero), wG)),
+				_mm256_mullo_epi16(_mm256_unpacklo_epi8(vb, zero), wB)),
+			hi = _mm256_add_epi16(_mm256_add_epi16(
+				_mm256_mullo_epi16(_mm256_unpackhi_epi8(vr, zero), wR),
+				_mm256_mullo_epi16(_mm256_unpackhi_epi8(vg, zero), wG)),
+				_mm256_mullo_epi16(_mm256_unpackhi_epi8(vb, zero), wB));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + c), _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8)));
+	}
+	luminanceScalar(r + c, g + c, b + c, out + c, size - c);
+}
+
+TARGET_AVX2
+void ColorKernels::nearestAvx2(const uint8_t* r, const uint8_t* g, const uint8_t* b, const Buffer& palette, uint8_t* out, size_t size) {
+	const __m256i zero = _mm256_setzero_si256();
+	size_t c = 0;
+	// 16 colors per round, same as SSE2 but the lanes hold colors 0-3 / 8-11 (low) and 4-7 / 12-15 (high).
+	for (; c + 16 <= size; c += 16) {
+		__m256i
+			vr     = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(r + c))),
+			vg     = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(g + c))),
+			vb     = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + c))),
+			bestLo = _mm256_set1_epi32(INT32_MAX),
+			bestHi = bestLo,
+			idxLo  = zero,
+			idxHi  = zero;
+		for (size_t p = 0; p < palette.size(); ++p) {
+			__m256i
+				dr    = _mm256_sub_epi16(vr, _mm256_set1_epi16(palette.r[p])),
+				dg    = _mm256_sub_epi16(vg, _mm256_set1_epi16(palette.g[p])),
+				db    = _mm256_sub_epi16(vb, _mm256_set1_epi16(palette.b[p])),
+				rgLo  = _mm256_unpacklo_epi16(dr, dg),
+				rgHi  = _mm256_unpackhi_epi16(dr, dg),
+				bLo   = _mm256_unpacklo_epi16(db, zero),
+				bHi   = _mm256_unpackhi_epi16(db, zero),
+				dLo   = _mm256_add_epi32(_mm256_madd_epi16(rgLo, rgLo), _mm256_madd_epi16(bLo, bLo)),
+				dHi   = _mm256_add_epi32(_mm256_madd_epi16(rgHi, rgHi), _mm256_madd_epi16(bHi, bHi)),
+				mLo   = _mm256_cmpgt_epi32(bestLo, dLo),
+				mHi   = _mm256_cmpgt_epi32(bestHi, dHi),
+				index = _mm256_set1_epi32(p);
+			bestLo = _mm256_blendv_epi8(bestLo, dLo, mLo);
+			bestHi = _mm256_blendv_epi8(bestHi, dHi, mHi);
+			idxLo  = _mm256_blendv_epi8(idxLo, index, mLo);
+			idxHi  = _mm256_blendv_epi8(idxHi, index, mHi);
+		}
+		// Packing restores 0-7 in the low lane and 8-15 in the high lane, the permute joins them.
+		__m256i packed = _mm256_packs_epi32(idxLo, idxHi);
+		packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(packed, packed), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + c), _mm256_castsi256_si128(packed));
+	}
+	nearestScalar(r + c, g + c, b + c, palette, out + c, size - c);
+}
+
+#endif
+
+#if defined(__ARM_NEON)
+
+void ColorKernels::lerpNeon(const uint8_t* from, const uint8_t* to, uint16_t weight, uint8_t* out, size_t size) {
+	const uint16x8_t
+		wTo = vdupq_n_u16(weight),
+		wFr = vdupq_n_u16(256 - weight);
+	size_t c = 0;
+	for (; c + 16 <= size; c += 16) {
+		uint8x16_t
+			f = vld1q_u8(from + c),
+			t = vld1q_u8(to + c);
+		uint16x8_t
+			lo = vmlaq_u16(vmulq_u16(vmovl_u8(vget_low_u8(f)), wFr), vmovl_u8(vget_low_u8(t)), wTo),
+			hi = vmlaq_u16(vmulq_u16(vmovl_u8(vget_high_u8(f)), wFr), vmovl_u8(vget_high_u8(t)), wTo);
+		vst1q_u8(out + c, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+	}
+	lerpScalar(from + c, to + c, weight, out + c, size - c);
+}
+
+void ColorKernels::scaleNeon(uint8_t* data, uint16_t weight, size_t size) {
+	const uint16x8_t w = vdupq_n_u16(weight);
+	size_t c = 0;
+	for (; c + 16 <= size; c += 16) {
+		uint8x16_t v = vld1q_u8(data + c);
+		uint16x8_t
+			lo = vmulq_u16(vmovl_u8(vget_low_u8(v)), w),
+			hi = vmulq_u16(vmovl_u8(vget_high_u8(v)), w);
+		vst1q_u8(data + c, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+	}
+	scaleScalar(data + c, weight, size - c);
+}
+
+void ColorKernels::luminanceNeon(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t size) {
+	const uint8x8_t
+		wR = vdup_n_u8(LUMA_R),
+		wG = vdup_n_u8(LUMA_G),
+		wB = vdup_n_u8(LUMA_B);
+	size_t c = 0;
+	for (; c + 16 <= size; c += 16) {
+		uint8x16_t
+			vr = vld1q_u8(r + c),
+			vg = vld1q_u8(g + c),
+			vb = vld1q_u8(b + c);
+		uint16x8_t
+			lo = vmlal_u8(vmlal_u8(vmull_u8(vget_low_u8(vr), wR), vget_low_u8(vg), wG), vget_low_u8(vb), wB),
+			hi = vmlal_u8(vmlal_u8(vmull_u8(vget_high_u8(vr), wR), vget_high_u8(vg), wG), vget_high_u8(vb), wB);
+		vst1q_u8(out + c, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+	}
+	luminanceScalar(r + c, g + c, b + c, out + c, size - c);
+}
+
+void ColorKernels::nearestNeon(const uint8_t* r, const uint8_t* g, const uint8_t* b, const Buffer& palette, uint8_t* out, size_t size) {
+	size_t c = 0;
+	for (; c + 8 <= size; c += 8) {
+		int16x8_t
+			vr = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(r + c))),
+			vg = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(g + c))),
+			vb = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(b + c)));
+		int32x4_t
+			bestLo = vdupq_n_s32(INT32_MAX),
+			bestHi = bestLo;
+		uint32x4_t
+			idxLo = vdupq_n_u32(0),
+			idxHi = idxLo;
+		for (size_t p = 0; p < palette.size(); ++p) {
+			int16x8_t
+				dr = vsubq_s16(vr, vdupq_n_s16(palette.r[p])),
+				dg = vsubq_s16(vg, vdupq_n_s16(palette.g[p])),
+				db = vsubq_s16(vb, vdupq_n_s16(palette.b[p]));
+			int32x4_t
+				dLo = vmlal_s16(vmlal_s16(vmull_s16(vget_low_s16(dr), vget_low_s16(dr)), vget_low_s16(dg), vget_low_s16(dg)), vget_low_s16(db), vget_low_s16(db)),
+				dHi = vmlal_s16(vmlal_s16(vmull_s16(vget_high_s16(dr), vget_high_s16(dr)), vget_high_s16(dg), vget_high_s16(dg)), vget_high_s16(db), vget_high_s16(db));
+			uint32x4_t
+				mLo   = vcltq_s32(dLo, bestLo),
+				mHi   = vcltq_s32(dHi, bestHi),
+				index = vdupq_n_u32(p);
+			bestLo = vbslq_s32(mLo, dLo, bestLo);
+			bestHi = vbslq_s32(mHi, dHi, bestHi);
+			idxLo  = vbslq_u32(mLo, index, idxLo);
+			idxHi  = vbslq_u32(mHi, index, idxHi);
+		}
+		vst1_u8(out + c, vmovn_u16(vcombine_u16(vmovn_u32(idxLo), vmovn_u32(idxHi))));
+	}
+	nearestScalar(r + c, g + c, b + c, palette, out + c, size - c);
+}
+
+#endif
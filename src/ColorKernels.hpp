@@ -0,0 +1,247 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ColorKernels.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+using std::vector;
+
+#include <array>
+
+#include <string>
+using std::string;
+
+#include <cstdint>
+
+#ifndef COLORKERNELS_HPP_
+#define COLORKERNELS_HPP_ 1
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::ColorKernels
+ * Bulk RGB math over planar buffers, one plane per channel.
+ * Every kernel but gamma has a scalar version and SSE2, AVX2 or NEON ones, the best the CPU supports is picked on first use.
+ * All paths give exactly the same results.
+ * Does not depend on gtkmm, the benchmark links it alone.
+ */
+class ColorKernels {
+
+public:
+
+	/**
+	 * Instruction sets.
+	 */
+	enum class Paths : uint8_t {
+		SCALAR,
+		SSE2,
+		AVX2,
+		NEON
+	};
+
+	/**
+	 * Structure of arrays RGB buffer.
+	 */
+	struct Buffer {
+		vector<uint8_t>
+			r,
+			g,
+			b;
+
+		Buffer() = default;
+
+		Buffer(size_t size);
+
+		void resize(size_t size);
+
+		size_t size() const;
+
+		void set(size_t index, uint8_t red, uint8_t green, uint8_t blue);
+
+		/**
+		 * Sets a color from a RRGGBB string, invalid strings are black.
+		 * @param index
+		 * @param hex
+		 * @return false if the string is not valid.
+		 */
+		bool set(size_t index, const string& hex);
+	};
+
+	ColorKernels() = delete;
+
+	virtual ~ColorKernels() = default;
+
+	/// Gamma 2.2 correction, computed at compile time.
+	static const std::array<uint8_t, 256> GAMMA;
+
+	/// Luma weights in 8 bits fixed point, they add up to 256.
+	static constexpr uint8_t
+		LUMA_R = 77,
+		LUMA_G = 150,
+		LUMA_B = 29;
+
+	/**
+	 * @return the path in use.
+	 */
+	static Paths getPath();
+
+	/**
+	 * Changes the path, if the CPU cannot run it the best supported is used.
+	 * @param path
+	 * @return the path in use.
+	 */
+	static Paths setPath(Paths path);
+
+	/**
+	 * @param path
+	 * @return true if the CPU can run it.
+	 */
+	static bool isSupported(Paths path);
+
+	/**
+	 * @param path
+	 * @return
+	 */
+	static string toString(Paths path);
+
+	/**
+	 * Blends two buffers, out = from + (to - from) * amount / 255.
+	 * A fade is a blend into black, out can be from or to.
+	 * @param from
+	 * @param to
+	 * @param amount 0 is from, 255 is to.
+	 * @param out needs the same size.
+	 */
+	static void lerp(const Buffer& from, const Buffer& to, uint8_t amount, Buffer& out);
+
+	/**
+	 * Scales the brightness.
+	 * @param buffer
+	 * @param level 255 leaves it untouched.
+	 */
+	static void scale(Buffer& buffer, uint8_t level);
+
+	/**
+	 * Applies the gamma table, a plain lookup on every path, lane by lane lookups were not faster.
+	 * @param buffer
+	 */
+	static void gamma(Buffer& buffer);
+
+	/**
+	 * Calculates the luma of every color, 0.299 R + 0.587 G + 0.114 B in 8 bits fixed point.
+	 * @param buffer
+	 * @param out resized to the buffer size.
+	 */
+	static void luminance(const Buffer& buffer, vector<uint8_t>& out);
+
+	/**
+	 * Finds the closest palette color, by squared RGB distance, to every color.
+	 * @param buffer
+	 * @param palette up to 256 colors.
+	 * @param out palette index of every color, resized to the buffer size.
+	 */
+	static void nearest(const Buffer& buffer, const Buffer& palette, vector<uint8_t>& out);
+
+	/**
+	 * @param hex a RRGGBB string.
+	 * @return the luma from 0 to 1, 0 if the string is not valid.
+	 */
+	static double luminance(const string& hex);
+
+protected:
+
+	static Paths path;
+
+	/**
+	 * @return the best path the CPU supports.
+	 */
+	static Paths detect();
+
+	static void lerpScalar(const uint8_t* from, const uint8_t* to, uint16_t weight, uint8_t* out, size_t size);
+
+	static void scaleScalar(uint8_t* data, uint16_t weight, size_t size);
+
+	static void luminanceScalar(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t size);
+
+	static void nearestScalar(const uint8_t* r, const uint8_t* g, const uint8_t* b, const Buffer& palette, uint8_t* out, size_t size);
+
+#if defined(__x86_64__) || defined(__i386__)
+	static void lerpSse2(const uint8_t* from, const uint8_t* to, uint16_t weight, uint8_t* out, size_t size);
+
+	static void scaleSse2(uint8_t* data, uint16_t weight, size_t size);
+
+	static void luminanceSse2(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t size);
+
+	static void nearestSse2(const uint8_t* r, const uint8_t* g, const uint8_t* b, const Buffer& palette, uint8_t* out, size_t size);
+
+	static void lerpAvx2(const uint8_t* from, const uint8_t* to, uint16_t weight, uint8_t* out, size_t size);
+
+	static void scaleAvx2(uint8_t* data, uint16_t weight, size_t size);
+
+	static void luminanceAvx2(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t size);
+
+	static void nearestAvx2(const uint8_t* r, const uint8_t* g, const uint8_t* b, const Buffer& palette, uint8_t* out, size_t size);
+#endif
+
+#if defined(__ARM_NEON)
+	static void lerpNeon(const uint8_t* from, const uint8_t* to, uint16_t weight, uint8_t* out, size_t size);
+
+	static void scaleNeon(uint8_t* data, uint16_t weight, size_t size);
+
+	static void luminanceNeon(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint8_t* out, size_t size);
+
+	static void nearestNeon(const uint8_t* r, const uint8_t* g, const uint8_t* b, const Buffer& palette, uint8_t* out, size_t size);
+#endif
+
+	/**
+	 * @param amount 0 to 255.
+	 * @return the same amount from 0 to 256, so 255 is exact.
+	 */
+	static uint16_t toWeight(uint8_t amount);
+
+	/**
+	 * @param x 0 to 1.
+	 * @return the fifth root, by Newton's method.
+	 */
+	static constexpr double root5(double x) {
+		double y = 1;
+		for (uint8_t c = 0; c < 64; ++c)
+			y -= (y * y * y * y * y - x) / (5 * y * y * y * y);
+		return y;
+	}
+
+	/**
+	 * @return the gamma table, x^2.2 is x^2 times the fifth root of x.
+	 */
+	static constexpr std::array<uint8_t, 256> createGamma() {
+		std::array<uint8_t, 256> table{};
+		for (uint16_t c = 0; c < 256; ++c) {
+			double x = c / 255.0;
+			table[c] = static_cast<uint8_t>(x * x * root5(x) * 255 + 0.5);
+		}
+		return table;
+	}
+};
+
+inline constexpr std::array<uint8_t, 256> ColorKernels::GAMMA = ColorKernels::createGamma();
+
+} /* namespace */
+
+#endif /* COLORKERNELS_HPP_ */
@@ -25,12 +25,11 @@
 using namespace LEDSpicerUI;
 
 ConfigFile::ConfigFile(const string& ledspicerconf) : XMLHelper(ledspicerconf, "Configuration") {
+	Diagnostics::setSource(ledspicerconf);
 	// extract settings
 	nodeSettings = processNode(getRoot());
-	string errors(processDevices());
-	errors += processProcessLookup();
-	if (not errors.empty())
-		Message::displayError("Errors:\n" + errors);
+	processDevices();
+	processProcessLookup();
 }
 
 unordered_map<string, string> ConfigFile::getSettings() {
@@ -45,141 +44,139 @@ const string ConfigFile::getProcessLookupRunEvery() const {
 	return processLookupRunEvery;
 }
 
-const string ConfigFile::processDevices() {
+void ConfigFile::processDevices() {
 
 	tinyxml2::XMLElement* deviceNode = root->FirstChildElement("devices");
-	if (not deviceNode)
-		return "Missing Devices section\n";
+	if (not deviceNode) {
+		Diagnostics::error("Missing Devices section", "devices");
+		return;
+	}
 
+	int line(deviceNode->GetLineNum());
 	deviceNode = deviceNode->FirstChildElement("device");
-	if (not deviceNode )
-		return "Empty device section\n";
+	if (not deviceNode) {
+		Diagnostics::warning("Empty device section", "devices", line);
+		return;
+	}
 
-	string errors, name;
+	string name;
 	vector<unordered_map<string, string>> devices;
 	for (; deviceNode; deviceNode = deviceNode->NextSiblingElement("device")) {
 		unordered_map<string, string> deviceAttr = processNode(deviceNode);
-		try {
-			checkAttributes({NAME}, deviceAttr, "device");
-		}
-		catch (Message& e) {
-			errors += e.getMessage() + '\n';
+		line = deviceNode->GetLineNum();
+		string error(checkAttributes({NAME}, deviceAttr, "device"));
+		if (not error.empty()) {
+			Diagnostics::error(error, "devices", line);
 			continue;
 		}
 		name = deviceAttr[NAME];
-		if (not Defaults::devicesInfo.count(name)) {
-			errors += "Ignored device, unknown type " + name + '\n';
+		const Defaults::DeviceType type(Defaults::getDeviceType(name));
+		if (type == Defaults::DeviceType::invalid) {
+			Diagnostics::error("Ignored device, unknown type " + name, "devices", line);
 			continue;
 		}
 		// Create Unique ID.
-		unordered_map<string, string> data{
-			{NAME, name},
+		const string uniqueId(Defaults::createHardwareUniqueId(
+			type,
 			// Device ID is no mandatory, and if is missing on a ID device, is assumed 1
-			{ID,   deviceAttr.count(ID)   ? deviceAttr[ID] : "1"},
+			deviceAttr.count(ID)   ? deviceAttr[ID] : "1",
 			// Serial Devices allows empty device serial PORT, that defaults to /dev/ttyUSB0or auto-detects.
-			{PORT, deviceAttr.count(PORT) ? deviceAttr[PORT] : ""}
-		};
+			deviceAttr.count(PORT) ? deviceAttr[PORT] : ""
+		));
 
 		devices.push_back(deviceAttr);
-		string elementErrors(processElements(deviceNode, Defaults::createHardwareUniqueId(data)));
-		errors += (not elementErrors.empty() ? elementErrors  + '\n' : "");
+		processElements(deviceNode, uniqueId);
 	}
 	extractedData.emplace(COLLECTION_DEVICES, std::move(devices));
 
-	string groupErrors(processGroups());
-	string restrictorErrors(processRestrictors());
-	errors += (not groupErrors.empty() ? groupErrors + '\n' : "") + (not restrictorErrors.empty() ? restrictorErrors + '\n' : "") ;
-	return errors;
+	processGroups();
+	processRestrictors();
 }
 
-const string ConfigFile::processRestrictors() {
+void ConfigFile::processRestrictors() {
 	tinyxml2::XMLElement* restrictorNode = root->FirstChildElement("restrictors");
 	// Restrictors are optional.
 	if (not restrictorNode)
-		return "";
+		return;
 
 	restrictorNode = restrictorNode->FirstChildElement("restrictor");
-	if (not restrictorNode )
-		return "";
+	if (not restrictorNode)
+		return;
 
-	string errors, name;
+	string name;
 	vector<unordered_map<string, string>> restrictors;
 	for (; restrictorNode; restrictorNode = restrictorNode->NextSiblingElement("restrictor")) {
 		unordered_map<string, string> restrictorAttr = processNode(restrictorNode);
-		try {
-			checkAttributes({NAME}, restrictorAttr, "device");
-		}
-		catch (Message& e) {
-			errors += '\n' + e.getMessage();
+		const int line(restrictorNode->GetLineNum());
+		string error(checkAttributes({NAME}, restrictorAttr, "restrictor"));
+		if (not error.empty()) {
+			Diagnostics::error(error, "restrictors", line);
 			continue;
 		}
 		name = restrictorAttr[NAME];
-		if (not Defaults::restrictorsInfo.count(name)) {
-			errors += "Ignored restrictor, unknown type " + name + '\n';
+		const Defaults::RestrictorType type(Defaults::getRestrictorType(name));
+		if (type == Defaults::RestrictorType::invalid) {
+			Diagnostics::error("Ignored restrictor, unknown type " + name, "restrictors", line);
 			continue;
 		}
 		// Create Unique ID.
-		unordered_map<string, string> data{
-			{NAME, name},
+		const string uniqueId(Defaults::createHardwareUniqueId(
+			type,
 			// Restrictor ID is no mandatory, and if is missing on a ID restrictor, is assumed 1
-			{ID,   not restrictorAttr.count(ID)   ? "1" : restrictorAttr[ID]},
+			not restrictorAttr.count(ID)   ? "1" : restrictorAttr[ID],
 			// Serial restrictors allows empty port, that defaults to /dev/ttyUSB0 or auto-detects.
-			{PORT, not restrictorAttr.count(PORT) ? ""  : restrictorAttr[PORT]}
-		};
+			not restrictorAttr.count(PORT) ? ""  : restrictorAttr[PORT]
+		));
 
 		restrictors.push_back(restrictorAttr);
-		string mapErrors(processRestrictorMaps(restrictorNode, Defaults::createHardwareUniqueId(data, false)));
-		errors += (not mapErrors.empty() ? mapErrors  + '\n' : "");
+		processRestrictorMaps(restrictorNode, uniqueId);
 	}
 	extractedData.emplace(COLLECTION_RESTRICTORS, std::move(restrictors));
-	return errors;
 }
 
-const string ConfigFile::processProcessLookup() {
+void ConfigFile::processProcessLookup() {
 	tinyxml2::XMLElement* plNode = root->FirstChildElement("processLookup");
 	if (not plNode)
-		return "";
+		return;
 
 	unordered_map<string, string> plAttr = processNode(plNode);
 	processLookupRunEvery = plAttr.count(PARAM_MILLISECONDS) ? plAttr.at(PARAM_MILLISECONDS) : "";
 
 	plNode = plNode->FirstChildElement("map");
-	if (not plNode )
-		return "";
+	if (not plNode)
+		return;
 
-	string errors;
 	vector<unordered_map<string, string>> process;
 	for (; plNode; plNode = plNode->NextSiblingElement("map")) {
 		plAttr = processNode(plNode);
-		try {
-			checkAttributes({PARAM_PROCESS_NAME, PARAM_SYSTEM}, plAttr, "processlookup");
-		}
-		catch (Message& e) {
-			errors += e.getMessage() + '\n';
+		string error(checkAttributes({PARAM_PROCESS_NAME, PARAM_SYSTEM}, plAttr, "processlookup"));
+		if (not error.empty()) {
+			Diagnostics::error(error, "processLookup", plNode->GetLineNum());
 			continue;
 		}
 		process.push_back(plAttr);
 	}
 	extractedData.emplace(COLLECTION_PROCESS, std::move(process));
-	return errors;
 }
 
-const string ConfigFile::processElements(tinyxml2::XMLElement* deviceNode, const string& deviceName) {
+void ConfigFile::processElements(tinyxml2::XMLElement* deviceNode, const string& deviceName) {
 
+	const string place(Defaults::implode(Defaults::explode(deviceName, FIELD_SEPARATOR), ' '));
 	tinyxml2::XMLElement* elementNode = deviceNode->FirstChildElement("element");
-	if (not elementNode)
-		return "Missing elements node for " + deviceName + '\n';
+	if (not elementNode) {
+		Diagnostics::warning("Missing elements node", place, deviceNode->GetLineNum());
+		return;
+	}
 	vector<unordered_map<string, string>> elements;
-	string errors;
 	for (; elementNode; elementNode = elementNode->NextSiblingElement("element")) {
 		unordered_map<string, string> elementAttr = processNode(elementNode);
 		if (not elementAttr.count(NAME)) {
-			errors += "Ignored element, Missing element name in " + deviceName + '\n';
+			Diagnostics::error("Ignored element, Missing element name", place, elementNode->GetLineNum());
 			continue;
 		}
 		if (not elementAttr.count(PIN) and not elementAttr.count(SOLENOID))
 			if (not elementAttr.count(RED_PIN) or not elementAttr.count(GREEN_PIN) or not elementAttr.count(BLUE_PIN)) {
-				errors += "Ignored element, Missing pin data in element (" + elementAttr[NAME] + ") in " + deviceName + '\n';
+				Diagnostics::error("Ignored element, Missing pin data in element (" + elementAttr[NAME] + ")", place, elementNode->GetLineNum());
 				continue;
 			}
 
@@ -188,38 +185,37 @@ const string ConfigFile::processElements(tinyxml2::XMLElement* deviceNode, const
 		elements.push_back(elementAttr);
 	}
 	extractedData.emplace(Defaults::createCommonUniqueId({deviceName, COLLECTION_ELEMENT}), std::move(elements));
-	return errors;
 }
 
-const string ConfigFile::processRestrictorMaps(tinyxml2::XMLElement* restrictorNode, const string& restrictorName) {
+void ConfigFile::processRestrictorMaps(tinyxml2::XMLElement* restrictorNode, const string& restrictorName) {
+	const string place(Defaults::implode(Defaults::explode(restrictorName, FIELD_SEPARATOR), ' '));
 	tinyxml2::XMLElement* mapNode = restrictorNode->FirstChildElement("map");
-	if (not mapNode)
-		return "Missing player map node for " + restrictorName + '\n';
+	if (not mapNode) {
+		Diagnostics::warning("Missing player map node", place, restrictorNode->GetLineNum());
+		return;
+	}
 	vector<unordered_map<string, string>> maps;
-	string errors;
 	for (; mapNode; mapNode = mapNode->NextSiblingElement("map")) {
 
 		unordered_map<string, string> mapAttr = processNode(mapNode);
-		try {
-			checkAttributes({PLAYER, JOYSTICK, RESTRICTOR_INTERFACE}, mapAttr, "restrictor map");
-		}
-		catch (Message& e) {
-			errors += '\n' + e.getMessage();
+		string error(checkAttributes({PLAYER, JOYSTICK, RESTRICTOR_INTERFACE}, mapAttr, "restrictor map"));
+		if (not error.empty()) {
+			Diagnostics::error(error, place, mapNode->GetLineNum());
 			continue;
 		}
 		maps.push_back(mapAttr);
 	}
 	extractedData.emplace(Defaults::createCommonUniqueId({restrictorName, COLLECTION_RESTRICTOR_MAP}), std::move(maps));
-	return errors;
 }
 
-const string ConfigFile::processGroups() {
+void ConfigFile::processGroups() {
 	unordered_map<string, string> group;
 	tinyxml2::XMLElement* layoutNode = root->FirstChildElement("layout");
-	if (not layoutNode)
-		throw Message("Missing layout section, no groups\n");
+	if (not layoutNode) {
+		Diagnostics::error("Missing layout section, no groups", "layout");
+		return;
+	}
 
-	string errors;
 	// extract default profile.
 	group = processNode(layoutNode);
 	defaultProfile = group["defaultProfile"];
@@ -231,7 +227,7 @@ const string ConfigFile::processGroups() {
 	for (; groupNode; groupNode = groupNode->NextSiblingElement("group")) {
 		group = processNode(groupNode);
 		if (not group.count(NAME)) {
-			errors += "Missing group name\n";
+			Diagnostics::error("Missing group name", "layout", groupNode->GetLineNum());
 			continue;
 		}
 
@@ -240,15 +236,15 @@ const string ConfigFile::processGroups() {
 		tinyxml2::XMLElement* elementNode = groupNode->FirstChildElement("element");
 
 		if (not elementNode) {
-			errors += "Group " + group[NAME] + " is empty\n";
+			Diagnostics::warning("Group is empty", "group " + group[NAME], groupNode->GetLineNum());
 			continue;
 		}
 
 		vector<unordered_map<string, string>> elements;
 		for (; elementNode; elementNode = elementNode->NextSiblingElement("element")) {
 			unordered_map<string, string> elementAttr = processNode(elementNode);
-			if (not group.count(NAME)) {
-				errors += "Missing element name in group " + group[NAME] + '\n';
+			if (not elementAttr.count(NAME)) {
+				Diagnostics::error("Missing element name", "group " + group[NAME], elementNode->GetLineNum());
 				continue;
 			}
 			elements.push_back(elementAttr);
@@ -256,5 +252,4 @@ const string ConfigFile::processGroups() {
 		extractedData.emplace(Defaults::createCommonUniqueId({group[NAME], COLLECTION_GROUP}), std::move(elements));
 	}
 	extractedData.emplace(COLLECTION_GROUP, std::move(groups));
-	return errors;
 }
@@ -54,17 +54,17 @@ protected:
 
 	unordered_map<string, string> nodeSettings;
 
-	const string processDevices();
+	void processDevices();
 
-	const string processRestrictors();
+	void processRestrictors();
 
-	const string processProcessLookup();
+	void processProcessLookup();
 
-	const string processElements(tinyxml2::XMLElement* deviceNode, const string& deviceName);
+	void processElements(tinyxml2::XMLElement* deviceNode, const string& deviceName);
 
-	const string processRestrictorMaps(tinyxml2::XMLElement* restrictorNode, const string& restrictorName);
+	void processRestrictorMaps(tinyxml2::XMLElement* restrictorNode, const string& restrictorName);
 
-	const string processGroups();
+	void processGroups();
 
 };
 
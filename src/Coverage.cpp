@@ -0,0 +1,263 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Coverage.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Coverage.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstring>
+#include <chrono>
+#include <exception>
+
+using namespace LEDSpicerUI;
+
+void Coverage::Layout::addTrigger(const string& type, const string& target, const string& trigger) {
+	auto& t = triggers[trigger];
+	if (type == GROUP) {
+		auto g = groups.find(target);
+		if (g != groups.end())
+			t.insert(t.end(), g->second.begin(), g->second.end());
+		return;
+	}
+	t.push_back(target);
+}
+
+Coverage::Coverage(Layout&& layout) : layout(std::move(layout)) {}
+
+Coverage::Layout Coverage::createLayout(ConfigFile& config, vector<InputFile*>& inputs) {
+	Layout layout;
+	for (const auto& device : config.getData(COLLECTION_DEVICES)) {
+		const auto type = Defaults::getDeviceType(device.at(NAME));
+		const string uniqueId(Defaults::createHardwareUniqueId(
+			type,
+			device.count(ID)   ? device.at(ID)   : "1",
+			device.count(PORT) ? device.at(PORT) : ""
+		));
+		for (const auto& element : config.getData(Defaults::createCommonUniqueId({uniqueId, COLLECTION_ELEMENT})))
+			layout.elements.insert(element.at(NAME));
+	}
+
+	for (const auto& group : config.getData(COLLECTION_GROUP)) {
+		auto& elements = layout.groups[group.at(NAME)];
+		for (const auto& element : config.getData(Defaults::createCommonUniqueId({group.at(NAME), COLLECTION_GROUP})))
+			elements.push_back(element.at(NAME));
+	}
+
+	for (const auto& restrictor : config.getData(COLLECTION_RESTRICTORS)) {
+		const auto type = Defaults::getRestrictorType(restrictor.at(NAME));
+		const string uniqueId(Defaults::createHardwareUniqueId(
+			type,
+			restrictor.count(ID)   ? restrictor.at(ID)   : "1",
+			restrictor.count(PORT) ? restrictor.at(PORT) : ""
+		));
+		for (const auto& map : config.getData(Defaults::createCommonUniqueId({uniqueId, COLLECTION_RESTRICTOR_MAP})))
+			layout.restrictors[map.at(PLAYER)].push_back(type);
+	}
+
+	for (auto input : inputs) {
+		const string name(input->getData(COLLECTION_INPUT).front().at(FILENAME));
+		for (const auto& map : input->getData(Defaults::createCommonUniqueId({name, COLLECTION_INPUT_MAPS})))
+			layout.addTrigger(map.at(TYPE), map.at(TARGET), map.at(TRIGGER));
+	}
+	return layout;
+}
+
+size_t Coverage::run(std::ostream& out, uint threads, const std::atomic<bool>* cancel) const {
+	const vector<string> games(GameData::getNames());
+	const size_t chunks = (games.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	if (not threads)
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+	threads = std::min<size_t>(threads, std::max<size_t>(chunks, 1));
+
+	out << "game,players,buttons,ways,restrictor,lit,unmapped\n";
+
+	// Every chunk is filled by any thread, but written in order as soon as is ready.
+	vector<string> results(chunks);
+	vector<bool> ready(chunks, false);
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::atomic<size_t> next(0);
+	// Set when a worker fails or the writer is done, the workers stop taking chunks.
+	std::atomic<bool> stop(false);
+	std::exception_ptr error;
+	auto cancelled = [&]() {
+		return stop or (cancel and *cancel);
+	};
+
+	vector<std::thread> workers;
+	for (uint t = 0; t < threads; ++t) {
+		workers.emplace_back([&]() {
+			for (size_t c = next++; c < chunks and not cancelled(); c = next++) {
+				string result;
+				try {
+					const size_t end = std::min(games.size(), (c + 1) * CHUNK_SIZE);
+					for (size_t g = c * CHUNK_SIZE; g < end; ++g)
+						result += createRow(games[g]);
+				}
+				catch (...) {
+					std::lock_guard<std::mutex> lock(mutex);
+					if (not error)
+						error = std::current_exception();
+					ready[c] = true;
+					stop     = true;
+					condition.notify_all();
+					return;
+				}
+				std::lock_guard<std::mutex> lock(mutex);
+				results[c] = std::move(result);
+				ready[c]   = true;
+				condition.notify_all();
+			}
+		});
+	}
+
+	size_t written = 0;
+	for (size_t c = 0; c < chunks; ++c) {
+		string result;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			// Cancel is not notified, it is polled.
+			while (not condition.wait_for(lock, std::chrono::milliseconds(50), [&]() { return ready[c] or cancelled(); }));
+			if (error or not ready[c])
+				break;
+			result.swap(results[c]);
+		}
+		out << result;
+		written = std::min(games.size(), (c + 1) * CHUNK_SIZE);
+	}
+	stop = true;
+	for (auto& worker : workers)
+		worker.join();
+	out.flush();
+	if (error)
+		std::rethrow_exception(error);
+	return written;
+}
+
+string Coverage::createRow(const string& name) const {
+	GameData::Game game;
+	GameData::find(name, game);
+
+	std::set<string> lit, unmapped;
+	for (const auto& control : getControls(game)) {
+		const vector<string>* targets = nullptr;
+		if (layout.elements.count(control)) {
+			lit.insert(control);
+			continue;
+		}
+		auto t = layout.triggers.find(control);
+		if (t != layout.triggers.end())
+			targets = &t->second;
+		else {
+			auto g = layout.groups.find(control);
+			if (g != layout.groups.end())
+				targets = &g->second;
+		}
+		if (targets and not targets->empty())
+			lit.insert(targets->begin(), targets->end());
+		else
+			unmapped.insert(control);
+	}
+
+	// Ways and if every player has a restrictor that can do it.
+	string ways, restrictor;
+	if (game.ways != Defaults::Ways::invalid) {
+		for (const auto& w : Defaults::wayIds)
+			if (w.second == game.ways)
+				ways = w.first;
+		restrictor = "ok";
+		for (uint p = 1; p <= std::max<uint>(game.players, 1); ++p) {
+			auto r = layout.restrictors.find(std::to_string(p));
+			if (r == layout.restrictors.end()) {
+				restrictor = "missing";
+				break;
+			}
+			if (std::none_of(r->second.begin(), r->second.end(), [&](Defaults::RestrictorType type) {
+				return type != Defaults::RestrictorType::invalid and Defaults::hasWay(type, game.ways);
+			})) {
+				restrictor = "unsupported";
+				break;
+			}
+		}
+	}
+
+	vector<string>
+		litList(lit.begin(), lit.end()),
+		unmappedList(unmapped.begin(), unmapped.end());
+	return
+		csv(name) + ',' +
+		std::to_string(game.players) + ',' +
+		std::to_string(game.buttons) + ',' +
+		ways + ',' +
+		restrictor + ',' +
+		csv(Defaults::implode(litList, ' ')) + ',' +
+		csv(Defaults::implode(unmappedList, ' ')) + '\n';
+}
+
+std::set<string> Coverage::getControls(const GameData::Game& game) {
+	std::set<string> controls;
+	for (uint p = 1; p <= game.players; ++p) {
+		const string player("P" + std::to_string(p) + "_");
+		controls.insert(player + "START");
+		for (uint b = 1; b <= game.buttons; ++b)
+			controls.insert(player + "BUTTON" + std::to_string(b));
+		for (const auto& type : game.controls) {
+			if (type.find("joy") != string::npos or type == "stick")
+				controls.insert(player + "JOYSTICK");
+			else if (type == "trackball")
+				controls.insert(player + "TRACKBALL");
+			else if (type == "dial" or type == "paddle")
+				controls.insert(player + "SPINNER");
+		}
+	}
+	// Files with per game labels and colors use the element names.
+	for (auto values : {&game.labels, &game.colors}) {
+		for (const auto& v : *values) {
+			string control(v.first);
+			// Joystick directions are a single element.
+			for (auto direction : {"_UP", "_DOWN", "_LEFT", "_RIGHT"}) {
+				size_t pos = control.find(direction);
+				if (pos != string::npos and pos + std::strlen(direction) == control.size()) {
+					control.erase(pos);
+					break;
+				}
+			}
+			controls.insert(control);
+		}
+	}
+	return controls;
+}
+
+string Coverage::csv(const string& value) {
+	if (value.find_first_of(",\"\n") == string::npos)
+		return value;
+	string r("\"");
+	for (char c : value) {
+		if (c == '"')
+			r += '"';
+		r += c;
+	}
+	return r + '"';
+}
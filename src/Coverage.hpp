@@ -0,0 +1,123 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Coverage.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "GameData.hpp"
+#include "ConfigFile.hpp"
+#include "InputFile.hpp"
+
+#include <set>
+#include <atomic>
+#include <ostream>
+#include <unordered_set>
+using std::unordered_set;
+
+#ifndef COVERAGE_HPP_
+#define COVERAGE_HPP_ 1
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::Coverage
+ * Checks every game from the data directory against a layout:
+ * what elements light, what restrictor ways are requested and what controls have no element.
+ * Games are processed in chunks by all cores and written in order as CSV.
+ */
+class Coverage {
+
+public:
+
+	/// Games per chunk, small enough to balance the threads and to stream the output.
+	static constexpr size_t CHUNK_SIZE = 256;
+
+	/**
+	 * What the layout provides.
+	 */
+	struct Layout {
+		unordered_set<string> elements;
+		/// Group name to element names.
+		unordered_map<string, vector<string>> groups;
+		/// Input trigger to element names.
+		unordered_map<string, vector<string>> triggers;
+		/// Player number to the restrictors mapped to it.
+		unordered_map<string, vector<Defaults::RestrictorType>> restrictors;
+
+		/**
+		 * Adds an input map, groups needs to be added first.
+		 * @param type Element or Group.
+		 * @param target
+		 * @param trigger
+		 */
+		void addTrigger(const string& type, const string& target, const string& trigger);
+	};
+
+	/**
+	 * @param layout
+	 */
+	Coverage(Layout&& layout);
+
+	virtual ~Coverage() = default;
+
+	/**
+	 * Creates a layout from a configuration file and input files.
+	 * @param config
+	 * @param inputs
+	 * @return
+	 */
+	static Layout createLayout(ConfigFile& config, vector<InputFile*>& inputs);
+
+	/**
+	 * Writes the report for every game in the open game data.
+	 * @param out
+	 * @param threads 0 to use all cores.
+	 * @param cancel checked between chunks, when set the report ends with the chunks already written.
+	 * @return the number of games written.
+	 * @throws anything a worker raised, after every worker is joined.
+	 */
+	size_t run(std::ostream& out, uint threads = 0, const std::atomic<bool>* cancel = nullptr) const;
+
+	/**
+	 * @param game
+	 * @return the report line for one game.
+	 */
+	string createRow(const string& game) const;
+
+protected:
+
+	const Layout layout;
+
+	/**
+	 * @param game
+	 * @return the controls the game uses, with the usual element names, like P1_BUTTON1.
+	 */
+	static std::set<string> getControls(const GameData::Game& game);
+
+	/**
+	 * @param value
+	 * @return the value quoted if needed.
+	 */
+	static string csv(const string& value);
+};
+
+} /* namespace */
+
+#endif /* COVERAGE_HPP_ */
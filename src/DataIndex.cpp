@@ -0,0 +1,250 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DataIndex.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "DataIndex.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <fstream>
+
+using namespace LEDSpicerUI;
+
+/// Cache header, change when the format changes.
+static constexpr char INDEX_MAGIC[8] = {'L', 'S', 'U', 'I', 'I', 'D', 'X', '1'};
+
+DataIndex::DataIndex(const string& fileName, Format format) :
+	fileName(fileName),
+	format(format)
+{
+	int fd = open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		throw Message("Unable to open " + fileName);
+
+	struct stat st;
+	if (fstat(fd, &st) or not st.st_size) {
+		close(fd);
+		throw Message(fileName + " is empty or invalid");
+	}
+	dataSize = st.st_size;
+	mtime    = st.st_mtime;
+
+	void* map = mmap(nullptr, dataSize, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		throw Message("Unable to map " + fileName);
+	data = static_cast<const char*>(map);
+
+	cached = loadCache();
+	if (cached)
+		return;
+
+	madvise(map, dataSize, MADV_SEQUENTIAL);
+	build();
+	// Lookups jump around.
+	madvise(map, dataSize, MADV_RANDOM);
+	saveCache();
+}
+
+DataIndex::~DataIndex() {
+	if (data)
+		munmap(const_cast<char*>(data), dataSize);
+}
+
+string_view DataIndex::find(const string& name) const {
+	auto e = std::lower_bound(entries.begin(), entries.end(), name, [&](const Entry& entry, const string& n) {
+		return nameOf(entry) < n;
+	});
+	if (e == entries.end() or nameOf(*e) != name)
+		return {};
+	return string_view(data + e->begin, e->end - e->begin);
+}
+
+size_t DataIndex::size() const {
+	return entries.size();
+}
+
+vector<string> DataIndex::getNames() const {
+	vector<string> r;
+	r.reserve(entries.size());
+	for (const auto& e : entries)
+		r.emplace_back(nameOf(e));
+	return r;
+}
+
+bool DataIndex::isCached() const {
+	return cached;
+}
+
+void DataIndex::build() {
+	if (format == Format::XML)
+		buildXML();
+	else
+		buildINI();
+	std::sort(entries.begin(), entries.end(), [&](const Entry& a, const Entry& b) {
+		return nameOf(a) < nameOf(b);
+	});
+}
+
+void DataIndex::buildXML() {
+	const string_view file(data, dataSize);
+	size_t pos = 0;
+	while ((pos = file.find('<', pos)) != string_view::npos) {
+		size_t begin = pos++;
+		string_view tag;
+		for (auto t : {"machine ", "game "}) {
+			if (file.compare(pos, std::strlen(t), t) == 0) {
+				tag = string_view(t, std::strlen(t) - 1);
+				break;
+			}
+		}
+		if (tag.empty())
+			continue;
+
+		size_t close = file.find('>', pos);
+		if (close == string_view::npos)
+			break;
+		size_t end = close + 1;
+		// Not self closed, look for the closing tag.
+		if (file[close - 1] != '/') {
+			end = file.find(string("</").append(tag).append(">"), close);
+			end = end == string_view::npos ? dataSize : end + tag.size() + 3;
+		}
+
+		string_view head(file.substr(pos, close - pos));
+		size_t n = head.find(" name=\"");
+		if (n != string_view::npos) {
+			n += 7;
+			size_t q = head.find('"', n);
+			if (q != string_view::npos)
+				add(head.substr(n, q - n), begin, end);
+		}
+		pos = end;
+	}
+}
+
+void DataIndex::buildINI() {
+	const string_view file(data, dataSize);
+	size_t pos = 0;
+	string_view name;
+	size_t begin = 0;
+	while (pos < dataSize) {
+		size_t eol = file.find('\n', pos);
+		if (eol == string_view::npos)
+			eol = dataSize;
+		if (file[pos] == '[') {
+			if (not name.empty())
+				add(name, begin, pos);
+			size_t close = file.find(']', pos);
+			name  = close < eol ? file.substr(pos + 1, close - pos - 1) : string_view();
+			begin = eol < dataSize ? eol + 1 : dataSize;
+		}
+		pos = eol + 1;
+	}
+	if (not name.empty())
+		add(name, begin, dataSize);
+}
+
+void DataIndex::add(string_view name, size_t begin, size_t end) {
+	entries.push_back({
+		static_cast<uint32_t>(names.size()),
+		static_cast<uint32_t>(name.size()),
+		begin,
+		end
+	});
+	names.append(name);
+}
+
+string_view DataIndex::nameOf(const Entry& entry) const {
+	return string_view(names).substr(entry.name, entry.nameSize);
+}
+
+bool DataIndex::loadCache() {
+	std::ifstream file(fileName + INDEX_EXTENSION, std::ios::binary);
+	if (not file)
+		return false;
+
+	char magic[sizeof(INDEX_MAGIC)];
+	int64_t  cacheTime;
+	uint64_t cacheSize, count, namesSize;
+	file.read(magic, sizeof(magic));
+	file.read(reinterpret_cast<char*>(&cacheTime), sizeof(cacheTime));
+	file.read(reinterpret_cast<char*>(&cacheSize), sizeof(cacheSize));
+	file.read(reinterpret_cast<char*>(&count),     sizeof(count));
+	file.read(reinterpret_cast<char*>(&namesSize), sizeof(namesSize));
+	if (
+		not file or
+		std::memcmp(magic, INDEX_MAGIC, sizeof(magic)) or
+		cacheTime != mtime or
+		cacheSize != dataSize or
+		count > dataSize or
+		namesSize > dataSize
+	)
+		return false;
+
+	entries.resize(count);
+	names.resize(namesSize);
+	file.read(reinterpret_cast<char*>(entries.data()), count * sizeof(Entry));
+	file.read(names.data(), namesSize);
+	if (not file) {
+		entries.clear();
+		names.clear();
+		return false;
+	}
+	for (const auto& e : entries) {
+		// Compared apart, the 32 bits sum can wrap.
+		if (e.name > namesSize or e.nameSize > namesSize - e.name or e.begin > e.end or e.end > dataSize) {
+			entries.clear();
+			names.clear();
+			return false;
+		}
+	}
+	return true;
+}
+
+void DataIndex::saveCache() const {
+	// Write aside and rename, so a reader never sees half a cache.
+	string tmp(fileName + INDEX_EXTENSION ".tmp");
+	std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+	if (not file)
+		return;
+
+	uint64_t
+		size      = dataSize,
+		count     = entries.size(),
+		namesSize = names.size();
+	file.write(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+	file.write(reinterpret_cast<const char*>(&mtime),     sizeof(mtime));
+	file.write(reinterpret_cast<const char*>(&size),      sizeof(size));
+	file.write(reinterpret_cast<const char*>(&count),     sizeof(count));
+	file.write(reinterpret_cast<const char*>(&namesSize), sizeof(namesSize));
+	file.write(reinterpret_cast<const char*>(entries.data()), count * sizeof(Entry));
+	file.write(names.data(), namesSize);
+	file.close();
+	if (file)
+		std::rename(tmp.c_str(), (fileName + INDEX_EXTENSION).c_str());
+	else
+		std::remove(tmp.c_str());
+}
@@ -0,0 +1,161 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DataIndex.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Message.hpp"
+
+#include <string_view>
+using std::string_view;
+
+#ifndef DATAINDEX_HPP_
+#define DATAINDEX_HPP_ 1
+
+/// Extension for the index cache, stored next to the indexed file.
+#define INDEX_EXTENSION ".idx"
+
+namespace LEDSpicerUI {
+
+using Ui::Message;
+
+/**
+ * LEDSpicerUI::DataIndex
+ * Maps a large game data file in memory and keeps the position of every game inside it.
+ * The file is scanned once and the index is cached next to it, the cache is discarded when the file changes.
+ * Only the entry of the requested game is parsed.
+ */
+class DataIndex {
+
+public:
+
+	enum class Format : uint8_t {
+		/// Games are <machine name=""> or <game name=""> nodes.
+		XML,
+		/// Games are [name] sections.
+		INI
+	};
+
+	/**
+	 * Maps the file and loads or builds its index.
+	 * @param fileName
+	 * @param format
+	 * @throws Message if the file cannot be read.
+	 */
+	DataIndex(const string& fileName, Format format);
+
+	DataIndex(const DataIndex&) = delete;
+
+	DataIndex& operator=(const DataIndex&) = delete;
+
+	virtual ~DataIndex();
+
+	/**
+	 * @param name the game name.
+	 * @return the raw text of the game entry, empty if not found.
+	 */
+	string_view find(const string& name) const;
+
+	/**
+	 * @return the number of indexed games.
+	 */
+	size_t size() const;
+
+	/**
+	 * @return every game name, sorted.
+	 */
+	vector<string> getNames() const;
+
+	/**
+	 * @return true if the index was read from the cache.
+	 */
+	bool isCached() const;
+
+protected:
+
+	/**
+	 * Position of a game.
+	 */
+	struct Entry {
+		/// Name position inside names.
+		uint32_t name;
+		uint32_t nameSize;
+		/// Entry position inside the file.
+		uint64_t begin;
+		uint64_t end;
+	};
+
+	const string fileName;
+
+	const Format format;
+
+	/// Mapped file.
+	const char* data = nullptr;
+
+	size_t dataSize = 0;
+
+	/// File modification time, the cache key.
+	int64_t mtime = 0;
+
+	/// Entries sorted by name.
+	vector<Entry> entries;
+
+	/// All names together.
+	string names;
+
+	bool cached = false;
+
+	/**
+	 * Scans the whole file.
+	 */
+	void build();
+
+	void buildXML();
+
+	void buildINI();
+
+	/**
+	 * Adds an entry.
+	 * @param name
+	 * @param begin
+	 * @param end
+	 */
+	void add(string_view name, size_t begin, size_t end);
+
+	/**
+	 * @return true if the cache exists and matches the file.
+	 */
+	bool loadCache();
+
+	/**
+	 * Stores the cache, read only directories are ignored.
+	 */
+	void saveCache() const;
+
+	/**
+	 * @param entry
+	 * @return the entry name.
+	 */
+	string_view nameOf(const Entry& entry) const;
+};
+
+} /* namespace */
+
+#endif /* DATAINDEX_HPP_ */
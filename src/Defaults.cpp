@@ -21,34 +21,17 @@
  */
 
 #include "Defaults.hpp"
+#include "ColorKernels.hpp"
+#include "Message.hpp"
 
 using namespace LEDSpicerUI;
 
 bool Defaults::dirty = false;
+sigc::signal<void> Defaults::changed;
 string Defaults::tabs;
 Gtk::HeaderBar* Defaults::header = nullptr;
 Gtk::Button* Defaults::btnSave   = nullptr;
-
-const unordered_map<string, Defaults::DeviceInfo> Defaults::devicesInfo = {
-//  ID                   NAME                            MaxI B/W    varia MaxPin Connection        Description
-	{"UltimarcUltimate", {"Ultimarc Ipac Ultimate IO",     4, false, false, 96, Connection::USB,    ""}},
-	{"UltimarcPacLed64", {"Ultimarc PacLed 64",            4, false, false, 64, Connection::USB,    ""}},
-	{"UltimarcPacDrive", {"Ultimarc Pac Drive",            4, true,  false, 16, Connection::USB,    ""}},
-	{"UltimarcNanoLed",  {"Ultimarc NanoLed",              4, false, true,  60, Connection::USB,    ""}},
-	{"LedWiz32",         {"Groovy Game Gear Led-Wiz 32",  16, false, false, 32, Connection::USB,    ""}},
-	{"Howler",           {"Wolfware Howler",               4, false, false, 96, Connection::USB,    ""}},
-	{"Adalight",         {"Adalight Compatible",         127, false, true,  60, Connection::SERIAL, ""}},
-	{"RaspberryPi",      {"Raspberry Pi GPIO",             1, false, false, 28, Connection::NONE,   ""}},
-};
-
-const unordered_map<string, Defaults::RestrictorInfo> Defaults::restrictorsInfo = {
-//  ID               NAME                              MaxId Connection         Is  ways
-	{"UltraStik360", {"Ultimarc UltraStik360",            4, Connection::USB,    1, {Ways::w2, Ways::w2v, Ways::w4, Ways::w4x, Ways::w8, Ways::w16, Ways::w49, Ways::analog, Ways::mouse},    "Logical restrictor, it allows mechanical attachments"}},
-	{"ServoStik",    {"Ultimarc ServoStik",               4, Connection::USB,    2, {Ways::w4, Ways::w8},                                                                                     "Mechanical restrictor, it supports two non independent mechanism"}},
-	{"GPWiz40RotoX", {"Groovy Game Gear GPWiz40 RotoX",   4, Connection::USB,    2, {Ways::rotary8, Ways::rotary12},                                                                          "Mechanical rotator"}},
-	{"GPWiz49",      {"Groovy Game Gear GPWiz49",         4, Connection::USB,    1, {Ways::w2, Ways::w2v, Ways::w4, Ways::w4x, Ways::w8, Ways::w16, Ways::w49, Ways::analog, Ways::mouse},    "Logical restrictor"}},
-	{"TOS428",       {"TOS GRS Gate Restrictor",        127, Connection::SERIAL, 4, {Ways::w4, Ways::w8},                                                                                     "Mechanical rotator, supports up to four independent mechanisms"}}
-};
+unordered_map<string, Defaults::HardwareKey> Defaults::portNumbers;
 
 const vector<Defaults::Ways> Defaults::allWays{Ways::w2, Ways::w2v, Ways::w4, Ways::w4x, Ways::w8, Ways::w16, Ways::w49, Ways::analog, Ways::mouse, Ways::rotary8, Ways::rotary12};
 
@@ -79,42 +62,95 @@ const vector<string> Defaults::elementTypes{
 	"misc"
 };
 
+const vector<string> Defaults::actorTypes{
+	"Filler",
+	"Gradient",
+	"Pulse",
+	"Random",
+	"Serpentine",
+	"FileReader"
+};
+
+Defaults::DeviceType Defaults::getDeviceType(const string& name) {
+	for (uint8_t c = 0; c < devicesInfo.size(); ++c)
+		if (name == devicesInfo[c].id)
+			return static_cast<DeviceType>(c);
+	return DeviceType::invalid;
+}
+
+Defaults::RestrictorType Defaults::getRestrictorType(const string& name) {
+	for (uint8_t c = 0; c < restrictorsInfo.size(); ++c)
+		if (name == restrictorsInfo[c].id)
+			return static_cast<RestrictorType>(c);
+	return RestrictorType::invalid;
+}
+
 // This can be wrong if a weird device came in, but at this moment only USB is ID user.
-bool Defaults::isIdUser(const string& name, bool isDevice) {
-	if (isDevice)
-		return (devicesInfo.at(name).connection == Connection::USB);
-	else
-		return (restrictorsInfo.at(name).connection == Connection::USB);
+bool Defaults::isIdUser(DeviceType type) {
+	return (getInfo(type).connection == Connection::USB);
 }
 
-bool Defaults::isMonocrome(const string& name) {
-	return (devicesInfo.at(name).monochrome);
+bool Defaults::isIdUser(RestrictorType type) {
+	return (getInfo(type).connection == Connection::USB);
 }
 
-bool Defaults::isVariable(const string& name) {
-	return (devicesInfo.at(name).variable);
+bool Defaults::isMonocrome(DeviceType type) {
+	return (getInfo(type).monochrome);
 }
 
-bool Defaults::isSerial(const string& name, bool isDevice) {
-	if (isDevice)
-		return (devicesInfo.at(name).connection == Connection::SERIAL);
-	else
-		return (restrictorsInfo.at(name).connection == Connection::SERIAL);
+bool Defaults::isVariable(DeviceType type) {
+	return (getInfo(type).variable);
 }
 
-bool Defaults::isMulti(const string& name) {
-	return (restrictorsInfo.at(name).interfaces > 1);
+bool Defaults::isSerial(DeviceType type) {
+	return (getInfo(type).connection == Connection::SERIAL);
 }
 
-string Defaults::createHardwareUniqueId(const unordered_map<string, string>& data, bool isDevice) {
-	string name(data.at(NAME));
-	if (Defaults::isIdUser(name, isDevice)) {
-		return (name + FIELD_SEPARATOR + data.at(ID));
-	}
-	if (Defaults::isSerial(name, isDevice)) {
-		return (name + FIELD_SEPARATOR + data.at(PORT));
-	}
-	return name;
+bool Defaults::isSerial(RestrictorType type) {
+	return (getInfo(type).connection == Connection::SERIAL);
+}
+
+bool Defaults::isMulti(RestrictorType type) {
+	return (getInfo(type).interfaces > 1);
+}
+
+bool Defaults::hasWay(RestrictorType type, Ways way) {
+	return (getInfo(type).ways & waysMask(way));
+}
+
+string Defaults::createHardwareUniqueId(DeviceType type, const string& id, const string& port) {
+	if (isIdUser(type))
+		return (string(getInfo(type).id) + FIELD_SEPARATOR + (id.empty() ? "1" : id));
+	if (isSerial(type))
+		return (string(getInfo(type).id) + FIELD_SEPARATOR + port);
+	return getInfo(type).id;
+}
+
+string Defaults::createHardwareUniqueId(RestrictorType type, const string& id, const string& port) {
+	if (isIdUser(type))
+		return (string(getInfo(type).id) + FIELD_SEPARATOR + (id.empty() ? "1" : id));
+	if (isSerial(type))
+		return (string(getInfo(type).id) + FIELD_SEPARATOR + port);
+	return getInfo(type).id;
+}
+
+Defaults::HardwareKey Defaults::createHardwareKey(DeviceType type, const string& id, const string& port) {
+	return packHardwareKey(false, static_cast<uint8_t>(type), getInfo(type).connection, id, port);
+}
+
+Defaults::HardwareKey Defaults::createHardwareKey(RestrictorType type, const string& id, const string& port) {
+	return packHardwareKey(true, static_cast<uint8_t>(type), getInfo(type).connection, id, port);
+}
+
+Defaults::HardwareKey Defaults::packHardwareKey(bool isRestrictor, uint8_t type, Connection connection, const string& id, const string& port) {
+	constexpr HardwareKey valueMask = (static_cast<HardwareKey>(1) << 56) - 1;
+	HardwareKey key = (static_cast<HardwareKey>(isRestrictor) << 63) | (static_cast<HardwareKey>(type & 0x7F) << 56);
+	// USB hardware uses the ID, a missing ID is 1 as in the unique ID, serial hardware uses the port, anything else is unique by type.
+	if (connection == Connection::USB)
+		key |= (id.empty() ? 1 : (isNumber(id) and id.size() < 17 ? std::stoull(id) : 0)) & valueMask;
+	else if (connection == Connection::SERIAL)
+		key |= portNumbers.emplace(port, portNumbers.size()).first->second & valueMask;
+	return key;
 }
 
 string Defaults::createCommonUniqueId(const vector<string>& fieldsData) {
@@ -145,11 +181,7 @@ string Defaults::addUnitSeparator(const string& unit) {
 }
 
 double Defaults::getLiminance(const string& color) {
-	Gdk::Color c("#" + color);
-	double r = c.get_red_p()   * 255;
-	double g = c.get_green_p() * 255;
-	double b = c.get_blue_p()  * 255;
-	return (0.299 * r + 0.587 * g + 0.114 * b) / 255;
+	return ColorKernels::luminance(color);
 }
 
 vector<string> Defaults::explode(const string& text, const char delimiter, const size_t limit) {
@@ -198,6 +230,72 @@ string Defaults::implode(const vector<string>& values, const string& delimiter)
 	return r;
 }
 
+vector<string> Defaults::expandPattern(const string& pattern, size_t limit) {
+	if (not limit)
+		return {};
+	vector<string> results{""};
+	size_t position = 0;
+	while (position < pattern.size()) {
+		size_t
+			open  = pattern.find('{', position),
+			close = open == string::npos ? string::npos : pattern.find('}', open);
+		if (close == string::npos) {
+			for (auto& result : results)
+				result += pattern.substr(position);
+			break;
+		}
+
+		const string inside(pattern.substr(open + 1, close - open - 1));
+		vector<string> options;
+		size_t dots = inside.find("..");
+		if (dots != string::npos) {
+			const string
+				from(inside.substr(0, dots)),
+				to(inside.substr(dots + 2));
+			if (not from.empty() and not to.empty() and isNumber(from) and isNumber(to)) {
+				// Up to 9 digits fits an int, anything longer is always more than the limit.
+				if (from.size() > 9 or to.size() > 9)
+					throw Ui::Message("The range {" + inside + "} expands to more than " + std::to_string(limit) + " names");
+				int
+					first = std::stoi(from),
+					last  = std::stoi(to),
+					step  = first <= last ? 1 : -1;
+				if (static_cast<size_t>(step * (last - first)) >= limit)
+					throw Ui::Message("The range {" + inside + "} expands to more than " + std::to_string(limit) + " names");
+				// A leading zero keeps the width, {01..10} is 01 02 ... 10.
+				const size_t width = (from.size() > 1 and from[0] == '0') or (to.size() > 1 and to[0] == '0') ?
+					std::max(from.size(), to.size()) : 0;
+				for (int c = first; ; c += step) {
+					string number(std::to_string(c));
+					if (number.size() < width)
+						number.insert(0, width - number.size(), '0');
+					options.push_back(std::move(number));
+					if (c == last)
+						break;
+				}
+			}
+		}
+		else if (inside.find(',') != string::npos) {
+			options = explode(inside, ',');
+		}
+		// Not a pattern, keep it.
+		if (options.empty())
+			options.push_back('{' + inside + '}');
+
+		if (results.size() * options.size() > limit)
+			throw Ui::Message("The pattern " + pattern + " expands to more than " + std::to_string(limit) + " names");
+		const string literal(pattern.substr(position, open - position));
+		vector<string> expanded;
+		expanded.reserve(results.size() * options.size());
+		for (const auto& result : results)
+			for (const auto& option : options)
+				expanded.push_back(result + literal + option);
+		results.swap(expanded);
+		position = close + 1;
+	}
+	return results;
+}
+
 void Defaults::ltrim(string& text) {
 	size_t chars = 0;
 	for (size_t c = 0; c < text.size(); c++) {
@@ -255,6 +353,7 @@ void Defaults::registerWidget(Gtk::ToggleButton* widget) {
 
 void Defaults::markDirty() {
 	dirty = true;
+	changed.emit();
 	auto t(header->get_title());
 	if (t.size() and t[0] == '*')
 		return;
@@ -262,6 +361,10 @@ void Defaults::markDirty() {
 	btnSave->set_sensitive(true);
 }
 
+sigc::signal<void>& Defaults::signalChanged() {
+	return changed;
+}
+
 bool Defaults::isDirty() {
 	return dirty;
 }
@@ -28,6 +28,10 @@ using std::unordered_map;
 #include <vector>
 using std::vector;
 
+#include <array>
+
+#include <algorithm>
+
 #include <string>
 using std::string;
 
@@ -43,6 +47,10 @@ using std::string;
 #define CONFIG_FILE "/ledspicer.conf"
 #define XML_FILE_FOREIGN ""
 
+// Inflate limits, deflate cannot go over 1032:1 and no data file comes close to the size.
+#define MAX_DEFLATE_RATIO 1032
+#define MAX_INFLATED_SIZE (static_cast<size_t>(256) * 1024 * 1024)
+
 #define DEFAULT_MESSAGE "This is an auto-generated file by " PACKAGE_STRING "."
 
 // Separators.
@@ -120,8 +128,14 @@ using std::string;
 #define TYPE                 "type"
 #define COLOR                "color"
 #define FILTER               "filter"
+#define BLINK                "blink"
+#define TIMES                "times"
+#define SPEED                "speed"
+#define LISTEN_EVENTS        "listenEvents"
 #define ELEMENT              "Element"
 #define GROUP                "Group"
+#define ACTOR                "actor"
+#define ACTOR_TARGET         "group"
 
 #define IMPORT_CONFIG      1
 #define IMPORT_DEVICES     2
@@ -158,11 +172,36 @@ public:
 
 	enum class Connection : uint8_t {NONE, USB, SERIAL};
 
+	/// LED devices, the value is the position inside devicesInfo.
+	enum class DeviceType : uint8_t {
+		UltimarcUltimate,
+		UltimarcPacLed64,
+		UltimarcPacDrive,
+		UltimarcNanoLed,
+		LedWiz32,
+		Howler,
+		Adalight,
+		RaspberryPi,
+		invalid
+	};
+
+	/// Restrictors and rotators, the value is the position inside restrictorsInfo.
+	enum class RestrictorType : uint8_t {
+		UltraStik360,
+		ServoStik,
+		GPWiz40RotoX,
+		GPWiz49,
+		TOS428,
+		invalid
+	};
+
 	/**
 	 * Structure with LED devices information.
 	 */
 	struct DeviceInfo {
-		const string     name;
+		/// The name used in the configuration file.
+		const char*      id;
+		const char*      name;
 		/// Max number of devices that can be connected at the same time.
 		const uint8_t    maxIds;
 		/// Some devices only support ON/OFF
@@ -173,74 +212,155 @@ public:
 		const uint8_t    pins;
 		/// What connection uses.
 		const Connection connection;
+		/// Bits sent for every pin on each frame.
+		const uint8_t    bitsPerPin;
+		/// Payload bytes per USB transfer, 0 for streamed connections.
+		const uint8_t    packetSize;
+		/// Fixed bytes sent on each frame, like headers or commands.
+		const uint8_t    frameHeader;
 		/// A breaf description of the device.
-		const string     breaf;
+		const char*      breaf;
 	};
 
 	/**
 	 * Structure with restrictors and rotators information.
 	 */
 	struct RestrictorInfo {
-		const string       name;
+		/// The name used in the configuration file.
+		const char*      id;
+		const char*      name;
 		/// Max number of devices that can be connected at the same time.
-		const uint8_t      maxIds;
+		const uint8_t    maxIds;
 		/// What connection uses.
-		const Connection   connection;
+		const Connection connection;
 		/// The number of individual interfaces that this controller handles.
-		const uint8_t      interfaces;
-		/// Supported restrictions.
-		const vector<Ways> ways;
+		const uint8_t    interfaces;
+		/// Supported restrictions, one bit per Ways.
+		const uint16_t   ways;
 		/// A breaf description of the restrictor.
-		const string       breaf;
+		const char*      breaf;
 	};
 
+	/**
+	 * Hardware unique key, packed as:
+	 * bit 63 restrictor flag, bits 56 to 62 the hardware type, bits 0 to 55 the ID or the port number.
+	 */
+	using HardwareKey = uint64_t;
+
 	Defaults() = delete;
 	
 	virtual ~Defaults() = default;
 
 	/**
-	 * To be use with devices and restrictors.
+	 * Converts a device name into its type, to be done once per record.
 	 * @param name
-	 * @param isDevice true for devices (default), false for restrictors
-	 * @return true if the device uses IDs.
+	 * @return the device type or DeviceType::invalid if unknown.
 	 */
-	static bool isIdUser(const string& name, bool isDevice = true);
+	static DeviceType getDeviceType(const string& name);
 
 	/**
-	 * Devices only.
+	 * Converts a restrictor name into its type, to be done once per record.
 	 * @param name
+	 * @return the restrictor type or RestrictorType::invalid if unknown.
+	 */
+	static RestrictorType getRestrictorType(const string& name);
+
+	/**
+	 * @param type
+	 * @return the device information, an empty one for invalid types.
+	 */
+	static constexpr const DeviceInfo& getInfo(DeviceType type) {
+		return static_cast<uint8_t>(type) < devicesInfo.size() ? devicesInfo[static_cast<uint8_t>(type)] : unknownDeviceInfo;
+	}
+
+	/**
+	 * @param type
+	 * @return the restrictor information, an empty one for invalid types.
+	 */
+	static constexpr const RestrictorInfo& getInfo(RestrictorType type) {
+		return static_cast<uint8_t>(type) < restrictorsInfo.size() ? restrictorsInfo[static_cast<uint8_t>(type)] : unknownRestrictorInfo;
+	}
+
+	/**
+	 * @param type
+	 * @return true if the device uses IDs.
+	 */
+	static bool isIdUser(DeviceType type);
+
+	/**
+	 * @param type
+	 * @return true if the restrictor uses IDs.
+	 */
+	static bool isIdUser(RestrictorType type);
+
+	/**
+	 * @param type
 	 * @return true if the device is multiple and monochrome.
 	 */
-	static bool isMonocrome(const string& name);
+	static bool isMonocrome(DeviceType type);
 
 	/**
-	 * Devices only.
-	 * @param name
+	 * @param type
 	 * @return true if the device can have a variable number of LEDS.
 	 */
-	static bool isVariable(const string& name);
+	static bool isVariable(DeviceType type);
 
 	/**
-	 * Devices and Restrictors.
-	 * @param name
-	 * @param isDevice true for devices (default), false for restrictors
+	 * @param type
 	 * @return true if the device is a serial connected device.
 	 */
-	static bool isSerial(const string& name, bool isDevice = true);
+	static bool isSerial(DeviceType type);
 
 	/**
-	 * Restrictors only.
-	 * @param name
+	 * @param type
+	 * @return true if the restrictor is a serial connected device.
+	 */
+	static bool isSerial(RestrictorType type);
+
+	/**
+	 * @param type
 	 * @return if the hardware have more than one end-point.
 	 */
-	static bool isMulti(const string& name);
+	static bool isMulti(RestrictorType type);
 
 	/**
-	 * Common hardware unique ID generator.
-	 * @param fieldsData
+	 * @param type
+	 * @param way
+	 * @return true if the restrictor supports that way.
+	 */
+	static bool hasWay(RestrictorType type, Ways way);
+
+	/**
+	 * Creates the bits used by RestrictorInfo::ways.
+	 * @param ways
+	 * @return
+	 */
+	template <typename... W>
+	static constexpr uint16_t waysMask(W... ways) {
+		return ((1 << static_cast<uint8_t>(ways)) | ...);
+	}
+
+	/**
+	 * Common hardware unique ID generator, used to link hardware with its children.
+	 * @param type
+	 * @param id
+	 * @param port
 	 * @return
 	 */
-	static string createHardwareUniqueId(const unordered_map<string, string>& fieldsData, bool isDevice = true);
+	static string createHardwareUniqueId(DeviceType type, const string& id, const string& port);
+
+	static string createHardwareUniqueId(RestrictorType type, const string& id, const string& port);
+
+	/**
+	 * Common hardware unique key generator, used to check uniqueness.
+	 * @param type
+	 * @param id
+	 * @param port
+	 * @return
+	 */
+	static HardwareKey createHardwareKey(DeviceType type, const string& id, const string& port);
+
+	static HardwareKey createHardwareKey(RestrictorType type, const string& id, const string& port);
 
 	/**
 	 * For most data fields that uses one or more strings this will just work.
@@ -297,6 +417,16 @@ public:
 
 	static string implode(const vector<string>& values, const char& delimiter);
 
+	/**
+	 * Expands a name pattern, {1..8} is a range of numbers and {A,B} a list, P{1..2}_{A,B} is P1_A P1_B P2_A P2_B.
+	 * Braces that are not a range or a list are kept, a range with leading zeros keeps its width, {01..10} is 01 02 ... 10.
+	 * @param pattern
+	 * @param limit maximum number of results, zero returns none.
+	 * @return
+	 * @throws Message when the pattern expands to more than limit names.
+	 */
+	static vector<string> expandPattern(const string& pattern, size_t limit);
+
 	/**
 	 * Removes spaces from the left
 	 * @param text
@@ -332,11 +462,17 @@ public:
 	/// A list of all posible restrictors and rotators Ways (positions).
 	static const vector<Ways> allWays;
 
-	/// A list of device to their information.
-	static const unordered_map<string, DeviceInfo> devicesInfo;
+	/// A list of device to their information, indexed by DeviceType.
+	static const std::array<DeviceInfo, static_cast<uint8_t>(DeviceType::invalid)> devicesInfo;
 
-	/// A list of restrictor to their information.
-	static const unordered_map<string, RestrictorInfo> restrictorsInfo;
+	/// A list of restrictor to their information, indexed by RestrictorType.
+	static const std::array<RestrictorInfo, static_cast<uint8_t>(RestrictorType::invalid)> restrictorsInfo;
+
+	/// Information of DeviceType::invalid, a device without pins nor connection.
+	static const DeviceInfo unknownDeviceInfo;
+
+	/// Information of RestrictorType::invalid, a restrictor without interfaces nor connection.
+	static const RestrictorInfo unknownRestrictorInfo;
 
 	/// A List of string names to its internal enumerated type.
 	static const unordered_map<string, Ways> wayIds;
@@ -344,6 +480,57 @@ public:
 	/// A list of different element types.
 	static const vector<string> elementTypes;
 
+	/// A list of the animation actor types.
+	static const vector<string> actorTypes;
+
+	/**
+	 * @name Attributes order
+	 * Attributes written for every XML node, in the order they are written.
+	 * Anything not listed here is not saved.
+	 * @{
+	 */
+
+	/// Main configuration node attributes.
+	static constexpr std::array<const char*, 12> configurationAttributes{
+		"version", "type", "colors", "fps", "port", "userId", "groupId", "logLevel", "dataSource", "randomColors", "colorsFile", "craftProfile"
+	};
+
+	/// Device node attributes.
+	static constexpr std::array<const char*, 5> deviceAttributes{NAME, ID, PORT, PINS, CHANGE_POINT};
+
+	/// Element node attributes.
+	static constexpr std::array<const char*, 9> elementAttributes{
+		NAME, PIN, SOLENOID, RED_PIN, GREEN_PIN, BLUE_PIN, TIME_ON, DEFAULT_COLOR, TYPE
+	};
+
+	/// Group node attributes.
+	static constexpr std::array<const char*, 2> groupAttributes{NAME, DEFAULT_COLOR};
+
+	/// Restrictor node attributes.
+	static constexpr std::array<const char*, 8> restrictorAttributes{
+		NAME, ID, PORT, US360_HAS_RESTRICTOR, US360_USE_MOUSE, GZ49_WILLIAMS, GZ40_SPEED_ON, GZ40_SPEED_OFF
+	};
+
+	/// Restrictor map node attributes.
+	static constexpr std::array<const char*, 3> restrictorMapAttributes{PLAYER, JOYSTICK, RESTRICTOR_INTERFACE};
+
+	/// Process lookup map node attributes.
+	static constexpr std::array<const char*, 3> processLookupAttributes{PARAM_PROCESS_NAME, PARAM_SYSTEM, PARAM_PROCESS_POS};
+
+	/// Input root node attributes, the filename is not data.
+	static constexpr std::array<const char*, 6> inputAttributes{NAME, SPEED, TIMES, BLINK, LISTEN_EVENTS, LINKED_ITEMS};
+
+	/// Input map node attributes.
+	static constexpr std::array<const char*, 5> inputMapAttributes{TRIGGER, TYPE, TARGET, COLOR, FILTER};
+
+	/// Profile root node attributes, the filename is not data.
+	static constexpr std::array<const char*, 1> profileAttributes{BACKGROUND_COLOR};
+
+	/// Selected items (elements, groups, inputs, animations) attributes.
+	static constexpr std::array<const char*, 2> selectedAttributes{NAME, COLOR};
+
+	/** @} */
+
 	/**
 	 * Set a new subtitle.
 	 * @param text
@@ -379,6 +566,11 @@ public:
 	 */
 	static void markDirty();
 
+	/**
+	 * @return a signal emitted every time the project data changes.
+	 */
+	static sigc::signal<void>& signalChanged();
+
 	/**
 	 * Check for dirty state
 	 * @return true if dirty
@@ -448,12 +640,54 @@ protected:
 	/// Dirty Flag
 	static bool dirty;
 
+	/// Emitted by markDirty.
+	static sigc::signal<void> changed;
+
 	/// Pointer to the header.
 	static Gtk::HeaderBar* header;
 
 	static Gtk::Button* btnSave;
+
+	/// Serial ports seen by the hardware keys, numbered in order of appearance, so two ports never share a key.
+	static unordered_map<string, HardwareKey> portNumbers;
+
+	/**
+	 * Packs a hardware key.
+	 * @param isRestrictor
+	 * @param type
+	 * @param connection
+	 * @param id
+	 * @param port
+	 * @return
+	 */
+	static HardwareKey packHardwareKey(bool isRestrictor, uint8_t type, Connection connection, const string& id, const string& port);
 };
 
+inline constexpr std::array<Defaults::DeviceInfo, static_cast<uint8_t>(Defaults::DeviceType::invalid)> Defaults::devicesInfo {{
+//   ID                  NAME                          MaxI B/W    varia MaxPin Connection      Bits Packet Header Description
+	{"UltimarcUltimate", "Ultimarc Ipac Ultimate IO",     4, false, false, 96, Connection::USB,    8, 32, 0, ""},
+	{"UltimarcPacLed64", "Ultimarc PacLed 64",            4, false, false, 64, Connection::USB,    8,  4, 0, ""},
+	{"UltimarcPacDrive", "Ultimarc Pac Drive",            4, true,  false, 16, Connection::USB,    1,  4, 0, ""},
+	{"UltimarcNanoLed",  "Ultimarc NanoLed",              4, false, true,  60, Connection::USB,    8,  4, 0, ""},
+	{"LedWiz32",         "Groovy Game Gear Led-Wiz 32",  16, false, false, 32, Connection::USB,    8,  8, 8, ""},
+	{"Howler",           "Wolfware Howler",               4, false, false, 96, Connection::USB,    8, 24, 0, ""},
+	{"Adalight",         "Adalight Compatible",         127, false, true,  60, Connection::SERIAL, 8,  0, 6, ""},
+	{"RaspberryPi",      "Raspberry Pi GPIO",             1, false, false, 28, Connection::NONE,   1,  0, 0, ""},
+}};
+
+inline constexpr std::array<Defaults::RestrictorInfo, static_cast<uint8_t>(Defaults::RestrictorType::invalid)> Defaults::restrictorsInfo {{
+//   ID              NAME                              MaxId Connection         Is  ways
+	{"UltraStik360", "Ultimarc UltraStik360",            4, Connection::USB,    1, waysMask(Ways::w2, Ways::w2v, Ways::w4, Ways::w4x, Ways::w8, Ways::w16, Ways::w49, Ways::analog, Ways::mouse), "Logical restrictor, it allows mechanical attachments"},
+	{"ServoStik",    "Ultimarc ServoStik",               4, Connection::USB,    2, waysMask(Ways::w4, Ways::w8),                                                                                  "Mechanical restrictor, it supports two non independent mechanism"},
+	{"GPWiz40RotoX", "Groovy Game Gear GPWiz40 RotoX",   4, Connection::USB,    2, waysMask(Ways::rotary8, Ways::rotary12),                                                                       "Mechanical rotator"},
+	{"GPWiz49",      "Groovy Game Gear GPWiz49",         4, Connection::USB,    1, waysMask(Ways::w2, Ways::w2v, Ways::w4, Ways::w4x, Ways::w8, Ways::w16, Ways::w49, Ways::analog, Ways::mouse), "Logical restrictor"},
+	{"TOS428",       "TOS GRS Gate Restrictor",        127, Connection::SERIAL, 4, waysMask(Ways::w4, Ways::w8),                                                                                  "Mechanical rotator, supports up to four independent mechanisms"},
+}};
+
+inline constexpr Defaults::DeviceInfo Defaults::unknownDeviceInfo {"", "Unknown device", 0, false, false, 0, Connection::NONE, 0, 0, 0, ""};
+
+inline constexpr Defaults::RestrictorInfo Defaults::unknownRestrictorInfo {"", "Unknown restrictor", 0, Connection::NONE, 0, 0, ""};
+
 } /* namespace */
 
 #endif /* DEFAULTS_HPP_ */
@@ -0,0 +1,73 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Diagnostics.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Diagnostics.hpp"
+
+using namespace LEDSpicerUI;
+
+string Diagnostics::source;
+vector<Diagnostics::Issue> Diagnostics::issues;
+
+void Diagnostics::setSource(const string& source) {
+	Diagnostics::source = source;
+}
+
+void Diagnostics::warning(const string& message, const string& place, int line) {
+	add(Severity::WARNING, message, place, line);
+}
+
+void Diagnostics::error(const string& message, const string& place, int line) {
+	add(Severity::ERROR, message, place, line);
+}
+
+const vector<Diagnostics::Issue>& Diagnostics::getIssues() {
+	return issues;
+}
+
+size_t Diagnostics::count(Severity severity) {
+	return std::count_if(issues.begin(), issues.end(), [severity](const Issue& issue) {
+		return issue.severity == severity;
+	});
+}
+
+bool Diagnostics::empty() {
+	return issues.empty();
+}
+
+void Diagnostics::clear() {
+	issues.clear();
+	source.clear();
+}
+
+void Diagnostics::clear(const string& source) {
+	issues.erase(std::remove_if(issues.begin(), issues.end(), [&source](const Issue& issue) {
+		return issue.source == source;
+	}), issues.end());
+}
+
+string Diagnostics::toString(Severity severity) {
+	return severity == Severity::ERROR ? "Error" : "Warning";
+}
+
+void Diagnostics::add(Severity severity, const string& message, const string& place, int line) {
+	issues.push_back({severity, source, line, place, message});
+}
@@ -0,0 +1,126 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Diagnostics.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Defaults.hpp"
+
+#ifndef DIAGNOSTICS_HPP_
+#define DIAGNOSTICS_HPP_ 1
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::Diagnostics
+ * Collects the problems found while importing files, so they can be displayed all together at the end.
+ */
+class Diagnostics {
+
+public:
+
+	enum class Severity : uint8_t {WARNING, ERROR};
+
+	/**
+	 * A single problem.
+	 */
+	struct Issue {
+		Severity severity;
+		/// The file where the problem was found.
+		string   source;
+		/// The line inside the file, 0 if unknown.
+		int      line;
+		/// Where inside the project, like the device or group.
+		string   place;
+		string   message;
+	};
+
+	Diagnostics() = delete;
+
+	virtual ~Diagnostics() = default;
+
+	/**
+	 * Sets the file that is been processed, new issues will use it.
+	 * @param source
+	 */
+	static void setSource(const string& source);
+
+	/**
+	 * Adds a warning, something that was ignored or fixed.
+	 * @param message
+	 * @param place
+	 * @param line
+	 */
+	static void warning(const string& message, const string& place = "", int line = 0);
+
+	/**
+	 * Adds an error, something that cannot be used.
+	 * @param message
+	 * @param place
+	 * @param line
+	 */
+	static void error(const string& message, const string& place = "", int line = 0);
+
+	/**
+	 * @return all collected issues, in the order they were found.
+	 */
+	static const vector<Issue>& getIssues();
+
+	/**
+	 * @param severity
+	 * @return the number of issues of that severity.
+	 */
+	static size_t count(Severity severity);
+
+	/**
+	 * @return true if there are no issues.
+	 */
+	static bool empty();
+
+	/**
+	 * Removes all issues and the current source.
+	 */
+	static void clear();
+
+	/**
+	 * Removes the issues of a file, the others are kept.
+	 * @param source
+	 */
+	static void clear(const string& source);
+
+	/**
+	 * @param severity
+	 * @return a readable severity.
+	 */
+	static string toString(Severity severity);
+
+protected:
+
+	/// Current file been processed.
+	static string source;
+
+	/// Collected issues.
+	static vector<Issue> issues;
+
+	static void add(Severity severity, const string& message, const string& place, int line);
+};
+
+} /* namespace */
+
+#endif /* DIAGNOSTICS_HPP_ */
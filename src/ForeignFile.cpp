@@ -0,0 +1,328 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ForeignFile.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ForeignFile.hpp"
+
+using namespace LEDSpicerUI;
+
+const unordered_map<string, vector<string>> ForeignFile::aliases {
+	{NAME,          {"name", "label", "control", "input", "id"}},
+	{PIN,           {"led", "pin", "port", "output", "lednumber", "number"}},
+	{RED_PIN,       {"red", "redpin", "pinr"}},
+	{GREEN_PIN,     {"green", "greenpin", "ping"}},
+	{BLUE_PIN,      {"blue", "bluepin", "pinb"}},
+	{DEFAULT_COLOR, {"defaultcolor", "color", "colour", "rgb", "hex"}}
+};
+
+ForeignFile::ForeignFile(const string& fileName, const string& deviceId, const unordered_map<string, string>& palette) :
+	XMLHelper(),
+	collection(Defaults::createCommonUniqueId({deviceId, COLLECTION_ELEMENT})),
+	palette(palette)
+{
+	Diagnostics::setSource(fileName);
+	if (isColorsFile(fileName)) {
+		readColors(fileName);
+		return;
+	}
+
+	const string extension(fileName.size() > 4 ? fileName.substr(fileName.size() - 4) : "");
+	if (extension == ".xml" or extension == ".XML")
+		readXML(fileName);
+	else
+		readCSV(fileName);
+
+	// One search for every color in the file.
+	quantize(elementColors);
+	auto& elements = extractedData[collection];
+	for (size_t c = 0; c < elements.size(); ++c)
+		if (not elementColors[c].empty())
+			elements[c][DEFAULT_COLOR] = elementColors[c];
+}
+
+bool ForeignFile::isColorsFile(const string& fileName) {
+	return fileName.size() > 4 and normalize(fileName.substr(fileName.size() - 4)) == ".ini";
+}
+
+size_t ForeignFile::getElementsCount() {
+	return extractedData[collection].size();
+}
+
+const unordered_map<string, string>& ForeignFile::getColors() const {
+	return colors;
+}
+
+string ForeignFile::toHex(const string& color) {
+	string value(color);
+	Defaults::trim(value);
+
+	// r,g,b
+	if (value.find(',') != string::npos) {
+		auto parts(Defaults::explode(value, ','));
+		if (parts.size() != 3)
+			return "";
+		char hex[7];
+		uint8_t rgb[3];
+		for (uint8_t c = 0; c < 3; ++c) {
+			Defaults::trim(parts[c]);
+			if (not Defaults::isBetween(parts[c], 0, 255))
+				return "";
+			rgb[c] = std::stoi(parts[c]);
+		}
+		std::snprintf(hex, sizeof(hex), "%02X%02X%02X", rgb[0], rgb[1], rgb[2]);
+		return hex;
+	}
+
+	if (not value.empty() and value[0] == '#')
+		value.erase(0, 1);
+	else if (value.size() > 2 and value[0] == '0' and (value[1] == 'x' or value[1] == 'X'))
+		value.erase(0, 2);
+
+	// RGB to RRGGBB.
+	if (value.size() == 3)
+		value = {value[0], value[0], value[1], value[1], value[2], value[2]};
+
+	if (value.size() != 6)
+		return "";
+	for (char& c : value) {
+		if (not std::isxdigit(static_cast<unsigned char>(c)))
+			return "";
+		c = std::toupper(static_cast<unsigned char>(c));
+	}
+	return value;
+}
+
+string ForeignFile::toName(const string& name) {
+	string r(name);
+	Defaults::trim(r);
+	for (char& c : r)
+		if (not std::isalnum(static_cast<unsigned char>(c)))
+			c = '_';
+	return r;
+}
+
+void ForeignFile::readXML(const string& fileName) {
+	open(fileName, XML_FILE_FOREIGN);
+	if (not root)
+		throw Message("Empty file " + fileName);
+
+	// Any node can be an element, walk them all.
+	vector<tinyxml2::XMLElement*> pending{root};
+	while (not pending.empty()) {
+		tinyxml2::XMLElement* node = pending.back();
+		pending.pop_back();
+		for (auto child = node->LastChildElement(); child; child = child->PreviousSiblingElement())
+			pending.push_back(child);
+
+		unordered_map<string, string> attributes;
+		for (auto& attribute : processNode(node))
+			attributes.emplace(normalize(attribute.first), attribute.second);
+
+		unordered_map<string, string> element;
+		for (auto& alias : aliases) {
+			for (auto& name : alias.second) {
+				auto value(attributes.find(name));
+				if (value != attributes.end()) {
+					element.emplace(alias.first, value->second);
+					break;
+				}
+			}
+		}
+		if (not element.count(NAME))
+			continue;
+		if (not element.count(PIN) and (not element.count(RED_PIN) or not element.count(GREEN_PIN) or not element.count(BLUE_PIN)))
+			continue;
+
+		string color;
+		if (element.count(DEFAULT_COLOR)) {
+			color = element[DEFAULT_COLOR];
+			element.erase(DEFAULT_COLOR);
+		}
+		addElement(element, color, node->GetLineNum());
+	}
+}
+
+void ForeignFile::readCSV(const string& fileName) {
+	std::ifstream file(fileName);
+	if (not file)
+		throw Message("Unable to read the file " + fileName);
+
+	string line;
+	int lineNumber = 0;
+	bool first = true;
+	while (std::getline(file, line)) {
+		++lineNumber;
+		Defaults::trim(line);
+		if (line.empty() or line[0] == '#')
+			continue;
+
+		const char separator(line.find('\t') != string::npos ? '\t' : line.find(';') != string::npos ? ';' : ',');
+		auto fields(Defaults::explode(line, separator));
+		for (auto& field : fields)
+			Defaults::trim(field);
+
+		// A first line with no pin is a header.
+		if (first) {
+			first = false;
+			if (fields.size() > 1 and not Defaults::isBetween(fields[1], 0, INT_MAX))
+				continue;
+		}
+
+		unordered_map<string, string> element{{NAME, fields[0]}};
+		string color;
+		switch (fields.size()) {
+		case 3:
+			color = fields[2];
+			// fall through
+		case 2:
+			element.emplace(PIN, fields[1]);
+			break;
+		case 5:
+			color = fields[4];
+			// fall through
+		case 4:
+			element.emplace(RED_PIN,   fields[1]);
+			element.emplace(GREEN_PIN, fields[2]);
+			element.emplace(BLUE_PIN,  fields[3]);
+			break;
+		default:
+			Diagnostics::warning("Ignored line, expected name,pin[,color] or name,red,green,blue[,color]", "", lineNumber);
+			continue;
+		}
+		addElement(element, color, lineNumber);
+	}
+}
+
+void ForeignFile::readColors(const string& fileName) {
+	std::ifstream file(fileName);
+	if (not file)
+		throw Message("Unable to read the file " + fileName);
+
+	vector<string> names, values;
+	string line;
+	int lineNumber = 0;
+	while (std::getline(file, line)) {
+		++lineNumber;
+		Defaults::trim(line);
+		if (line.empty() or line[0] == '#' or line[0] == ';' or line[0] == '[')
+			continue;
+
+		auto pair(Defaults::explode(line, '=', 2));
+		if (pair.size() != 2) {
+			Diagnostics::warning("Ignored line, expected name=color", "", lineNumber);
+			continue;
+		}
+		Defaults::trim(pair[0]);
+		Defaults::trim(pair[1]);
+		string value(palette.count(pair[1]) ? pair[1] : toHex(pair[1]));
+		if (pair[0].empty() or value.empty()) {
+			Diagnostics::warning("Ignored line, invalid name or color", "", lineNumber);
+			continue;
+		}
+		names.push_back(toName(pair[0]));
+		values.push_back(value);
+	}
+
+	quantize(values);
+	for (size_t c = 0; c < names.size(); ++c)
+		if (not values[c].empty())
+			colors[names[c]] = values[c];
+}
+
+void ForeignFile::addElement(unordered_map<string, string>& element, const string& color, int line) {
+	element[NAME] = toName(element[NAME]);
+	if (element[NAME].empty()) {
+		Diagnostics::error("Ignored element, Missing element name", "", line);
+		return;
+	}
+	for (auto pin : {PIN, RED_PIN, GREEN_PIN, BLUE_PIN}) {
+		auto value(element.find(pin));
+		if (value != element.end() and not Defaults::isBetween(value->second, 0, INT_MAX)) {
+			Diagnostics::error("Ignored element, invalid pin " + value->second + " in element (" + element[NAME] + ")", "", line);
+			return;
+		}
+	}
+	element[TYPE] = Defaults::detectElementType(element[NAME]);
+
+	string foreign;
+	if (not color.empty()) {
+		foreign = palette.count(color) ? color : toHex(color);
+		if (foreign.empty())
+			Diagnostics::warning("Unknown color " + color + " ignored", element[NAME], line);
+	}
+	extractedData[collection].push_back(element);
+	elementColors.push_back(foreign);
+}
+
+void ForeignFile::quantize(vector<string>& foreignColors) const {
+
+	// Palette in name order, so ties always pick the same name.
+	vector<string> names;
+	for (auto& color : palette)
+		if (not toHex(color.second).empty())
+			names.push_back(color.first);
+	std::sort(names.begin(), names.end());
+
+	if (names.empty()) {
+		for (auto& color : foreignColors) {
+			if (not color.empty()) {
+				Diagnostics::warning("No colors file selected, colors were ignored");
+				break;
+			}
+		}
+		foreignColors.assign(foreignColors.size(), "");
+		return;
+	}
+	if (names.size() > 256) {
+		Diagnostics::warning("Only the first 256 colors of the palette are used");
+		names.resize(256);
+	}
+
+	ColorKernels::Buffer paletteBuffer(names.size());
+	for (size_t c = 0; c < names.size(); ++c)
+		paletteBuffer.set(c, toHex(palette.at(names[c])));
+
+	// Every different foreign color is searched once.
+	unordered_map<string, size_t> unique;
+	for (auto& color : foreignColors)
+		if (not color.empty() and not palette.count(color))
+			unique.emplace(color, unique.size());
+
+	ColorKernels::Buffer foreignBuffer(unique.size());
+	for (auto& color : unique)
+		foreignBuffer.set(color.second, color.first);
+
+	vector<uint8_t> indexes;
+	ColorKernels::nearest(foreignBuffer, paletteBuffer, indexes);
+
+	for (auto& color : foreignColors)
+		if (not color.empty() and not palette.count(color))
+			color = names[indexes[unique.at(color)]];
+}
+
+string ForeignFile::normalize(const string& attribute) {
+	string r;
+	for (char c : attribute)
+		if (c != '_' and c != '-' and c != ' ')
+			r += std::tolower(static_cast<unsigned char>(c));
+	return r;
+}
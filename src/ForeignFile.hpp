@@ -0,0 +1,137 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ForeignFile.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <fstream>
+#include <climits>
+
+#include "XMLHelper.hpp"
+#include "ColorKernels.hpp"
+
+#ifndef FOREIGNFILE_HPP_
+#define FOREIGNFILE_HPP_ 1
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::ForeignFile
+ * Reads layouts and colors made by other LED programs.
+ *
+ * Layouts become elements of one device, stored like ConfigFile does so DialogElement can load them:
+ * - XML files, any node with a name and a pin attribute (common aliases like label, port or output are accepted).
+ * - CSV files (comma, semicolon or tab), name,pin[,color] or name,red,green,blue[,color], read line by line.
+ * Colors files (.ini) are name=color lines, read line by line, see getColors().
+ *
+ * Foreign colors can be hexadecimal, r,g,b or a palette name, they are mapped to the closest palette color.
+ */
+class ForeignFile : public XMLHelper {
+
+public:
+
+	ForeignFile() = delete;
+
+	/**
+	 * @param fileName
+	 * @param deviceId the device that will receive the elements.
+	 * @param palette color name and RRGGBB value.
+	 * @throws Message if the file cannot be read.
+	 */
+	ForeignFile(const string& fileName, const string& deviceId, const unordered_map<string, string>& palette);
+
+	virtual ~ForeignFile() = default;
+
+	/**
+	 * @param fileName
+	 * @return true if the file is a colors file and not a layout.
+	 */
+	static bool isColorsFile(const string& fileName);
+
+	/**
+	 * @return number of elements read.
+	 */
+	size_t getElementsCount();
+
+	/**
+	 * @return element name and palette color name, from a colors file.
+	 */
+	const unordered_map<string, string>& getColors() const;
+
+	/**
+	 * Converts a foreign color into RRGGBB.
+	 * @param color #RRGGBB, RRGGBB, 0xRRGGBB, #RGB or r,g,b.
+	 * @return empty if is not a color.
+	 */
+	static string toHex(const string& color);
+
+	/**
+	 * Converts a foreign name into a valid element name.
+	 * @param name
+	 * @return
+	 */
+	static string toName(const string& name);
+
+protected:
+
+	/// Where the elements are stored.
+	const string collection;
+
+	const unordered_map<string, string>& palette;
+
+	/// Element name and color, from a colors file.
+	unordered_map<string, string> colors;
+
+	/// Foreign color for every stored element, in the same order.
+	vector<string> elementColors;
+
+	/// Attribute aliases, lowercase with no separators.
+	static const unordered_map<string, vector<string>> aliases;
+
+	void readXML(const string& fileName);
+
+	void readCSV(const string& fileName);
+
+	void readColors(const string& fileName);
+
+	/**
+	 * Validates and stores an element.
+	 * @param element
+	 * @param color the foreign color.
+	 * @param line
+	 */
+	void addElement(unordered_map<string, string>& element, const string& color, int line);
+
+	/**
+	 * Replaces the foreign colors with the palette names, all at once.
+	 * @param foreignColors
+	 */
+	void quantize(vector<string>& foreignColors) const;
+
+	/**
+	 * @param attribute
+	 * @return the attribute in lowercase without _, - or spaces.
+	 */
+	static string normalize(const string& attribute);
+};
+
+} /* namespace LEDSpicerUI */
+
+#endif /* FOREIGNFILE_HPP_ */
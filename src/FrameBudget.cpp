@@ -0,0 +1,62 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      FrameBudget.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "FrameBudget.hpp"
+
+using namespace LEDSpicerUI;
+
+FrameBudget::Load& FrameBudget::Load::operator+=(const Load& other) {
+	bytes     += other.bytes;
+	transfers += other.transfers;
+	return *this;
+}
+
+FrameBudget::Load FrameBudget::estimate(Defaults::DeviceType type, uint16_t pins) {
+	const auto& info = Defaults::getInfo(type);
+	Load load;
+	if (info.connection == Defaults::Connection::NONE)
+		return load;
+	load.bytes = info.frameHeader + (pins * info.bitsPerPin + 7) / 8;
+	if (info.packetSize)
+		load.transfers = (load.bytes + info.packetSize - 1) / info.packetSize;
+	return load;
+}
+
+float FrameBudget::usage(Defaults::Connection connection, const Load& load, uint16_t fps, uint32_t baud) {
+	switch (connection) {
+	case Defaults::Connection::USB:
+		return static_cast<float>(load.transfers * fps) / USB_TRANSFERS;
+	case Defaults::Connection::SERIAL:
+		return baud ? static_cast<float>(load.bytes * fps * SERIAL_BITS) / baud : 0;
+	default:
+		return 0;
+	}
+}
+
+string FrameBudget::toString(float usage) {
+	if (usage >= 1)
+		return "Overloaded";
+	if (usage >= TIGHT)
+		return "Tight";
+	return "Ok";
+}
@@ -0,0 +1,92 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      FrameBudget.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Defaults.hpp"
+
+#ifndef FRAMEBUDGET_HPP_
+#define FRAMEBUDGET_HPP_ 1
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::FrameBudget
+ * Estimates how much data every device needs on each frame, and how much of its connection that takes at a given FPS.
+ * The numbers are approximations based on the device information, intended to spot devices and buses that cannot keep up.
+ */
+class FrameBudget {
+
+public:
+
+	/// USB transfers a bus can complete per second, one per 1ms frame.
+	static constexpr uint32_t USB_TRANSFERS = 1000;
+
+	/// Default serial speed.
+	static constexpr uint32_t SERIAL_BAUD = 115200;
+
+	/// Serial lines send a start and a stop bit per byte.
+	static constexpr uint8_t SERIAL_BITS = 10;
+
+	/// Above this usage the connection is considered tight.
+	static constexpr float TIGHT = 0.75;
+
+	/**
+	 * What a device sends on every frame.
+	 */
+	struct Load {
+		uint32_t bytes     = 0;
+		/// Number of USB transfers, 0 for streamed connections.
+		uint32_t transfers = 0;
+
+		Load& operator+=(const Load& other);
+	};
+
+	FrameBudget() = delete;
+
+	virtual ~FrameBudget() = default;
+
+	/**
+	 * @param type a valid device type.
+	 * @param pins the number of pins the device drives.
+	 * @return the data sent per frame.
+	 */
+	static Load estimate(Defaults::DeviceType type, uint16_t pins);
+
+	/**
+	 * @param connection
+	 * @param load
+	 * @param fps
+	 * @param baud only used for serial connections.
+	 * @return the fraction of the connection used, 1 or more means it cannot sustain the FPS.
+	 */
+	static float usage(Defaults::Connection connection, const Load& load, uint16_t fps, uint32_t baud = SERIAL_BAUD);
+
+	/**
+	 * @param usage
+	 * @return a readable state for that usage.
+	 */
+	static string toString(float usage);
+};
+
+} /* namespace */
+
+#endif /* FRAMEBUDGET_HPP_ */
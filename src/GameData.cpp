@@ -0,0 +1,179 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      GameData.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "GameData.hpp"
+
+using namespace LEDSpicerUI;
+
+std::unique_ptr<DataIndex> GameData::gameData;
+std::unique_ptr<DataIndex> GameData::controls;
+std::unique_ptr<DataIndex> GameData::colors;
+
+string GameData::open(const string& dataDirectory) {
+	close();
+	string msg;
+	for (auto [index, file, format] : {
+		std::make_tuple(&gameData, GAME_DATA_FILE, DataIndex::Format::XML),
+		std::make_tuple(&controls, CONTROLS_FILE,  DataIndex::Format::INI),
+		std::make_tuple(&colors,   COLORS_FILE,    DataIndex::Format::INI),
+	}) {
+		if (not Glib::file_test(dataDirectory + file, Glib::FileTest::FILE_TEST_EXISTS))
+			continue;
+		try {
+			index->reset(new DataIndex(dataDirectory + file, format));
+			msg += "✅ Games data file " + string(file) + " Found, " + std::to_string((*index)->size()) + " games\n";
+		}
+		catch (Message& e) {
+			msg += "❌ " + e.getMessage() + "\n";
+		}
+	}
+	return msg;
+}
+
+void GameData::close() {
+	gameData.reset();
+	controls.reset();
+	colors.reset();
+}
+
+bool GameData::find(const string& name, Game& game) {
+	bool found = false;
+	string_view entry;
+	if (gameData and not (entry = gameData->find(name)).empty()) {
+		parseGameData(entry, game);
+		found = true;
+	}
+	if (controls and not (entry = controls->find(name)).empty()) {
+		parseControls(entry, game);
+		found = true;
+	}
+	if (colors and not (entry = colors->find(name)).empty()) {
+		forEachValue(entry, [&](string_view key, string_view value) {
+			game.colors.emplace(key, value);
+		});
+		found = true;
+	}
+	return found;
+}
+
+vector<string> GameData::getNames() {
+	for (auto index : {&gameData, &controls, &colors})
+		if (*index)
+			return (*index)->getNames();
+	return {};
+}
+
+bool GameData::isOpen() {
+	return gameData or controls or colors;
+}
+
+Defaults::Ways GameData::waysFromMame(string_view ways) {
+	if (ways == "2")
+		return Defaults::Ways::w2;
+	if (ways == "vertical2")
+		return Defaults::Ways::w2v;
+	if (ways == "4")
+		return Defaults::Ways::w4;
+	if (ways == "8")
+		return Defaults::Ways::w8;
+	if (ways == "16")
+		return Defaults::Ways::w16;
+	return Defaults::Ways::invalid;
+}
+
+string_view GameData::attribute(string_view tag, string_view name) {
+	size_t pos = 0;
+	while ((pos = tag.find(name, pos)) != string_view::npos) {
+		size_t value = pos + name.size();
+		// Needs to be a whole attribute name.
+		if (pos and tag[pos - 1] == ' ' and tag.substr(value, 2) == "=\"") {
+			value += 2;
+			size_t end = tag.find('"', value);
+			return end == string_view::npos ? string_view() : tag.substr(value, end - value);
+		}
+		pos = value;
+	}
+	return {};
+}
+
+void GameData::forEachValue(string_view section, std::function<void(string_view, string_view)> fn) {
+	size_t pos = 0;
+	while (pos < section.size()) {
+		size_t eol = section.find('\n', pos);
+		if (eol == string_view::npos)
+			eol = section.size();
+		string_view line(section.substr(pos, eol - pos));
+		if (not line.empty() and line.back() == '\r')
+			line.remove_suffix(1);
+		size_t eq = line.find('=');
+		if (eq != string_view::npos and line[0] != ';' and line[0] != '#')
+			fn(line.substr(0, eq), line.substr(eq + 1));
+		pos = eol + 1;
+	}
+}
+
+void GameData::parseGameData(string_view entry, Game& game) {
+	size_t pos = entry.find("<input ");
+	if (pos == string_view::npos)
+		return;
+	string_view input(entry.substr(pos, entry.find('>', pos) - pos));
+	auto toNumber = [](string_view value) {
+		uint8_t n = 0;
+		for (char c : value)
+			if (c >= '0' and c <= '9')
+				n = n * 10 + (c - '0');
+		return n;
+	};
+	game.players = toNumber(attribute(input, "players"));
+	game.buttons = toNumber(attribute(input, "buttons"));
+
+	while ((pos = entry.find("<control ", pos)) != string_view::npos) {
+		string_view control(entry.substr(pos, entry.find('>', pos) - pos));
+		game.controls.emplace_back(attribute(control, "type"));
+		if (game.ways == Defaults::Ways::invalid)
+			game.ways = waysFromMame(attribute(control, "ways"));
+		if (not game.buttons)
+			game.buttons = toNumber(attribute(control, "buttons"));
+		pos += control.size();
+	}
+}
+
+void GameData::parseControls(string_view entry, Game& game) {
+	forEachValue(entry, [&](string_view key, string_view value) {
+		if (key == "numPlayers" and not game.players) {
+			game.players = std::atoi(string(value).c_str());
+		}
+		else if (key == "P1NumButtons" and not game.buttons) {
+			game.buttons = std::atoi(string(value).c_str());
+		}
+		else if (key == "P1Controls" and game.ways == Defaults::Ways::invalid) {
+			// Like 8-way Joystick+joy8way
+			size_t way = value.find("-way");
+			if (way != string_view::npos and way)
+				game.ways = waysFromMame(value.substr(way - 1, 1));
+		}
+		else if (key.size() > 3 and key[0] == 'P' and key[2] == '_') {
+			game.labels.emplace(key, value);
+		}
+	});
+}
@@ -0,0 +1,131 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      GameData.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "DataIndex.hpp"
+
+#include <memory>
+
+#ifndef GAMEDATA_HPP_
+#define GAMEDATA_HPP_ 1
+
+#define GAME_DATA_FILE "gameData.xml"
+#define CONTROLS_FILE  "controls.ini"
+#define COLORS_FILE    "colors.ini"
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::GameData
+ * Per game information from the data directory: gameData.xml, controls.ini and colors.ini.
+ * Any missing file is ignored.
+ */
+class GameData {
+
+public:
+
+	/**
+	 * What is known about a game.
+	 */
+	struct Game {
+		uint8_t players = 0;
+		/// Buttons per player.
+		uint8_t buttons = 0;
+		/// Joystick ways, invalid if not known.
+		Defaults::Ways ways = Defaults::Ways::invalid;
+		/// Control types, like joy, dial or trackball.
+		vector<string> controls;
+		/// Element to label, like P1_BUTTON1 Fire.
+		unordered_map<string, string> labels;
+		/// Element to color name, like P1_BUTTON1 Red.
+		unordered_map<string, string> colors;
+	};
+
+	GameData() = delete;
+
+	virtual ~GameData() = default;
+
+	/**
+	 * Opens and indexes the data files.
+	 * @param dataDirectory with / at the end.
+	 * @return a message for every file that was found.
+	 */
+	static string open(const string& dataDirectory);
+
+	/**
+	 * Releases the files.
+	 */
+	static void close();
+
+	/**
+	 * Looks for a game in all files.
+	 * @param name the game name.
+	 * @param game where the information will be stored.
+	 * @return true if the game was found in any file.
+	 */
+	static bool find(const string& name, Game& game);
+
+	/**
+	 * @return the names of every game, from the most complete file available.
+	 */
+	static vector<string> getNames();
+
+	/**
+	 * @return true if any file is open.
+	 */
+	static bool isOpen();
+
+	/**
+	 * @param ways MAME ways, like 8 or vertical2.
+	 * @return the way.
+	 */
+	static Defaults::Ways waysFromMame(string_view ways);
+
+protected:
+
+	static std::unique_ptr<DataIndex>
+		gameData,
+		controls,
+		colors;
+
+	/**
+	 * @param tag a xml tag.
+	 * @param name
+	 * @return the value of the attribute, empty if not found.
+	 */
+	static string_view attribute(string_view tag, string_view name);
+
+	/**
+	 * Calls the function with every key and value of an ini section.
+	 * @param section
+	 * @param fn
+	 */
+	static void forEachValue(string_view section, std::function<void(string_view, string_view)> fn);
+
+	static void parseGameData(string_view entry, Game& game);
+
+	static void parseControls(string_view entry, Game& game);
+};
+
+} /* namespace */
+
+#endif /* GAMEDATA_HPP_ */
@@ -25,15 +25,15 @@
 using namespace LEDSpicerUI;
 
 InputFile::InputFile(const string& inputFile) : XMLHelper(inputFile, "Input") {
+	Diagnostics::setSource(inputFile);
 	// process filename.
 	auto file(Defaults::explode(Glib::path_get_basename(inputFile), '.'));
 	// This will work fine if the file have extension :P
 	file.pop_back();
-	string
-		// Extract name.
-		name(Defaults::implode(file, '.')),
-		// Extract maps.
-		errors(processMaps(name));
+	// Extract name.
+	string name(Defaults::implode(file, '.'));
+	// Extract maps.
+	processMaps(name);
 	// Extract input data.
 	unordered_map<string, string> input(processNode(getRoot()));
 	// Add filename (name)
@@ -42,46 +42,41 @@ InputFile::InputFile(const string& inputFile) : XMLHelper(inputFile, "Input") {
 
 	// Extract linked maps, if any.
 	if (input.count(LINKED_ITEMS) and not input.at(LINKED_ITEMS).empty()) {
-		errors += processLinkedMaps(input.at(LINKED_ITEMS), name);
+		processLinkedMaps(input.at(LINKED_ITEMS), name);
 	}
-	if (not errors.empty())
-		Message::displayError("Errors:\n" + errors);
 }
 
-const string InputFile::processMaps(const string& inputName) {
+void InputFile::processMaps(const string& inputName) {
 
 	tinyxml2::XMLElement* mapNode = root->FirstChildElement("map");
-	if (not mapNode)
-		return "Missing input map section\n";
+	if (not mapNode) {
+		Diagnostics::error("Missing input map section", inputName);
+		return;
+	}
 
-	string errors;
 	vector<unordered_map<string, string>> maps;
 	for (; mapNode; mapNode = mapNode->NextSiblingElement("map")) {
 		unordered_map<string, string> mapAttr = processNode(mapNode);
-		try {
-			checkAttributes({TYPE, TARGET, TRIGGER, COLOR, FILTER}, mapAttr, "input map");
-		}
-		catch (Message& e) {
-			errors += e.getMessage() + '\n';
+		string error(checkAttributes({TYPE, TARGET, TRIGGER, COLOR, FILTER}, mapAttr, "input map"));
+		if (not error.empty()) {
+			Diagnostics::error(error, inputName, mapNode->GetLineNum());
 			continue;
 		}
 		maps.push_back(mapAttr);
 	}
 	extractedData.emplace(Defaults::createCommonUniqueId({inputName, COLLECTION_INPUT_MAPS}), maps);
-	return errors;
 }
 
-const string InputFile::processLinkedMaps(const string& inputLinkedMaps, const string& inputName) {
+void InputFile::processLinkedMaps(const string& inputLinkedMaps, const string& inputName) {
 	if (!extractedData.count(inputName + COLLECTION_INPUT_MAPS)) {
-		return "";
+		return;
 	}
 	// Chunk sections.
 	auto chunks(Defaults::explode(inputLinkedMaps, ID_GROUP_SEPARATOR));
-	string errors;
 	vector<unordered_map<string, string>> linkedMaps;
 	for (auto& chunk : chunks) {
 		if (chunk.empty()) {
-			errors += "Empty linked map for " + inputName;
+			Diagnostics::warning("Empty linked map", inputName);
 			continue;
 		}
 		vector<string> linkedMapTrigger;
@@ -89,7 +84,7 @@ const string InputFile::processLinkedMaps(const string& inputLinkedMaps, const s
 		for (auto& trigger : Defaults::explode(chunk, ID_SEPARATOR)) {
 			Defaults::trim(trigger);
 			if (trigger.empty()) {
-				errors += "Empty item name in linked map for " + inputName;
+				Diagnostics::warning("Empty item name in linked map", inputName);
 				continue;
 			}
 			// Loop the input maps array until the trigger is sought.
@@ -110,5 +105,4 @@ const string InputFile::processLinkedMaps(const string& inputLinkedMaps, const s
 		}
 	}
 	extractedData.emplace(Defaults::createCommonUniqueId({inputName, COLLECTION_INPUT_LINKED_MAPS}), std::move(linkedMaps));
-	return errors;
 }
@@ -42,9 +42,9 @@ public:
 
 protected:
 
-const string processMaps(const string& inputName);
+void processMaps(const string& inputName);
 
-const string processLinkedMaps(const string& inputLinkedMaps, const string& inputName);
+void processLinkedMaps(const string& inputLinkedMaps, const string& inputName);
 
 };
 
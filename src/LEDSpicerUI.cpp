@@ -26,6 +26,59 @@ using namespace LEDSpicerUI;
 
 int main(int argc, char *argv[]) {
 
+	if (argc > 1 and string(argv[1]) == "--coverage") {
+		if (argc != 5) {
+			std::cerr << "Usage: " << argv[0] << " --coverage <project directory> <data directory> <report.csv | ->" << std::endl;
+			return EXIT_FAILURE;
+		}
+		return coverageReport(argv[2], argv[3], argv[4]);
+	}
+
+	if (argc > 1 and string(argv[1]) == "--lint") {
+		if (argc != 3 and argc != 4) {
+			std::cerr << "Usage: " << argv[0] << " --lint <project directory> [data directory]" << std::endl;
+			return EXIT_FAILURE;
+		}
+		return lintReport(argv[2], argc == 4 ? argv[3] : "");
+	}
+
+	if (argc > 1 and string(argv[1]) == "--bundle") {
+		if (argc != 4) {
+			std::cerr << "Usage: " << argv[0] << " --bundle <project directory> <bundle" BUNDLE_EXTENSION ">" << std::endl;
+			return EXIT_FAILURE;
+		}
+		return bundleProject(argv[2], argv[3]);
+	}
+
+	if (argc > 1 and string(argv[1]) == "--unbundle") {
+		if (argc != 4 and argc != 5) {
+			std::cerr << "Usage: " << argv[0] << " --unbundle <bundle" BUNDLE_EXTENSION "> <directory> [file]" << std::endl;
+			return EXIT_FAILURE;
+		}
+		return unbundleProject(argv[2], argv[3], argc == 5 ? argv[4] : "");
+	}
+
+#ifdef ENABLE_TRACE
+	// Removed from the arguments, Gtk does not know it.
+	string traceFile;
+	if (argc > 2 and string(argv[1]) == "--trace") {
+		traceFile = argv[2];
+		Trace::start(traceFile);
+		argv[2]   = argv[0];
+		argv     += 2;
+		argc     -= 2;
+	}
+#endif
+
+	// Statistics dump on exit, removed from the arguments too.
+	bool stats = false;
+	if (argc > 1 and string(argv[1]) == "--stats") {
+		stats   = true;
+		argv[1] = argv[0];
+		++argv;
+		--argc;
+	}
+
 	auto app         = Gtk::Application::create(argc, argv, "org.ledspicer.ui");
 	auto builder     = Gtk::Builder::create();
 	auto cssProvider = Gtk::CssProvider::create();
@@ -33,6 +86,7 @@ int main(int argc, char *argv[]) {
 	try {
 		builder->add_from_file(PACKAGE_DATA_DIR       "main.glade");
 		cssProvider->load_from_path(PACKAGE_DATA_DIR  "style.css");
+		Stats::add(Stats::Counters::CSS_RELOADS);
 	}
 	catch(Glib::Error& e) {
 		std::cerr << e.what() << std::endl;
@@ -55,9 +109,142 @@ int main(int argc, char *argv[]) {
 	builder->get_widget_derived("MainWindow", mw);
 	Message::initialize(builder, mw);
 	int r = app->run(*mw);
+#ifdef ENABLE_TRACE
+	if (not Trace::stop())
+		std::cerr << "Unable to write " << traceFile << std::endl;
+#endif
 
 	delete mw;
 
+	if (stats)
+		for (const auto& line : Stats::createReport())
+			std::cerr << line.first << ": " << line.second << std::endl;
+
 	std::cout << "LEDSpicer UI ended" << std::endl;
 	return r;
 }
+
+vector<std::unique_ptr<InputFile>> LEDSpicerUI::loadInputs(const string& projectDirectory) {
+	vector<std::unique_ptr<InputFile>> files;
+	const string directory(projectDirectory + "/inputs");
+	if (not Glib::file_test(directory, Glib::FileTest::FILE_TEST_IS_DIR))
+		return files;
+	for (const string& name : Glib::Dir(directory)) {
+		if (name.size() < 5 or name.compare(name.size() - 4, 4, ".xml"))
+			continue;
+		try {
+			files.emplace_back(new InputFile(directory + "/" + name));
+		}
+		catch (Message& e) {
+			Diagnostics::setSource(directory + "/" + name);
+			Diagnostics::error(XMLHelper::cleanError(e.getMessage()));
+		}
+	}
+	return files;
+}
+
+int LEDSpicerUI::coverageReport(const string& projectDirectory, const string& dataDirectory, const string& output) {
+	try {
+		std::cerr << GameData::open(dataDirectory + "/");
+		if (not GameData::isOpen())
+			throw Message("No games data files found in " + dataDirectory);
+
+		ConfigFile config(projectDirectory + CONFIG_FILE);
+		auto files(loadInputs(projectDirectory));
+		vector<InputFile*> inputs;
+		for (auto& file : files)
+			inputs.push_back(file.get());
+		for (const auto& issue : Diagnostics::getIssues())
+			std::cerr << Diagnostics::toString(issue.severity) << ": " << Glib::path_get_basename(issue.source) << " " << issue.place << " " << issue.message << std::endl;
+		Diagnostics::clear();
+
+		Coverage coverage(Coverage::createLayout(config, inputs));
+		size_t games;
+		if (output == "-") {
+			games = coverage.run(std::cout);
+		}
+		else {
+			std::ofstream file(output);
+			if (not file)
+				throw Message("Unable to write " + output);
+			games = coverage.run(file);
+		}
+		std::cerr << games << " games processed" << std::endl;
+	}
+	catch (Message& e) {
+		std::cerr << e.getMessage() << std::endl;
+		return EXIT_FAILURE;
+	}
+	catch (Glib::Error& e) {
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+int LEDSpicerUI::lintReport(const string& projectDirectory, const string& dataDirectory) {
+	try {
+		ConfigFile config(projectDirectory + CONFIG_FILE);
+		auto files(loadInputs(projectDirectory));
+		vector<InputFile*> inputs;
+		for (auto& file : files)
+			inputs.push_back(file.get());
+		// Without the data directory the colors are not checked.
+		string colorsFile;
+		if (not dataDirectory.empty())
+			colorsFile = dataDirectory + "/" + XMLHelper::valueOf(config.getSettings(), "colors", DEFAULT_COLORS) + ".xml";
+		auto snapshot(Lint::createSnapshot(config, inputs, projectDirectory, colorsFile));
+		auto issues(Diagnostics::getIssues());
+		Diagnostics::clear();
+
+		auto lint(Lint::run(snapshot));
+		issues.insert(issues.end(), lint.begin(), lint.end());
+		size_t errors = 0;
+		for (const auto& issue : issues) {
+			std::cout << Diagnostics::toString(issue.severity) << ": " << Glib::path_get_basename(issue.source) << " " << issue.place << " " << issue.message << std::endl;
+			if (issue.severity == Diagnostics::Severity::ERROR)
+				++errors;
+		}
+		std::cerr << errors << " errors, " << issues.size() - errors << " warnings" << std::endl;
+		return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+	}
+	catch (Message& e) {
+		std::cerr << e.getMessage() << std::endl;
+	}
+	catch (Glib::Error& e) {
+		std::cerr << e.what() << std::endl;
+	}
+	return EXIT_FAILURE;
+}
+
+int LEDSpicerUI::bundleProject(const string& projectDirectory, const string& bundle) {
+	try {
+		auto result(Bundle::create(bundle, projectDirectory));
+		std::cerr << result.written << " files compressed, " << result.skipped << " unchanged" << std::endl;
+	}
+	catch (Message& e) {
+		std::cerr << e.getMessage() << std::endl;
+		return EXIT_FAILURE;
+	}
+	catch (Glib::Error& e) {
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+int LEDSpicerUI::unbundleProject(const string& bundle, const string& directory, const string& path) {
+	try {
+		auto result(Bundle(bundle).extract(directory, path));
+		std::cerr << result.written << " files written, " << result.skipped << " unchanged" << std::endl;
+	}
+	catch (Message& e) {
+		std::cerr << e.getMessage() << std::endl;
+		return EXIT_FAILURE;
+	}
+	catch (Glib::Error& e) {
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -28,6 +28,8 @@ using std::signal;
 
 #include "Message.hpp"
 #include "Ui/MainWindow.hpp"
+#include "Coverage.hpp"
+#include "Lint.hpp"
 
 #include <glibmm.h>
 
@@ -36,6 +38,47 @@ using std::signal;
 
 namespace LEDSpicerUI {
 int main(int argc, char *argv[]);
+
+/**
+ * Reads every input plugin file of a project, the ones that fail are added to the diagnostics as errors.
+ * @param projectDirectory where ledspicer.conf and the inputs directory are.
+ * @return the input files.
+ */
+vector<std::unique_ptr<InputFile>> loadInputs(const string& projectDirectory);
+
+/**
+ * Writes the coverage report without the interface.
+ * @param projectDirectory where ledspicer.conf and the inputs directory are.
+ * @param dataDirectory where the games data files are.
+ * @param output the CSV file, - for the standard output.
+ * @return the exit code.
+ */
+int coverageReport(const string& projectDirectory, const string& dataDirectory, const string& output);
+
+/**
+ * Checks the project without the interface and prints the problems.
+ * @param projectDirectory where ledspicer.conf, the inputs, profiles and animations are.
+ * @param dataDirectory where the colors file is, empty to skip the color checks.
+ * @return the exit code, failure if there are errors.
+ */
+int lintReport(const string& projectDirectory, const string& dataDirectory);
+
+/**
+ * Writes a project bundle without the interface.
+ * @param projectDirectory
+ * @param bundle
+ * @return the exit code.
+ */
+int bundleProject(const string& projectDirectory, const string& bundle);
+
+/**
+ * Extracts a project bundle without the interface.
+ * @param bundle
+ * @param directory
+ * @param path only this file if not empty.
+ * @return the exit code.
+ */
+int unbundleProject(const string& bundle, const string& directory, const string& path);
 }
 
 #endif /* LEDSPICERUI_HPP_ */
@@ -0,0 +1,391 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Lint.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Lint.hpp"
+
+#include <atomic>
+#include <algorithm>
+
+using namespace LEDSpicerUI;
+
+Lint::Context::Context(const Snapshot& snapshot) : snapshot(snapshot) {
+	for (const auto& device : snapshot.devices)
+		for (const auto& element : device.elements)
+			elements.insert(element.name);
+	for (const auto& group : snapshot.groups)
+		groups.insert(group.name);
+	for (const auto& input : snapshot.inputs)
+		inputs.insert(input.name);
+}
+
+Lint::~Lint() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	condition.notify_all();
+	if (worker.joinable())
+		worker.join();
+}
+
+void Lint::setNotify(std::function<void()> notify) {
+	std::lock_guard<std::mutex> lock(mutex);
+	this->notify = notify;
+}
+
+void Lint::post(std::shared_ptr<const Snapshot> snapshot, const vector<string>& names) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		pending = snapshot;
+		if (names.empty())
+			pendingAll = true;
+		for (const auto& name : names)
+			if (not name.empty())
+				pendingNames.insert(name);
+		if (not worker.joinable())
+			worker = std::thread(&Lint::work, this);
+	}
+	condition.notify_all();
+}
+
+Lint::Issues Lint::getIssues() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	Issues issues;
+	for (const auto& result : results)
+		issues.insert(issues.end(), result.second.begin(), result.second.end());
+	return issues;
+}
+
+Lint::Issues Lint::run(const Snapshot& snapshot, uint threads) {
+	const Context context(snapshot);
+	const vector<Unit> units(createUnits(snapshot));
+	vector<size_t> selected(units.size());
+	for (size_t c = 0; c < units.size(); ++c)
+		selected[c] = c;
+	Issues issues;
+	for (auto& unitIssues : check(context, units, selected, threads))
+		issues.insert(issues.end(), unitIssues.begin(), unitIssues.end());
+	return issues;
+}
+
+Lint::Snapshot Lint::createSnapshot(ConfigFile& config, vector<InputFile*>& inputs, const string& projectDirectory, const string& colorsFile) {
+	Snapshot snapshot;
+	auto get = [](const unordered_map<string, string>& data, const string& key, const string& fallback = "") {
+		return data.count(key) ? data.at(key) : fallback;
+	};
+
+	for (const auto& device : config.getData(COLLECTION_DEVICES)) {
+		const auto type = Defaults::getDeviceType(get(device, NAME));
+		Snapshot::Device d;
+		d.id = Defaults::createHardwareUniqueId(type, get(device, ID, "1"), get(device, PORT));
+		d.pins = Defaults::getInfo(type).pins;
+		if (Defaults::isVariable(type)) {
+			try {
+				d.pins = std::stoi(get(device, PINS));
+			}
+			catch (...) {}
+		}
+		for (const auto& element : config.getData(Defaults::createCommonUniqueId({d.id, COLLECTION_ELEMENT}))) {
+			Snapshot::Element e{get(element, NAME), get(element, DEFAULT_COLOR), {}};
+			for (const auto pin : {PIN, SOLENOID, RED_PIN, GREEN_PIN, BLUE_PIN}) {
+				try {
+					if (element.count(pin) and not element.at(pin).empty())
+						e.pins.push_back(std::stoi(element.at(pin)));
+				}
+				catch (...) {}
+			}
+			d.elements.push_back(std::move(e));
+		}
+		snapshot.devices.push_back(std::move(d));
+	}
+
+	for (const auto& group : config.getData(COLLECTION_GROUP)) {
+		Snapshot::Group g{get(group, NAME), get(group, DEFAULT_COLOR), {}};
+		for (const auto& element : config.getData(Defaults::createCommonUniqueId({g.name, COLLECTION_GROUP})))
+			g.elements.push_back(get(element, NAME));
+		snapshot.groups.push_back(std::move(g));
+	}
+
+	for (const auto& restrictor : config.getData(COLLECTION_RESTRICTORS)) {
+		const auto type = Defaults::getRestrictorType(get(restrictor, NAME));
+		Snapshot::Restrictor r;
+		r.id = Defaults::createHardwareUniqueId(type, get(restrictor, ID, "1"), get(restrictor, PORT));
+		for (const auto& map : config.getData(Defaults::createCommonUniqueId({r.id, COLLECTION_RESTRICTOR_MAP})))
+			r.maps.emplace_back(get(map, PLAYER), get(map, JOYSTICK));
+		snapshot.restrictors.push_back(std::move(r));
+	}
+
+	for (auto input : inputs) {
+		Snapshot::Input i;
+		i.name = input->getData(COLLECTION_INPUT).front().at(FILENAME);
+		for (const auto& map : input->getData(Defaults::createCommonUniqueId({i.name, COLLECTION_INPUT_MAPS})))
+			i.maps.push_back({get(map, TRIGGER), get(map, TYPE), get(map, TARGET), get(map, COLOR)});
+		snapshot.inputs.push_back(std::move(i));
+	}
+
+	const string profilesDirectory(projectDirectory + "/profiles/");
+	if (Glib::file_test(profilesDirectory, Glib::FileTest::FILE_TEST_IS_DIR)) {
+		for (const string& name : Glib::Dir(profilesDirectory)) {
+			if (name.size() < 5 or name.compare(name.size() - 4, 4, ".xml"))
+				continue;
+			try {
+				XMLHelper file(profilesDirectory + name, "Profile");
+				Snapshot::Profile p;
+				p.name       = AnimationFile::extractName(name);
+				p.background = get(XMLHelper::processNode(file.getRoot()), BACKGROUND_COLOR);
+				addProfileNodes(p, file.getRoot());
+				snapshot.profiles.push_back(std::move(p));
+			}
+			catch (Message& e) {
+				Diagnostics::setSource(profilesDirectory + name);
+				Diagnostics::error(XMLHelper::cleanError(e.getMessage()));
+			}
+		}
+	}
+
+	AnimationCatalogue::open(projectDirectory);
+	for (auto& name : AnimationCatalogue::getNames())
+		snapshot.animations.insert(std::move(name));
+
+	if (not colorsFile.empty()) {
+		try {
+			XMLHelper file(colorsFile, "Colors");
+			for (auto node = file.getRoot()->FirstChildElement("color"); node; node = node->NextSiblingElement("color")) {
+				const char* name = node->Attribute(NAME);
+				if (name)
+					snapshot.palette.emplace(name);
+			}
+		}
+		catch (Message& e) {
+			Diagnostics::setSource(colorsFile);
+			Diagnostics::error(XMLHelper::cleanError(e.getMessage()));
+		}
+	}
+	return snapshot;
+}
+
+void Lint::addProfileNodes(Snapshot::Profile& profile, tinyxml2::XMLElement* node) {
+	for (auto child = node->FirstChildElement(); child; child = child->NextSiblingElement()) {
+		const string type(child->Name());
+		const char* name = child->Attribute(NAME);
+		const char* color = child->Attribute(COLOR);
+		if (type == "element" or type == "group") {
+			if (not name)
+				continue;
+			(type == "element" ? profile.elements : profile.groups).emplace_back(name);
+			if (color)
+				profile.colors.emplace_back(color);
+		}
+		else if (type == "animation" or type == "input") {
+			if (name)
+				(type == "animation" ? profile.animations : profile.inputs).emplace_back(name);
+		}
+		else {
+			addProfileNodes(profile, child);
+		}
+	}
+}
+
+void Lint::work() {
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true) {
+		condition.wait(lock, [&]() { return stop or pending; });
+		if (stop)
+			return;
+		auto snapshot(std::move(pending));
+		pending.reset();
+		bool all = pendingAll;
+		unordered_set<string> names;
+		names.swap(pendingNames);
+		pendingAll = false;
+		lock.unlock();
+
+		// Only the units that are or use a changed name, plus the ones that vanished.
+		const Context context(*snapshot);
+		const vector<Unit> units(createUnits(*snapshot));
+		vector<size_t> selected;
+		for (size_t c = 0; c < units.size(); ++c) {
+			if (all or std::any_of(units[c].names.begin(), units[c].names.end(), [&](const string& n) { return names.count(n); }))
+				selected.push_back(c);
+		}
+		auto issues(check(context, units, selected, all ? 0 : 1));
+
+		lock.lock();
+		if (all) {
+			results.clear();
+		}
+		else {
+			unordered_set<string> keys;
+			for (const auto& unit : units)
+				keys.insert(unit.key);
+			for (auto r = results.begin(); r != results.end();)
+				r = keys.count(r->first) ? std::next(r) : results.erase(r);
+		}
+		for (size_t c = 0; c < selected.size(); ++c)
+			results[units[selected[c]].key] = std::move(issues[c]);
+		auto callback(notify);
+		lock.unlock();
+		if (callback)
+			callback();
+		lock.lock();
+	}
+}
+
+vector<Lint::Unit> Lint::createUnits(const Snapshot& snapshot) {
+	vector<Unit> units;
+	for (const auto& device : snapshot.devices) {
+		Unit unit{"device:" + device.id, {device.id}, [&device](const Context& c, Issues& i) { checkDevice(c, device, i); }};
+		for (const auto& element : device.elements) {
+			unit.names.push_back(element.name);
+			unit.names.push_back(element.color);
+		}
+		units.push_back(std::move(unit));
+	}
+	for (const auto& group : snapshot.groups) {
+		Unit unit{"group:" + group.name, {group.name, group.color}, [&group](const Context& c, Issues& i) { checkGroup(c, group, i); }};
+		unit.names.insert(unit.names.end(), group.elements.begin(), group.elements.end());
+		units.push_back(std::move(unit));
+	}
+	for (const auto& input : snapshot.inputs) {
+		Unit unit{"input:" + input.name, {input.name}, [&input](const Context& c, Issues& i) { checkInput(c, input, i); }};
+		for (const auto& map : input.maps) {
+			unit.names.push_back(map.target);
+			unit.names.push_back(map.color);
+		}
+		units.push_back(std::move(unit));
+	}
+	if (not snapshot.restrictors.empty()) {
+		Unit unit{"restrictors", {}, [](const Context& c, Issues& i) { checkRestrictors(c, i); }};
+		for (const auto& restrictor : snapshot.restrictors)
+			unit.names.push_back(restrictor.id);
+		units.push_back(std::move(unit));
+	}
+	for (const auto& profile : snapshot.profiles) {
+		Unit unit{"profile:" + profile.name, {profile.name, profile.background}, [&profile](const Context& c, Issues& i) { checkProfile(c, profile, i); }};
+		for (const auto list : {&profile.elements, &profile.groups, &profile.animations, &profile.inputs, &profile.colors})
+			unit.names.insert(unit.names.end(), list->begin(), list->end());
+		units.push_back(std::move(unit));
+	}
+	return units;
+}
+
+vector<Lint::Issues> Lint::check(const Context& context, const vector<Unit>& units, const vector<size_t>& selected, uint threads) {
+	vector<Issues> issues(selected.size());
+	if (not threads)
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+	threads = std::min<size_t>(threads, selected.size());
+	std::atomic<size_t> next(0);
+	auto process = [&]() {
+		for (size_t c = next++; c < selected.size(); c = next++)
+			units[selected[c]].check(context, issues[c]);
+	};
+	if (threads < 2) {
+		process();
+		return issues;
+	}
+	vector<std::thread> workers;
+	for (uint t = 0; t < threads; ++t)
+		workers.emplace_back(process);
+	for (auto& worker : workers)
+		worker.join();
+	return issues;
+}
+
+void Lint::add(Issues& issues, Diagnostics::Severity severity, const string& source, const string& place, const string& message) {
+	issues.push_back({severity, source, 0, place, message});
+}
+
+bool Lint::isKnownColor(const Context& context, const string& color) {
+	if (color.empty() or context.snapshot.palette.empty())
+		return true;
+	return color == "On" or color == "Off" or color == "Random" or context.snapshot.palette.count(color);
+}
+
+void Lint::checkDevice(const Context& context, const Snapshot::Device& device, Issues& issues) {
+	unordered_map<uint16_t, string> used;
+	for (const auto& element : device.elements) {
+		const string place(device.id + " / " + element.name);
+		for (const auto pin : element.pins) {
+			if (device.pins and pin > device.pins)
+				add(issues, Diagnostics::Severity::ERROR, CONFIG_FILE, place, "Pin " + std::to_string(pin) + " is beyond the " + std::to_string(device.pins) + " pins of the device");
+			auto u = used.emplace(pin, element.name);
+			if (not u.second)
+				add(issues, Diagnostics::Severity::ERROR, CONFIG_FILE, place, "Pin " + std::to_string(pin) + " is also used by " + u.first->second);
+		}
+		if (not isKnownColor(context, element.color))
+			add(issues, Diagnostics::Severity::WARNING, CONFIG_FILE, place, "Color " + element.color + " is not in the palette");
+	}
+}
+
+void Lint::checkGroup(const Context& context, const Snapshot::Group& group, Issues& issues) {
+	const string place("Group " + group.name);
+	if (group.elements.empty())
+		add(issues, Diagnostics::Severity::WARNING, CONFIG_FILE, place, "The group is empty");
+	for (const auto& element : group.elements)
+		if (not context.elements.count(element))
+			add(issues, Diagnostics::Severity::ERROR, CONFIG_FILE, place, "Element " + element + " does not exist");
+	if (not isKnownColor(context, group.color))
+		add(issues, Diagnostics::Severity::WARNING, CONFIG_FILE, place, "Color " + group.color + " is not in the palette");
+}
+
+void Lint::checkInput(const Context& context, const Snapshot::Input& input, Issues& issues) {
+	for (const auto& map : input.maps) {
+		const string place(input.name + " / " + map.trigger);
+		if (map.type == GROUP ? not context.groups.count(map.target) : not context.elements.count(map.target))
+			add(issues, Diagnostics::Severity::ERROR, input.name, place, map.type + " " + map.target + " does not exist");
+		if (not isKnownColor(context, map.color))
+			add(issues, Diagnostics::Severity::WARNING, input.name, place, "Color " + map.color + " is not in the palette");
+	}
+}
+
+void Lint::checkRestrictors(const Context& context, Issues& issues) {
+	unordered_map<string, string> used;
+	for (const auto& restrictor : context.snapshot.restrictors) {
+		for (const auto& map : restrictor.maps) {
+			auto u = used.emplace(map.first + ID_SEPARATOR + map.second, restrictor.id);
+			if (not u.second)
+				add(issues, Diagnostics::Severity::ERROR, CONFIG_FILE, restrictor.id, "Player " + map.first + " joystick " + map.second + " is also mapped by " + u.first->second);
+		}
+	}
+}
+
+void Lint::checkProfile(const Context& context, const Snapshot::Profile& profile, Issues& issues) {
+	const string place("Profile " + profile.name);
+	for (const auto& element : profile.elements)
+		if (not context.elements.count(element))
+			add(issues, Diagnostics::Severity::ERROR, profile.name, place, "Element " + element + " does not exist");
+	for (const auto& group : profile.groups)
+		if (not context.groups.count(group))
+			add(issues, Diagnostics::Severity::ERROR, profile.name, place, "Group " + group + " does not exist");
+	if (not context.snapshot.animations.empty())
+		for (const auto& animation : profile.animations)
+			if (not context.snapshot.animations.count(animation))
+				add(issues, Diagnostics::Severity::ERROR, profile.name, place, "Animation " + animation + " does not exist");
+	for (const auto& input : profile.inputs)
+		if (not context.inputs.count(input))
+			add(issues, Diagnostics::Severity::ERROR, profile.name, place, "Input " + input + " does not exist");
+	for (const auto& color : profile.colors)
+		if (not isKnownColor(context, color))
+			add(issues, Diagnostics::Severity::WARNING, profile.name, place, "Color " + color + " is not in the palette");
+	if (not isKnownColor(context, profile.background))
+		add(issues, Diagnostics::Severity::WARNING, profile.name, place, "Background color " + profile.background + " is not in the palette");
+}
@@ -0,0 +1,269 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Lint.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Diagnostics.hpp"
+#include "ConfigFile.hpp"
+#include "InputFile.hpp"
+#include "AnimationCatalogue.hpp"
+
+#include <map>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_set>
+using std::unordered_set;
+
+#ifndef LINT_HPP_
+#define LINT_HPP_ 1
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::Lint
+ * Finds problems between entities: missing references, overlapping pins, restrictor clashes and unknown colors.
+ * The project is split into units, a device, a group, an input, a profile or all the restrictors,
+ * every unit knows the names it uses so an edit only checks the units that are or use the changed names.
+ * Checks run on a snapshot in a worker thread, a full pass can use all cores.
+ */
+class Lint {
+
+public:
+
+	using Issues = vector<Diagnostics::Issue>;
+
+	/**
+	 * Copy of the project, the worker never touches the live data.
+	 */
+	struct Snapshot {
+
+		struct Element {
+			string name;
+			string color;
+			vector<uint16_t> pins;
+		};
+
+		struct Device {
+			/// The hardware unique ID.
+			string id;
+			uint16_t pins = 0;
+			vector<Element> elements;
+		};
+
+		struct Group {
+			string name;
+			string color;
+			vector<string> elements;
+		};
+
+		struct Map {
+			string trigger;
+			/// Element or Group.
+			string type;
+			string target;
+			string color;
+		};
+
+		struct Input {
+			string name;
+			vector<Map> maps;
+		};
+
+		struct Restrictor {
+			/// The hardware unique ID.
+			string id;
+			/// Player and joystick.
+			vector<std::pair<string, string>> maps;
+		};
+
+		struct Profile {
+			string name;
+			string background;
+			vector<string>
+				elements,
+				groups,
+				animations,
+				inputs,
+				/// Colors of the always on elements and groups.
+				colors;
+		};
+
+		vector<Device>     devices;
+		vector<Group>      groups;
+		vector<Input>      inputs;
+		vector<Restrictor> restrictors;
+		vector<Profile>    profiles;
+		/// Known animation names, empty when unknown.
+		unordered_set<string> animations;
+		/// Valid color names, empty when unknown.
+		unordered_set<string> palette;
+	};
+
+	Lint() = default;
+
+	/**
+	 * Stops the worker.
+	 */
+	virtual ~Lint();
+
+	/**
+	 * @param notify called from the worker when new results are ready.
+	 */
+	void setNotify(std::function<void()> notify);
+
+	/**
+	 * Queues a check, a snapshot that is still waiting is replaced and its names are kept.
+	 * @param snapshot
+	 * @param names the changed names, empty to check everything.
+	 */
+	void post(std::shared_ptr<const Snapshot> snapshot, const vector<string>& names = {});
+
+	/**
+	 * @return the last results, by unit.
+	 */
+	Issues getIssues() const;
+
+	/**
+	 * Checks everything.
+	 * @param snapshot
+	 * @param threads 0 to use all cores.
+	 * @return
+	 */
+	static Issues run(const Snapshot& snapshot, uint threads = 0);
+
+	/**
+	 * Creates a snapshot from files, the profiles and the animation catalogue are read from the project directory.
+	 * Files that cannot be read are reported to the Diagnostics.
+	 * @param config
+	 * @param inputs
+	 * @param projectDirectory
+	 * @param colorsFile the palette, empty to skip the color checks.
+	 * @return
+	 */
+	static Snapshot createSnapshot(ConfigFile& config, vector<InputFile*>& inputs, const string& projectDirectory, const string& colorsFile = "");
+
+protected:
+
+	/**
+	 * Names of every kind, built once per check.
+	 */
+	struct Context {
+		const Snapshot& snapshot;
+		unordered_set<string>
+			elements,
+			groups,
+			inputs;
+		Context(const Snapshot& snapshot);
+	};
+
+	/**
+	 * A piece of the project that is checked as a whole.
+	 */
+	struct Unit {
+		string key;
+		/// Its own name and the names it uses.
+		vector<string> names;
+		std::function<void(const Context&, Issues&)> check;
+	};
+
+	mutable std::mutex mutex;
+
+	std::condition_variable condition;
+
+	std::thread worker;
+
+	bool stop = false;
+
+	/// Snapshot waiting for the worker.
+	std::shared_ptr<const Snapshot> pending;
+
+	/// Changed names waiting for the worker.
+	unordered_set<string> pendingNames;
+
+	/// The pending check is for everything.
+	bool pendingAll = false;
+
+	/// Results by unit key.
+	std::map<string, Issues> results;
+
+	std::function<void()> notify;
+
+	/**
+	 * Worker loop.
+	 */
+	void work();
+
+	/**
+	 * @param snapshot
+	 * @return all the units of a snapshot, they point into it.
+	 */
+	static vector<Unit> createUnits(const Snapshot& snapshot);
+
+	/**
+	 * Runs some units, in parallel if they are many.
+	 * @param context
+	 * @param units
+	 * @param selected indexes of the units to run.
+	 * @param threads 0 to use all cores.
+	 * @return the issues of every selected unit, in the same order.
+	 */
+	static vector<Issues> check(const Context& context, const vector<Unit>& units, const vector<size_t>& selected, uint threads);
+
+	/**
+	 * @param issues
+	 * @param severity
+	 * @param source the file the data goes into.
+	 * @param place
+	 * @param message
+	 */
+	static void add(Issues& issues, Diagnostics::Severity severity, const string& source, const string& place, const string& message);
+
+	/**
+	 * @param context
+	 * @param color
+	 * @return true if the color is empty or valid, or the palette is unknown.
+	 */
+	static bool isKnownColor(const Context& context, const string& color);
+
+	static void checkDevice(const Context& context, const Snapshot::Device& device, Issues& issues);
+
+	static void checkGroup(const Context& context, const Snapshot::Group& group, Issues& issues);
+
+	static void checkInput(const Context& context, const Snapshot::Input& input, Issues& issues);
+
+	static void checkRestrictors(const Context& context, Issues& issues);
+
+	static void checkProfile(const Context& context, const Snapshot::Profile& profile, Issues& issues);
+
+	/**
+	 * Adds the elements, groups, animations and inputs under a profile node,
+	 * sections like alwaysOnElements are walked into.
+	 * @param profile
+	 * @param node
+	 */
+	static void addProfileNodes(Snapshot::Profile& profile, tinyxml2::XMLElement* node);
+};
+
+} /* namespace */
+
+#endif /* LINT_HPP_ */
@@ -0,0 +1,151 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      PinSolver.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "PinSolver.hpp"
+
+#include <algorithm>
+
+using namespace LEDSpicerUI;
+
+PinSolver::Result PinSolver::solve(const vector<Board>& boards, const vector<Spec>& specs) {
+
+	Result result;
+	vector<State> states;
+	states.reserve(boards.size());
+	for (size_t b = 0; b < boards.size(); ++b) {
+		const Board& board = boards[b];
+		State state{b, board.monochrome, false, vector<bool>(board.pins, false), board.pins};
+		for (auto pin : board.used) {
+			if (pin and pin <= board.pins and not state.taken[pin - 1]) {
+				state.taken[pin - 1] = true;
+				--state.free;
+				state.inUse = true;
+			}
+		}
+		states.push_back(std::move(state));
+	}
+
+	// RGB first, they need contiguous pins, the rest fills the gaps.
+	vector<size_t> order;
+	order.reserve(specs.size());
+	for (size_t s = 0; s < specs.size(); ++s)
+		if (specs[s].kind == Kinds::RGB)
+			order.push_back(s);
+	const size_t triplets = order.size();
+	for (size_t s = 0; s < specs.size(); ++s)
+		if (specs[s].kind != Kinds::RGB)
+			order.push_back(s);
+
+	vector<State*> boardOrder;
+	auto sortBoards = [&]() {
+		boardOrder.clear();
+		for (auto& state : states)
+			boardOrder.push_back(&state);
+		std::stable_sort(boardOrder.begin(), boardOrder.end(), [](const State* a, const State* b) {
+			if (a->inUse != b->inUse)
+				return a->inUse;
+			return a->free > b->free;
+		});
+	};
+
+	// Boards before first are full for the current kind.
+	size_t first = 0;
+	result.placements.reserve(specs.size());
+	for (size_t o = 0; o < order.size(); ++o) {
+		if (o == 0 or o == triplets) {
+			sortBoards();
+			first = 0;
+		}
+		const bool rgb = o < triplets;
+		bool placed = false;
+		for (size_t b = first; b < boardOrder.size(); ++b) {
+			State& state = *boardOrder[b];
+			if (rgb and state.monochrome)
+				continue;
+			int index = rgb ? findTriplet(state) : findSingle(state);
+			if (index < 0) {
+				if (b == first)
+					++first;
+				continue;
+			}
+			take(state, index, rgb ? 3 : 1);
+			result.placements.push_back({order[o], state.board, static_cast<uint16_t>(index + 1)});
+			placed = true;
+			break;
+		}
+		if (not placed) {
+			result.unplaced.push_back(order[o]);
+			result.missingPins += rgb ? 3 : 1;
+		}
+	}
+
+	std::sort(result.placements.begin(), result.placements.end(), [](const Placement& a, const Placement& b) {
+		return a.spec < b.spec;
+	});
+	std::sort(result.unplaced.begin(), result.unplaced.end());
+
+	for (auto& state : states) {
+		result.freePins += state.free;
+		if (state.inUse)
+			++result.boards;
+	}
+	// Free pins that cannot hold a triplet are not missing pins.
+	result.missingPins = result.missingPins > result.freePins ? result.missingPins - result.freePins : 0;
+	return result;
+}
+
+uint8_t PinSolver::getWidth(Kinds kind) {
+	return kind == Kinds::RGB ? 3 : 1;
+}
+
+int PinSolver::findSingle(State& state) {
+	if (not state.free)
+		return -1;
+	while (state.single < state.taken.size() and state.taken[state.single])
+		++state.single;
+	return state.single < state.taken.size() ? state.single : -1;
+}
+
+int PinSolver::findTriplet(State& state) {
+	if (state.free < 3)
+		return -1;
+	const size_t size = state.taken.size();
+	auto isFree = [&](size_t index) {
+		return not state.taken[index] and not state.taken[index + 1] and not state.taken[index + 2];
+	};
+	// Hardware triplets first, 1-3, 4-6...
+	for (; state.aligned + 3u <= size; state.aligned += 3)
+		if (isFree(state.aligned))
+			return state.aligned;
+	for (; state.any + 3u <= size; ++state.any)
+		if (isFree(state.any))
+			return state.any;
+	return -1;
+}
+
+void PinSolver::take(State& state, uint16_t index, uint8_t count) {
+	for (uint8_t c = 0; c < count; ++c)
+		state.taken[index + c] = true;
+	state.free -= count;
+	state.inUse = true;
+}
@@ -0,0 +1,150 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      PinSolver.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <vector>
+using std::vector;
+
+#include <string>
+using std::string;
+
+#include <cstdint>
+
+#ifndef PINSOLVER_HPP_
+#define PINSOLVER_HPP_ 1
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::PinSolver
+ * Places a list of elements into the free pins of a set of boards.
+ *
+ * RGB elements take three contiguous pins, aligned to the hardware triplets when possible, they never go into monochrome boards.
+ * Boards already in use are filled first, then the ones with more free pins, so the number of boards used stays low.
+ * Every board keeps cursors that only move forward, so a placement is linear on the pins and the elements.
+ * Does not depend on gtkmm.
+ */
+class PinSolver {
+
+public:
+
+	enum class Kinds : uint8_t {SINGLE, RGB, SOLENOID};
+
+	/**
+	 * An element to place.
+	 */
+	struct Spec {
+		string name;
+		Kinds  kind = Kinds::SINGLE;
+	};
+
+	/**
+	 * A board and the pins already in use.
+	 */
+	struct Board {
+		string   id;
+		uint16_t pins       = 0;
+		bool     monochrome = false;
+		/// Pins in use, from 1.
+		vector<uint16_t> used;
+	};
+
+	/**
+	 * Where an element goes, RGB elements use pin, pin + 1 and pin + 2.
+	 */
+	struct Placement {
+		size_t   spec;
+		size_t   board;
+		uint16_t pin;
+	};
+
+	struct Result {
+		vector<Placement> placements;
+		/// Specs that did not fit.
+		vector<size_t> unplaced;
+		/// Boards with at least one pin used after the placement.
+		size_t boards = 0;
+		/// Pins left free.
+		size_t freePins = 0;
+		/// Pins that were missing to place everything.
+		size_t missingPins = 0;
+	};
+
+	PinSolver() = delete;
+
+	virtual ~PinSolver() = default;
+
+	/**
+	 * @param boards
+	 * @param specs
+	 * @return the placements, in the specs order.
+	 */
+	static Result solve(const vector<Board>& boards, const vector<Spec>& specs);
+
+	/**
+	 * @param kind
+	 * @return the number of pins used by an element.
+	 */
+	static uint8_t getWidth(Kinds kind);
+
+protected:
+
+	/**
+	 * Board occupancy while solving.
+	 */
+	struct State {
+		size_t       board;
+		bool         monochrome;
+		bool         inUse;
+		vector<bool> taken;
+		size_t       free;
+		/// Everything before the cursors is known to not fit.
+		uint16_t
+			single  = 0,
+			aligned = 0,
+			any     = 0;
+	};
+
+	/**
+	 * @param state
+	 * @return the first free pin index, or -1.
+	 */
+	static int findSingle(State& state);
+
+	/**
+	 * @param state
+	 * @return the first index of three contiguous free pins, or -1.
+	 */
+	static int findTriplet(State& state);
+
+	/**
+	 * Marks pins as used.
+	 * @param state
+	 * @param index
+	 * @param count
+	 */
+	static void take(State& state, uint16_t index, uint8_t count);
+};
+
+} /* namespace LEDSpicerUI */
+
+#endif /* PINSOLVER_HPP_ */
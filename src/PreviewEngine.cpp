@@ -0,0 +1,277 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      PreviewEngine.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PreviewEngine.hpp"
+
+#include <cstring>
+
+using namespace LEDSpicerUI;
+
+PreviewEngine::Color PreviewEngine::Color::fromHex(const string& hex) {
+	Color c;
+	if (hex.size() != 6 or hex.find_first_not_of("0123456789abcdefABCDEF") != string::npos)
+		return c;
+	uint32_t value = std::stoul(hex, nullptr, 16);
+	c.r = value >> 16;
+	c.g = value >> 8;
+	c.b = value;
+	return c;
+}
+
+void PreviewEngine::setLayout(uint32_t leds) {
+	PreviewEngine::leds = leds;
+	base.assign(leds * 3, 0);
+	frame.assign(leds * 3, 0);
+	clearActors();
+	restart();
+}
+
+uint32_t PreviewEngine::getLeds() const {
+	return leds;
+}
+
+void PreviewEngine::setFps(uint16_t fps) {
+	PreviewEngine::fps = fps ? fps : 1;
+	stepTime = 1000000 / PreviewEngine::fps;
+	for (auto& actor : actors)
+		actor.period = toSteps(actor.seconds);
+	restart();
+}
+
+void PreviewEngine::setBase(Color background, const vector<std::pair<uint32_t, Color>>& lit) {
+	for (uint32_t c = 0; c < base.size(); c += 3) {
+		base[c]     = background.r;
+		base[c + 1] = background.g;
+		base[c + 2] = background.b;
+	}
+	for (const auto& [led, color] : lit) {
+		if (led >= leds)
+			continue;
+		base[led * 3]     = color.r;
+		base[led * 3 + 1] = color.g;
+		base[led * 3 + 2] = color.b;
+	}
+}
+
+bool PreviewEngine::addActor(const string& type, const vector<uint32_t>& leds, Color color, Color secondary, const string& speed, bool backward) {
+	static const unordered_map<string, Effects> effects{
+		{"Filler",     Effects::Filler},
+		{"Pulse",      Effects::Pulse},
+		{"Serpentine", Effects::Serpentine},
+		{"Random",     Effects::Random},
+		{"Gradient",   Effects::Gradient},
+	};
+	static const unordered_map<string, float> speeds{
+		{"VeryFast", 0.5},
+		{"Fast",     1},
+		{"Normal",   2},
+		{"Slow",     3},
+		{"VerySlow", 4},
+	};
+	auto effect(effects.find(type));
+	if (effect == effects.end() or leds.empty())
+		return false;
+
+	Actor actor;
+	actor.effect    = effect->second;
+	actor.first     = actorLeds.size();
+	actor.count     = leds.size();
+	actor.color     = color;
+	actor.secondary = secondary;
+	actor.seconds   = speeds.count(speed) ? speeds.at(speed) : speeds.at("Normal");
+	actor.period    = toSteps(actor.seconds);
+	actor.backward  = backward;
+	for (uint32_t led : leds)
+		actorLeds.push_back(led < PreviewEngine::leds ? led : 0);
+	actors.push_back(actor);
+	return true;
+}
+
+void PreviewEngine::clearActors() {
+	actors.clear();
+	actorLeds.clear();
+	triggers.clear();
+	triggerLeds.clear();
+}
+
+void PreviewEngine::trigger(const vector<uint32_t>& leds, Color color, float seconds) {
+	if (leds.empty())
+		return;
+	// Not in the frame loop, this can allocate.
+	triggers.push_back({static_cast<uint32_t>(triggerLeds.size()), static_cast<uint32_t>(leds.size()), color, tick + toSteps(seconds)});
+	for (uint32_t led : leds)
+		triggerLeds.push_back(led < PreviewEngine::leds ? led : 0);
+}
+
+void PreviewEngine::restart() {
+	last        = 0;
+	accumulated = 0;
+	stats       = Stats();
+}
+
+bool PreviewEngine::update(int64_t now) {
+	// First frame right away.
+	if (not last or now - last > PAUSE) {
+		last        = now;
+		accumulated = stepTime;
+	}
+	accumulated += now - last;
+	last         = now;
+	if (accumulated < stepTime)
+		return false;
+
+	// Only the newest due frame is rendered, effects depend on the tick alone so skipping is free.
+	uint64_t steps = accumulated / stepTime;
+	accumulated   -= steps * stepTime;
+	tick          += steps;
+	stats.dropped += steps - 1;
+	render();
+	return true;
+}
+
+const uint8_t* PreviewEngine::getFrame() const {
+	return frame.data();
+}
+
+const PreviewEngine::Stats& PreviewEngine::getStats() const {
+	return stats;
+}
+
+string PreviewEngine::toString(const Stats& stats, uint16_t fps) {
+	auto us = [](double value) {
+		return std::to_string(static_cast<uint32_t>(value)) + "µs";
+	};
+	return
+		"Frames: "  + std::to_string(stats.frames) +
+		" Dropped: " + std::to_string(stats.dropped) +
+		" Frame: "   + us(stats.frameTime) + " (worst " + us(stats.worstFrameTime) + " of " + us(1000000.0 / (fps ? fps : 1)) + ")" +
+		" Base: "     + us(stats.stageTime[BASE]) +
+		" Actors: "   + us(stats.stageTime[ACTORS]) +
+		" Triggers: " + us(stats.stageTime[TRIGGERS]);
+}
+
+void PreviewEngine::render() {
+	std::array<Clock::time_point, STAGES + 1> times;
+	times[BASE] = Clock::now();
+
+	std::memcpy(frame.data(), base.data(), frame.size());
+	times[ACTORS] = Clock::now();
+
+	for (const auto& actor : actors)
+		renderActor(actor);
+	times[TRIGGERS] = Clock::now();
+
+	// Expired ones are dropped, the LEDs are reclaimed when none is left.
+	for (size_t c = 0; c < triggers.size();) {
+		const auto& t = triggers[c];
+		if (t.until < tick) {
+			triggers[c] = triggers.back();
+			triggers.pop_back();
+			continue;
+		}
+		for (uint32_t l = t.first; l < t.first + t.count; ++l)
+			setLed(triggerLeds[l], t.color);
+		++c;
+	}
+	if (triggers.empty())
+		triggerLeds.clear();
+	times[STAGES] = Clock::now();
+
+	for (uint8_t s = BASE; s < STAGES; ++s)
+		smooth(stats.stageTime[s], std::chrono::duration<double, std::micro>(times[s + 1] - times[s]).count());
+	double frameTime = std::chrono::duration<double, std::micro>(times[STAGES] - times[BASE]).count();
+	smooth(stats.frameTime, frameTime);
+	if (frameTime > stats.worstFrameTime)
+		stats.worstFrameTime = frameTime;
+	++stats.frames;
+}
+
+void PreviewEngine::renderActor(const Actor& actor) {
+	const uint32_t
+		phase = tick % actor.period,
+		count = actor.count;
+	const uint32_t* group = actorLeds.data() + actor.first;
+	auto led = [&](uint32_t position) {
+		return group[actor.backward ? count - 1 - position : position];
+	};
+	switch (actor.effect) {
+	case Effects::Filler: {
+		uint32_t lit = static_cast<uint64_t>(phase + 1) * count / actor.period;
+		for (uint32_t p = 0; p < lit; ++p)
+			setLed(led(p), actor.color);
+		break;
+	}
+	case Effects::Pulse: {
+		// Triangle wave, up and down once per cycle.
+		uint32_t level = static_cast<uint64_t>(phase) * 510 / actor.period;
+		level = level > 255 ? 510 - level : level;
+		for (uint32_t p = 0; p < count; ++p)
+			setLed(led(p), actor.color, level);
+		break;
+	}
+	case Effects::Serpentine: {
+		uint32_t
+			head = static_cast<uint64_t>(phase) * count / actor.period,
+			tail = std::max<uint32_t>(1, count / 5);
+		for (uint32_t t = 0; t < tail and t < count; ++t)
+			setLed(led((head + count - t) % count), actor.color, 255 - t * 255 / tail);
+		break;
+	}
+	case Effects::Random: {
+		// Changes four times per cycle, the same tick gives the same pattern.
+		uint64_t seed = (tick / std::max<uint32_t>(1, actor.period / 4) + 1) * 0x9E3779B97F4A7C15ULL;
+		for (uint32_t p = 0; p < count; ++p) {
+			uint64_t h = (seed ^ p) * 0xBF58476D1CE4E5B9ULL;
+			h ^= h >> 31;
+			if (h & 1)
+				setLed(led(p), actor.color, h >> 8);
+		}
+		break;
+	}
+	case Effects::Gradient: {
+		for (uint32_t p = 0; p < count; ++p) {
+			uint32_t level = (static_cast<uint64_t>(phase) * 510 / actor.period + p * 510 / count) % 510;
+			level = level > 255 ? 510 - level : level;
+			uint32_t c = led(p) * 3;
+			frame[c]     = actor.color.r + ((actor.secondary.r - actor.color.r) * static_cast<int>(level)) / 255;
+			frame[c + 1] = actor.color.g + ((actor.secondary.g - actor.color.g) * static_cast<int>(level)) / 255;
+			frame[c + 2] = actor.color.b + ((actor.secondary.b - actor.color.b) * static_cast<int>(level)) / 255;
+		}
+		break;
+	}
+	}
+}
+
+void PreviewEngine::setLed(uint32_t led, Color color, uint8_t level) {
+	uint32_t c = led * 3;
+	frame[c]     = color.r * level / 255;
+	frame[c + 1] = color.g * level / 255;
+	frame[c + 2] = color.b * level / 255;
+}
+
+uint32_t PreviewEngine::toSteps(float seconds) const {
+	return std::max<uint32_t>(1, seconds * fps);
+}
+
+void PreviewEngine::smooth(double& average, double value) {
+	average = average ? average + (value - average) * SMOOTHING : value;
+}
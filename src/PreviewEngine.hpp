@@ -0,0 +1,271 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      PreviewEngine.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Defaults.hpp"
+
+#include <chrono>
+
+#ifndef PREVIEWENGINE_HPP_
+#define PREVIEWENGINE_HPP_ 1
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::PreviewEngine
+ * Renders a virtual frame of every LED: the background and always on colors, the animation actors and the input triggers.
+ * Runs on a fixed timestep at the configured FPS, when late the frames in between are not rendered and count as dropped.
+ * Everything is allocated when the layout, the profile or the actors are set, rendering a frame does not allocate.
+ */
+class PreviewEngine {
+
+public:
+
+	/// Longest gap that is still counted, anything longer is a pause, like a hidden window.
+	static constexpr int64_t PAUSE = 500000;
+
+	/// Weight of the last frame in the averages.
+	static constexpr double SMOOTHING = 0.05;
+
+	struct Color {
+		uint8_t
+			r = 0,
+			g = 0,
+			b = 0;
+
+		/**
+		 * @param hex a RRGGBB color, invalid values are black.
+		 * @return
+		 */
+		static Color fromHex(const string& hex);
+	};
+
+	/**
+	 * Render stages, in order.
+	 */
+	enum Stages : uint8_t {
+		/// Background and always on elements.
+		BASE,
+		/// Animations.
+		ACTORS,
+		/// Input reactions.
+		TRIGGERS,
+		STAGES
+	};
+
+	struct Stats {
+		uint64_t
+			/// Rendered frames.
+			frames  = 0,
+			/// Frames due that were not rendered.
+			dropped = 0;
+		/// Microseconds to render a frame, average.
+		double frameTime = 0;
+		/// Microseconds to render a frame, worst.
+		double worstFrameTime = 0;
+		/// Microseconds per stage, average.
+		std::array<double, STAGES> stageTime{};
+	};
+
+	PreviewEngine() = default;
+
+	virtual ~PreviewEngine() = default;
+
+	/**
+	 * Sets the number of LEDs, removes the actors and triggers.
+	 * @param leds
+	 */
+	void setLayout(uint32_t leds);
+
+	/**
+	 * @return the number of LEDs.
+	 */
+	uint32_t getLeds() const;
+
+	/**
+	 * @param fps
+	 */
+	void setFps(uint16_t fps);
+
+	/**
+	 * Sets what is under the animations.
+	 * @param background
+	 * @param lit LED index and color of the always on elements.
+	 */
+	void setBase(Color background, const vector<std::pair<uint32_t, Color>>& lit);
+
+	/**
+	 * Adds an animation actor.
+	 * @param type one of Defaults::actorTypes.
+	 * @param leds the LEDs in the actor group, in order.
+	 * @param color
+	 * @param secondary the color to fade into, for gradients.
+	 * @param speed VeryFast, Fast, Normal, Slow or VerySlow.
+	 * @param backward
+	 * @return false if the type cannot be previewed.
+	 */
+	bool addActor(const string& type, const vector<uint32_t>& leds, Color color, Color secondary, const string& speed, bool backward);
+
+	/**
+	 * Removes the actors and triggers.
+	 */
+	void clearActors();
+
+	/**
+	 * Lights some LEDs on top of everything for a while.
+	 * @param leds
+	 * @param color
+	 * @param seconds
+	 */
+	void trigger(const vector<uint32_t>& leds, Color color, float seconds);
+
+	/**
+	 * Starts the clock again and clears the stats.
+	 */
+	void restart();
+
+	/**
+	 * Advances the clock and renders if a frame is due.
+	 * @param now monotonic time in microseconds.
+	 * @return true if a new frame was rendered.
+	 */
+	bool update(int64_t now);
+
+	/**
+	 * @return the last frame, RGB, 3 bytes per LED.
+	 */
+	const uint8_t* getFrame() const;
+
+	/**
+	 * @return
+	 */
+	const Stats& getStats() const;
+
+	/**
+	 * @param stats
+	 * @param fps
+	 * @return the stats as readable text.
+	 */
+	static string toString(const Stats& stats, uint16_t fps);
+
+protected:
+
+	using Clock = std::chrono::steady_clock;
+
+	enum class Effects : uint8_t {
+		Filler,
+		Pulse,
+		Serpentine,
+		Random,
+		Gradient
+	};
+
+	struct Actor {
+		Effects effect;
+		/// Range in actorLeds.
+		uint32_t
+			first,
+			count;
+		Color
+			color,
+			secondary;
+		float seconds;
+		/// Steps per cycle, from the seconds and FPS.
+		uint32_t period;
+		bool backward;
+	};
+
+	struct Trigger {
+		/// Range in triggerLeds.
+		uint32_t
+			first,
+			count;
+		Color color;
+		/// Last step when is visible.
+		uint64_t until;
+	};
+
+	uint32_t leds = 0;
+
+	uint16_t fps = 60;
+
+	/// Microseconds per step.
+	int64_t stepTime = 1000000 / 60;
+
+	/// Last update time, 0 when not started.
+	int64_t last = 0;
+
+	/// Time not used yet, always less than a step.
+	int64_t accumulated = 0;
+
+	/// Steps since the start.
+	uint64_t tick = 0;
+
+	vector<uint8_t>
+		/// Rendered base.
+		base,
+		/// The output.
+		frame;
+
+	vector<Actor> actors;
+
+	vector<uint32_t> actorLeds;
+
+	vector<Trigger> triggers;
+
+	vector<uint32_t> triggerLeds;
+
+	Stats stats;
+
+	/**
+	 * Renders one frame.
+	 */
+	void render();
+
+	/**
+	 * Renders one actor at the current tick.
+	 * @param actor
+	 */
+	void renderActor(const Actor& actor);
+
+	/**
+	 * @param led
+	 * @param color
+	 * @param level 0 to 255.
+	 */
+	void setLed(uint32_t led, Color color, uint8_t level = 255);
+
+	/**
+	 * @param seconds
+	 * @return the steps for that time, at least 1.
+	 */
+	uint32_t toSteps(float seconds) const;
+
+	/**
+	 * @param average
+	 * @param value
+	 */
+	static void smooth(double& average, double value);
+};
+
+} /* namespace */
+
+#endif /* PREVIEWENGINE_HPP_ */
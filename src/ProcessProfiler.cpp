@@ -0,0 +1,138 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ProcessProfiler.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ProcessProfiler.hpp"
+#include "Message.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <ctime>
+#include <cmath>
+#include <climits>
+#include <thread>
+#include <chrono>
+
+using namespace LEDSpicerUI;
+using Ui::Message;
+
+/**
+ * @param clock
+ * @return the clock time in microseconds.
+ */
+static double now(clockid_t clock) {
+	timespec ts;
+	clock_gettime(clock, &ts);
+	return ts.tv_sec * 1000000.0 + ts.tv_nsec / 1000.0;
+}
+
+ProcessProfiler::ProcessProfiler(const vector<string>& names, const string& procRoot) :
+	procRoot(procRoot)
+{
+	for (const auto& name : names) {
+		if (name.empty())
+			continue;
+		auto& n = *this->names.insert(name.substr(0, MAX_NAME)).first;
+		minSize = std::min(minSize, n.size());
+		maxSize = std::max(maxSize, n.size());
+	}
+}
+
+bool ProcessProfiler::matches(const char* name, size_t size) const {
+	if (size < minSize or size > maxSize)
+		return false;
+	return names.count(string(name, size));
+}
+
+void ProcessProfiler::scan(Result& result) const {
+	DIR* dir = opendir(procRoot.c_str());
+	if (not dir)
+		throw Message("Unable to read " + procRoot);
+
+	result.processes = 0;
+	result.matches   = 0;
+	char
+		path[PATH_MAX],
+		name[MAX_NAME + 2];
+	for (dirent* entry = readdir(dir); entry; entry = readdir(dir)) {
+		// Only process directories are numeric.
+		if (entry->d_name[0] < '1' or entry->d_name[0] > '9')
+			continue;
+		snprintf(path, sizeof(path), "%s/%s/comm", procRoot.c_str(), entry->d_name);
+		int fd = open(path, O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			continue;
+		ssize_t size = read(fd, name, sizeof(name));
+		close(fd);
+		if (size <= 0)
+			continue;
+		++result.processes;
+		if (name[size - 1] == '\n')
+			--size;
+		if (matches(name, size))
+			++result.matches;
+	}
+	closedir(dir);
+}
+
+ProcessProfiler::Result ProcessProfiler::profile(uint samples, uint runEvery, const std::atomic<bool>& cancel) const {
+	Result result;
+	samples  = std::max(samples, 1u);
+	runEvery = runEvery ? runEvery : DEFAULT_RUN_EVERY;
+	// Waits are sliced so a cancel is noticed quickly.
+	constexpr uint SLICE = 50;
+	uint done = 0;
+	double
+		cpu  = 0,
+		wall = 0;
+	for (; done < samples and not cancel; ++done) {
+		if (done)
+			for (uint waited = 0; waited < runEvery and not cancel; waited += SLICE)
+				std::this_thread::sleep_for(std::chrono::milliseconds(std::min(SLICE, runEvery - waited)));
+		if (cancel)
+			break;
+		// The caches are as cold as the daemon sees them after its wait.
+		const double
+			cpuStart  = now(CLOCK_THREAD_CPUTIME_ID),
+			wallStart = now(CLOCK_MONOTONIC);
+		scan(result);
+		cpu  += now(CLOCK_THREAD_CPUTIME_ID) - cpuStart;
+		wall += now(CLOCK_MONOTONIC) - wallStart;
+	}
+	if (done) {
+		result.cpuPerScan  = cpu / done;
+		result.wallPerScan = wall / done;
+	}
+	return result;
+}
+
+double ProcessProfiler::cpuUsage(double cpuPerScan, uint runEvery) {
+	return cpuPerScan / ((runEvery ? runEvery : DEFAULT_RUN_EVERY) * 1000.0);
+}
+
+uint ProcessProfiler::suggestRunEvery(double cpuPerScan, double budget) {
+	if (budget <= 0)
+		return DEFAULT_RUN_EVERY;
+	uint ms = std::ceil(cpuPerScan / budget / 1000.0);
+	return std::max((ms + 9) / 10 * 10, 10u);
+}
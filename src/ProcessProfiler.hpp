@@ -0,0 +1,129 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ProcessProfiler.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Defaults.hpp"
+
+#include <unordered_set>
+using std::unordered_set;
+
+#include <atomic>
+
+#ifndef PROCESSPROFILER_HPP_
+#define PROCESSPROFILER_HPP_ 1
+
+/// Where the running processes are listed.
+#define PROC_ROOT "/proc"
+
+/// Process lookup interval when none is set.
+#define DEFAULT_RUN_EVERY 1000
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::ProcessProfiler
+ * Scans the running processes the same way the process lookup does, to measure how much CPU every lookup costs.
+ * The proc root can be replaced with a fake directory to get reproducible results.
+ */
+class ProcessProfiler {
+
+public:
+
+	/// The kernel truncates process names to this size.
+	static constexpr size_t MAX_NAME = 15;
+
+	/**
+	 * Measured values.
+	 */
+	struct Result {
+		/// Average CPU time per scan, in microseconds.
+		double   cpuPerScan = 0;
+		/// Average wall time per scan, in microseconds.
+		double   wallPerScan = 0;
+		/// Processes found on every scan.
+		uint32_t processes  = 0;
+		/// Processes that matched a mapping.
+		uint32_t matches    = 0;
+	};
+
+	/**
+	 * @param names the process names to look for.
+	 * @param procRoot the directory with the processes.
+	 */
+	ProcessProfiler(const vector<string>& names, const string& procRoot = PROC_ROOT);
+
+	virtual ~ProcessProfiler() = default;
+
+	/**
+	 * Scans the processes once.
+	 * @param result processes and matches are stored here.
+	 * @throws Message if the proc root cannot be read.
+	 */
+	void scan(Result& result) const;
+
+	/**
+	 * Scans several times, waiting runEvery between scans like the daemon does, and averages the cost.
+	 * Only the CPU time of the calling thread is counted, run it on its own thread.
+	 * @param samples
+	 * @param runEvery milliseconds between scans, 0 for the default.
+	 * @param cancel checked while waiting, when set the scans done so far are averaged.
+	 * @return
+	 * @throws Message if the proc root cannot be read.
+	 */
+	Result profile(uint samples, uint runEvery, const std::atomic<bool>& cancel) const;
+
+	/**
+	 * @param cpuPerScan in microseconds.
+	 * @param runEvery in milliseconds.
+	 * @return the fraction of one CPU used by the lookup.
+	 */
+	static double cpuUsage(double cpuPerScan, uint runEvery);
+
+	/**
+	 * @param cpuPerScan in microseconds.
+	 * @param budget the fraction of one CPU the lookup can use.
+	 * @return the smallest interval, in milliseconds rounded up to tens, that keeps the lookup under the budget.
+	 */
+	static uint suggestRunEvery(double cpuPerScan, double budget);
+
+protected:
+
+	const string procRoot;
+
+	/// Names already truncated as the kernel reports them.
+	unordered_set<string> names;
+
+	/// Shortest and longest name, to skip comparisons.
+	size_t
+		minSize = MAX_NAME,
+		maxSize = 0;
+
+	/**
+	 * @param name
+	 * @return true if the name is one of the mappings.
+	 */
+	bool matches(const char* name, size_t size) const;
+};
+
+} /* namespace */
+
+#endif /* PROCESSPROFILER_HPP_ */
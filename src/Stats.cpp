@@ -0,0 +1,99 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Stats.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Stats.hpp"
+
+#include <fstream>
+
+using namespace LEDSpicerUI;
+
+std::array<std::atomic<uint64_t>, static_cast<uint8_t>(Stats::Counters::COUNT)> Stats::counters{};
+std::map<string, Stats::Records> Stats::records;
+
+uint64_t Stats::get(Counters counter) {
+	return counters[static_cast<uint8_t>(counter)].load(std::memory_order_relaxed);
+}
+
+void Stats::created(const string& type) {
+	++records[type].created;
+}
+
+void Stats::destroyed(const string& type) {
+	++records[type].destroyed;
+}
+
+const std::map<string, Stats::Records>& Stats::getRecords() {
+	return records;
+}
+
+size_t Stats::getMemory(bool peak) {
+	std::ifstream status("/proc/self/status");
+	const string key(peak ? "VmHWM:" : "VmRSS:");
+	string line;
+	while (std::getline(status, line)) {
+		if (line.compare(0, key.size(), key))
+			continue;
+		try {
+			return std::stoul(line.substr(key.size()));
+		}
+		catch (...) {
+			return 0;
+		}
+	}
+	return 0;
+}
+
+string Stats::toString(Counters counter) {
+	switch (counter) {
+	case Counters::XML_FILES:
+		return "XML files parsed";
+	case Counters::XML_BYTES:
+		return "XML bytes read";
+	case Counters::COLLECTION_NOTIFICATIONS:
+		return "Collection notifications";
+	case Counters::COMBO_REFRESHES:
+		return "Combo box repopulations";
+	case Counters::ROWS_REMOVED:
+		return "Flow box rows removed";
+	case Counters::WIDGETS_CREATED:
+		return "Widgets created";
+	case Counters::CSS_RELOADS:
+		return "CSS provider reloads";
+	default:
+		return "";
+	}
+}
+
+vector<std::pair<string, string>> Stats::createReport() {
+	vector<std::pair<string, string>> report;
+	for (uint8_t c = 0; c < static_cast<uint8_t>(Counters::COUNT); ++c)
+		report.emplace_back(toString(static_cast<Counters>(c)), std::to_string(get(static_cast<Counters>(c))));
+	for (const auto& r : records)
+		report.emplace_back(
+			r.first + " records",
+			std::to_string(r.second.created) + " created, " + std::to_string(r.second.destroyed) + " destroyed, " +
+			std::to_string(r.second.created - r.second.destroyed) + " alive"
+		);
+	report.emplace_back("Memory", std::to_string(getMemory(false)) + " KB");
+	report.emplace_back("Peak memory", std::to_string(getMemory(true)) + " KB");
+	return report;
+}
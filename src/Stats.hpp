@@ -0,0 +1,127 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Stats.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+using std::string;
+
+#include <vector>
+using std::vector;
+
+#include <map>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#ifndef STATS_HPP_
+#define STATS_HPP_ 1
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::Stats
+ * Always on counters for the editor hot paths, to tell if a slowdown comes from parsing, model churn or widget churn.
+ * Counters are relaxed atomics, the records by type are only touched by the main thread.
+ */
+class Stats {
+
+public:
+
+	enum class Counters : uint8_t {
+		XML_FILES,
+		XML_BYTES,
+		COLLECTION_NOTIFICATIONS,
+		COMBO_REFRESHES,
+		ROWS_REMOVED,
+		WIDGETS_CREATED,
+		CSS_RELOADS,
+		COUNT
+	};
+
+	/**
+	 * Records of a Storage type.
+	 */
+	struct Records {
+		uint64_t
+			created   = 0,
+			destroyed = 0;
+	};
+
+	Stats() = delete;
+
+	virtual ~Stats() = default;
+
+	/**
+	 * @param counter
+	 * @param amount
+	 */
+	static void add(Counters counter, uint64_t amount = 1) {
+		counters[static_cast<uint8_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @param counter
+	 * @return
+	 */
+	static uint64_t get(Counters counter);
+
+	/**
+	 * @param type
+	 */
+	static void created(const string& type);
+
+	/**
+	 * @param type
+	 */
+	static void destroyed(const string& type);
+
+	/**
+	 * @return the records by type.
+	 */
+	static const std::map<string, Records>& getRecords();
+
+	/**
+	 * @param peak true for the highest resident memory, false for the current one.
+	 * @return resident memory in KB, 0 if unknown.
+	 */
+	static size_t getMemory(bool peak);
+
+	/**
+	 * @param counter
+	 * @return a readable name.
+	 */
+	static string toString(Counters counter);
+
+	/**
+	 * @return every counter with its value.
+	 */
+	static vector<std::pair<string, string>> createReport();
+
+protected:
+
+	static std::array<std::atomic<uint64_t>, static_cast<uint8_t>(Counters::COUNT)> counters;
+
+	static std::map<string, Records> records;
+};
+
+} /* namespace */
+
+#endif /* STATS_HPP_ */
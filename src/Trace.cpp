@@ -0,0 +1,181 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Trace.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Trace.hpp"
+
+#include <fstream>
+#include <iostream>
+
+using namespace LEDSpicerUI;
+using Clock = std::chrono::steady_clock;
+
+std::atomic<bool> Trace::enabled(false);
+string Trace::fileName;
+uint Trace::mainThread = 0;
+std::atomic<int64_t> Trace::busySince(Trace::IDLE);
+std::atomic<uint64_t> Trace::iteration(0);
+string Trace::stallStack;
+const char* Trace::lastRoot = nullptr;
+GPollFunc Trace::originalPoll = nullptr;
+Clock::time_point Trace::origin;
+std::mutex Trace::mutex;
+vector<Trace::Event> Trace::events;
+vector<const char*> Trace::mainStack;
+std::thread Trace::watchdog;
+std::condition_variable Trace::watchdogWake;
+bool Trace::watchdogStop = false;
+
+Trace::Span::Span(const char* name) {
+	if (not enabled.load(std::memory_order_relaxed))
+		return;
+	this->name = name;
+	start      = Clock::now();
+	if (getThread() == mainThread) {
+		std::lock_guard<std::mutex> lock(mutex);
+		mainStack.push_back(name);
+	}
+}
+
+Trace::Span::~Span() {
+	if (not name)
+		return;
+	const auto end(Clock::now());
+	const uint thread = getThread();
+	std::lock_guard<std::mutex> lock(mutex);
+	events.push_back({name, thread, toMicroseconds(start), std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()});
+	if (thread == mainThread and not mainStack.empty()) {
+		mainStack.pop_back();
+		if (mainStack.empty())
+			lastRoot = name;
+	}
+}
+
+void Trace::start(const string& fileName) {
+	if (enabled)
+		return;
+	Trace::fileName = fileName;
+	origin          = Clock::now();
+	mainThread      = getThread();
+	events.clear();
+	mainStack.clear();
+	auto context(g_main_context_default());
+	originalPoll = g_main_context_get_poll_func(context);
+	g_main_context_set_poll_func(context, &Trace::poll);
+	watchdogStop = false;
+	watchdog     = std::thread(&Trace::watch);
+	enabled      = true;
+}
+
+bool Trace::stop() {
+	if (not enabled)
+		return true;
+	enabled = false;
+	g_main_context_set_poll_func(g_main_context_default(), originalPoll);
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		watchdogStop = true;
+	}
+	watchdogWake.notify_all();
+	watchdog.join();
+
+	std::ofstream file(fileName);
+	if (not file)
+		return false;
+	std::lock_guard<std::mutex> lock(mutex);
+	file << "{\"traceEvents\":[";
+	bool first = true;
+	for (const auto& event : events) {
+		file
+			<< (first ? "\n" : ",\n")
+			<< "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+			<< ",\"ts\":" << event.start << ",\"dur\":" << event.duration << "}";
+		first = false;
+	}
+	file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+	events.clear();
+	return static_cast<bool>(file);
+}
+
+bool Trace::isEnabled() {
+	return enabled;
+}
+
+int64_t Trace::toMicroseconds(Clock::time_point time) {
+	return std::chrono::duration_cast<std::chrono::microseconds>(time - origin).count();
+}
+
+uint Trace::getThread() {
+	static std::atomic<uint> next(1);
+	thread_local uint thread = next++;
+	return thread;
+}
+
+string Trace::createStack() {
+	string stack;
+	for (auto name : mainStack)
+		stack += (stack.empty() ? "" : " > ") + string(name);
+	return stack;
+}
+
+gint Trace::poll(GPollFD* fds, guint nfds, gint timeout) {
+	const int64_t since = busySince.exchange(IDLE);
+	if (since != IDLE) {
+		const int64_t duration = toMicroseconds(Clock::now()) - since;
+		if (duration > STALL_MS * 1000) {
+			std::lock_guard<std::mutex> lock(mutex);
+			events.push_back({"stall", mainThread, since, duration});
+			string stack(stallStack.empty() ? (lastRoot ? string("after ") + lastRoot : "untraced code") : stallStack);
+			std::cerr << "Main loop stalled " << duration / 1000 << " ms in " << stack << std::endl;
+		}
+	}
+	gint r = originalPoll(fds, nfds, timeout);
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stallStack.clear();
+		lastRoot = nullptr;
+	}
+	++iteration;
+	busySince = toMicroseconds(Clock::now());
+	return r;
+}
+
+void Trace::watch() {
+	uint64_t captured = 0, hung = 0;
+	std::unique_lock<std::mutex> lock(mutex);
+	while (not watchdogWake.wait_for(lock, std::chrono::milliseconds(STALL_MS / 4), [] { return watchdogStop; })) {
+		const int64_t since = busySince;
+		if (since == IDLE)
+			continue;
+		// Sample the open spans once per stall, and complain once if it never ends.
+		const int64_t busy = toMicroseconds(Clock::now()) - since;
+		const uint64_t current = iteration;
+		if (busy > STALL_MS * 1000 and captured != current) {
+			captured   = current;
+			stallStack = createStack();
+		}
+		if (busy > HUNG_MS * 1000 and hung != current) {
+			hung = current;
+			const string stack(createStack());
+			std::cerr << "Main loop blocked for more than " << HUNG_MS << " ms in " << (stack.empty() ? "untraced code" : stack) << std::endl;
+		}
+	}
+}
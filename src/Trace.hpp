@@ -0,0 +1,186 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Trace.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Defaults.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+
+#ifndef TRACE_HPP_
+#define TRACE_HPP_ 1
+
+#ifdef ENABLE_TRACE
+#define TRACE_CONCAT(a, b) a##b
+#define TRACE_NAME(line) TRACE_CONCAT(traceSpan, line)
+/// Traces the rest of the scope, name needs to be a literal.
+#define TRACE_SPAN(name) LEDSpicerUI::Trace::Span TRACE_NAME(__LINE__)(name)
+#else
+#define TRACE_SPAN(name)
+#endif
+
+namespace LEDSpicerUI {
+
+/**
+ * LEDSpicerUI::Trace
+ * Opt in instrumentation for slow editor operations.
+ * Spans are written as Chrome trace events (chrome://tracing or Perfetto) when the program ends,
+ * and a watchdog reports every main loop iteration longer than STALL_MS with the spans that were open.
+ * While disabled a span only checks a flag, built without ENABLE_TRACE spans do not exist.
+ */
+class Trace {
+
+public:
+
+	/// Main loop iterations above this are stalls, one frame at 60 FPS.
+	static constexpr uint STALL_MS = 16;
+
+	/// A stall this long is reported while it happens, the program may be hung.
+	static constexpr uint HUNG_MS = 1000;
+
+	/**
+	 * Times a scope.
+	 */
+	class Span {
+
+	public:
+
+		/**
+		 * @param name needs to outlive the trace, use literals.
+		 */
+		Span(const char* name);
+
+		virtual ~Span();
+
+	protected:
+
+		const char* name = nullptr;
+
+		std::chrono::steady_clock::time_point start;
+	};
+
+	Trace() = delete;
+
+	virtual ~Trace() = default;
+
+	/**
+	 * Starts tracing and the stall watchdog.
+	 * @param fileName where the events will be written.
+	 */
+	static void start(const string& fileName);
+
+	/**
+	 * Stops the watchdog and writes the events.
+	 * @return false if the file cannot be written.
+	 */
+	static bool stop();
+
+	/**
+	 * @return true when tracing.
+	 */
+	static bool isEnabled();
+
+protected:
+
+	/**
+	 * A finished span.
+	 */
+	struct Event {
+		const char* name;
+		/// Small sequential thread number.
+		uint   thread;
+		/// Microseconds since the trace started.
+		int64_t start;
+		int64_t duration;
+	};
+
+	static std::atomic<bool> enabled;
+
+	static string fileName;
+
+	/// The thread that runs the main loop.
+	static uint mainThread;
+
+	/// When the current main loop iteration left the poll, in microseconds, IDLE while polling.
+	static std::atomic<int64_t> busySince;
+
+	static constexpr int64_t IDLE = -1;
+
+	/// Main loop iterations, tells stalls apart.
+	static std::atomic<uint64_t> iteration;
+
+	/// The spans the watchdog found open during the current stall.
+	static string stallStack;
+
+	/// The last main thread span that closed with no parent, the culprit when the watchdog missed it.
+	static const char* lastRoot;
+
+	static GPollFunc originalPoll;
+
+	static std::thread watchdog;
+
+	static std::condition_variable watchdogWake;
+
+	static bool watchdogStop;
+
+	static std::chrono::steady_clock::time_point origin;
+
+	static std::mutex mutex;
+
+	/// Finished spans, written at the end.
+	static vector<Event> events;
+
+	/// Spans open in the main thread, the watchdog reads them.
+	static vector<const char*> mainStack;
+
+	/**
+	 * @param time
+	 * @return microseconds since the trace started.
+	 */
+	static int64_t toMicroseconds(std::chrono::steady_clock::time_point time);
+
+	/**
+	 * @return the current thread number.
+	 */
+	static uint getThread();
+
+	/**
+	 * @return the open main thread spans, like "import > createItems".
+	 */
+	static string createStack();
+
+	/**
+	 * Replaces the main context poll, the time outside the poll is the time spent in handlers.
+	 */
+	static gint poll(GPollFD* fds, guint nfds, gint timeout);
+
+	/**
+	 * Watchdog loop, reports a stall while it happens.
+	 */
+	static void watch();
+};
+
+} /* namespace */
+
+#endif /* TRACE_HPP_ */
@@ -1,6 +1,6 @@
 /* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
 /**
- * @file      AnimationDialog.cpp
+ * @file      DialogAnimation.cpp
  * @since     Feb 14, 2023
  * @author    Patricio A. Rossi (MeduZa)
  *
@@ -24,15 +24,233 @@
 
 using namespace LEDSpicerUI::Ui::DataDialogs;
 
+DialogAnimation* DialogAnimation::instance = nullptr;
 
-void DialogAnimation::resetFields() {
+void DialogAnimation::initialize(Glib::RefPtr<Gtk::Builder> const &builder) {
+	if (not instance) {
+		builder->get_widget_derived("DialogAnimation", instance);
+	}
+}
 
+DialogAnimation* DialogAnimation::getInstance() {
+	return instance;
 }
 
-void DialogAnimation::setFields(unordered_map<string, string> parameters) {
+DialogAnimation::DialogAnimation(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builder>& builder) :
+	DialogForm(obj, builder),
+	actors(Gtk::ListStore::create(columns))
+{
+
+	// Connect Animations Box and buttons.
+	builder->get_widget_derived("BoxAnimations", box);
+	builder->get_widget("BtnAddAnimation",       btnAdd);
+	builder->get_widget("BtnApplyAnimation",     btnApply);
+	btnAdd->signal_clicked().connect(sigc::mem_fun(*this, &DialogAnimation::onAddClicked));
+	setSignalApply();
+
+	// Animation fields.
+	set_default_size(700, 400);
+	auto form = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_VERTICAL, 5);
+	form->get_style_context()->add_class("formContainer");
+	get_content_area()->pack_start(*form);
+
+	auto nameBox = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_HORIZONTAL, 5);
+	nameBox->pack_start(*Gtk::make_managed<Gtk::Label>("Name"), Gtk::PACK_SHRINK);
+	inputAnimationName = Gtk::make_managed<Gtk::Entry>();
+	nameBox->pack_start(*inputAnimationName);
+	form->pack_start(*nameBox, Gtk::PACK_SHRINK);
+
+	actorsView.set_model(actors);
+	actorsView.append_column_editable("Actor",      columns.type);
+	actorsView.append_column_editable("Group",      columns.target);
+	actorsView.append_column_editable("Parameters", columns.parameters);
+	actorsView.set_tooltip_text("Actors: " + Defaults::implode(Defaults::actorTypes, ',') + "\nParameters are name=\"value\" separated by spaces");
+	for (auto column : actorsView.get_columns())
+		column->set_resizable(true);
+	auto scroll = Gtk::make_managed<Gtk::ScrolledWindow>();
+	scroll->add(actorsView);
+	form->pack_start(*scroll);
 
+	auto buttons = Gtk::make_managed<Gtk::ButtonBox>();
+	buttons->set_layout(Gtk::ButtonBoxStyle::BUTTONBOX_START);
+	auto btnAddActor    = Gtk::make_managed<Gtk::Button>("Add Actor");
+	auto btnRemoveActor = Gtk::make_managed<Gtk::Button>("Remove Actor");
+	btnAddActor->get_style_context()->add_class("backgroundGreen");
+	btnRemoveActor->get_style_context()->add_class("backgroundRed");
+	buttons->pack_start(*btnAddActor);
+	buttons->pack_start(*btnRemoveActor);
+	form->pack_start(*buttons, Gtk::PACK_SHRINK);
+
+	btnAddActor->signal_clicked().connect([&]() {
+		auto row(*actors->append());
+		row[columns.type] = Defaults::actorTypes.front();
+		auto groups(Storage::CollectionHandler::getInstance(COLLECTION_GROUP));
+		if (groups->getSize())
+			row[columns.target] = groups->get().front();
+	});
+	btnRemoveActor->signal_clicked().connect([&]() {
+		auto selected(actorsView.get_selection()->get_selected());
+		if (selected)
+			actors->erase(selected);
+	});
+	form->show_all();
+}
+
+void DialogAnimation::load(XMLHelper* values) {
+	// Only the names, the files are read when edited.
+	vector<unordered_map<string, string>> rawCollection;
+	for (const string& name : AnimationCatalogue::getNames()) {
+		for (const string& target : AnimationCatalogue::find(name)->targets)
+			if (not Storage::CollectionHandler::getInstance(COLLECTION_GROUP)->isUsed(target))
+				Diagnostics::warning("Animation uses the missing group " + target, name);
+		rawCollection.push_back({{NAME, name}});
+	}
+	createItems(rawCollection, values);
 }
 
-unordered_map<string, string> DialogAnimation::readFields() {
+void DialogAnimation::import(const string& fileName) {
+	AnimationFile file(fileName);
+	// A name clash gets a number, like clone does.
+	string name(AnimationFile::extractName(fileName));
+	uint8_t count = 0;
+	while (animationHandler->isUsed(name + (count ? std::to_string(count) : "")))
+		++count;
+	name += count ? std::to_string(count) : "";
+	// A never saved animation, the actors come from the imported file.
+	unordered_map<string, string> empty;
+	auto animation(new Storage::Animation(empty));
+	animation->setValue(NAME, name);
+	animation->setActors(std::move(file.getData(COLLECTION_ANIMATIONS)));
+	animationHandler->add(name);
+	auto bPtr = items->add(animation);
+	addButtons(bPtr);
+	box->add(*bPtr);
+	bPtr->updateLabel();
+	currentData = animation;
+	notifyChanged("");
+	currentData = nullptr;
+}
+
+void DialogAnimation::clearForm() {
+	inputAnimationName->set_text("");
+	actors->clear();
+}
+
+const string DialogAnimation::validate() const {
+	string name(createUniqueId());
+	if (name.empty() or name.find('/') != string::npos) {
+		if (mode != Modes::LOAD)
+			inputAnimationName->grab_focus();
+		return "Invalid animation name.";
+	}
+
+	// If is not edit, or data is not the same, check for dupes.
+	if (animationHandler->isUsed(name)) {
+		if (mode != Modes::EDIT or currentData->createUniqueId() != name) {
+			if (mode != Modes::LOAD)
+				inputAnimationName->grab_focus();
+			return "Animation with name " + name + " already exist.";
+		}
+	}
+
+	// Loaded animations are checked when opened.
+	if (mode == Modes::LOAD)
+		return "";
+
+	if (actors->children().empty())
+		return "Add at least one actor.";
+
+	size_t number = 0;
+	for (const auto& row : actors->children()) {
+		++number;
+		string error(validateActor(row));
+		if (not error.empty())
+			return "Actor " + std::to_string(number) + ": " + error;
+	}
+	return "";
+}
+
+void DialogAnimation::storeData() {
+	if (mode == Modes::EDIT)
+		animationHandler->replace(currentData->createUniqueId(), createUniqueId());
+	else
+		animationHandler->add(createUniqueId());
+
+	currentData->setValue(NAME, createUniqueId());
+	// Loading keeps the file untouched.
+	if (mode != Modes::LOAD)
+		dynamic_cast<Storage::Animation*>(currentData)->setActors(readActors());
+}
+
+void DialogAnimation::retrieveData() {
+	inputAnimationName->set_text(currentData->getValue(NAME));
+	if (mode == Modes::LOAD)
+		return;
+
+	try {
+		for (const auto& actor : dynamic_cast<Storage::Animation*>(currentData)->getActors()) {
+			auto row(*actors->append());
+			row[columns.type]   = XMLHelper::valueOf(actor, TYPE);
+			row[columns.target] = XMLHelper::valueOf(actor, ACTOR_TARGET);
+			std::map<string, string> sorted(actor.begin(), actor.end());
+			sorted.erase(TYPE);
+			sorted.erase(ACTOR_TARGET);
+			vector<string> parameters;
+			for (const auto& p : sorted)
+				parameters.push_back(p.first + "=\"" + p.second + "\"");
+			row[columns.parameters] = Defaults::implode(parameters, ' ');
+		}
+	}
+	catch (Message& e) {
+		Message::displayError(XMLHelper::cleanError(e.getMessage()), this);
+	}
+}
+
+string const DialogAnimation::createUniqueId() const {
+	return inputAnimationName->get_text();
+}
+
+const string DialogAnimation::getType() const {
+	return "animation";
+}
+
+LEDSpicerUI::Ui::Storage::Data* DialogAnimation::getData(unordered_map<string, string>& rawData) {
+	return new Storage::Animation(rawData);
+}
+
+vector<unordered_map<string, string>> DialogAnimation::readActors() const {
+	vector<unordered_map<string, string>> r;
+	for (const auto& row : actors->children()) {
+		unordered_map<string, string> actor{
+			{TYPE,         row.get_value(columns.type)},
+			{ACTOR_TARGET, row.get_value(columns.target)}
+		};
+		// name="value" pairs, the quotes are optional.
+		for (const string& parameter : Defaults::explode(row.get_value(columns.parameters), ' ')) {
+			auto pos(parameter.find('='));
+			if (pos == string::npos)
+				continue;
+			string value(parameter.substr(pos + 1));
+			if (value.size() > 1 and value.front() == '"' and value.back() == '"')
+				value = value.substr(1, value.size() - 2);
+			actor.emplace(parameter.substr(0, pos), value);
+		}
+		r.push_back(std::move(actor));
+	}
+	return r;
+}
+
+string DialogAnimation::validateActor(const Gtk::TreeModel::Row& row) const {
+	const string type(row.get_value(columns.type));
+	if (std::find(Defaults::actorTypes.begin(), Defaults::actorTypes.end(), type) == Defaults::actorTypes.end())
+		return "Invalid actor type " + type + ".";
+
+	const string target(row.get_value(columns.target));
+	if (not Storage::CollectionHandler::getInstance(COLLECTION_GROUP)->isUsed(target))
+		return "Missing group " + target + ".";
 
+	for (const string& parameter : Defaults::explode(row.get_value(columns.parameters), ' '))
+		if (not parameter.empty() and parameter.find('=') == string::npos)
+			return "Invalid parameter " + parameter + ", use name=value.";
+	return "";
 }
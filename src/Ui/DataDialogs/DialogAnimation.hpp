@@ -20,32 +20,112 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "DialogForm.hpp"
+#include "Storage/Animation.hpp"
+
 #ifndef UI_DIALOGANIMATION_HPP_
 #define UI_DIALOGANIMATION_HPP_ 1
 
-#include "DialogForm.hpp"
+#define animationHandler Storage::CollectionHandler::getInstance(COLLECTION_ANIMATIONS)
 
 namespace LEDSpicerUI::Ui::DataDialogs {
 
 /**
  * LEDSpicerUI::Ui::DialogAnimation
  * Dialog to create and edit animations.
+ * The actors are read from disk only when an animation is edited.
  */
 class DialogAnimation: public DialogForm {
 
+	friend class Gtk::Builder;
+
 public:
 
-	using DialogForm::DialogForm;
+	DialogAnimation() = delete;
 
 	virtual ~DialogAnimation() = default;
 
-	void resetFields();
+	/**
+	 * Instanciate an object of its class.
+	 * @param builder
+	 */
+	static void initialize(Glib::RefPtr<Gtk::Builder> const &builder);
+
+	/**
+	 * Return an instance of this class.
+	 * @return
+	 */
+	static DialogAnimation* getInstance();
+
+	/**
+	 * Creates the items from the animations catalogue, values are not used.
+	 * @param values
+	 */
+	void load(XMLHelper* values) override;
+
+	/**
+	 * Adds an animation file from outside the project, it will be written with the project.
+	 * @param fileName
+	 * @throws Message if the file cannot be read.
+	 */
+	void import(const string& fileName);
+
+	void clearForm() override;
+
+	const string validate() const override;
+
+	void storeData() override;
+
+	void retrieveData() override;
+
+	const string createUniqueId() const override;
+
+protected:
+
+	/// Self instance.
+	static DialogAnimation* instance;
+
+	/**
+	 * Actors list columns.
+	 */
+	class Columns : public Gtk::TreeModelColumnRecord {
+	public:
+		Columns() {
+			add(type);
+			add(target);
+			add(parameters);
+		}
+		Gtk::TreeModelColumn<string> type;
+		Gtk::TreeModelColumn<string> target;
+		/// Any other attribute, as name=value separated by spaces.
+		Gtk::TreeModelColumn<string> parameters;
+	};
+
+	Columns columns;
+
+	Glib::RefPtr<Gtk::ListStore> actors;
+
+	Gtk::Entry* inputAnimationName = nullptr;
+
+	Gtk::TreeView actorsView;
+
+	DialogAnimation(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builder>& builder);
+
+	const string getType() const override;
 
-	void readFields();
+	Storage::Data* getData(unordered_map<string, string>& rawData) override;
 
-	void setFields(unordered_map<string, string> parameters);
+	/**
+	 * @return the actors in the form.
+	 */
+	vector<unordered_map<string, string>> readActors() const;
 
-	unordered_map<string, string> readFields();
+	/**
+	 * Checks one actor row.
+	 * @param row
+	 * @return empty if valid, otherwise the reason why is not.
+	 */
+	string validateActor(const Gtk::TreeModel::Row& row) const;
 
 };
 
@@ -69,8 +69,8 @@ DialogDevice::DialogDevice(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builder>
 	row.set_value(2, false);
 	for (auto& d : Defaults::devicesInfo) {
 		row = *(devicesListstore->append());
-		row.set_value(0, d.first);
-		row.set_value(1, d.second.name);
+		row.set_value(0, string(d.id));
+		row.set_value(1, string(d.name));
 		row.set_value(2, true);
 	}
 
@@ -97,7 +97,8 @@ DialogDevice::DialogDevice(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builder>
 			return;
 		}
 
-		const uint8_t pins(Defaults::devicesInfo.at(name).pins);
+		const Defaults::DeviceType type(Defaults::getDeviceType(name));
+		const uint8_t pins(Defaults::getInfo(type).pins);
 		const string currentName(currentData->getValue(NAME));
 		// If there is not ID or is loading, process a changed device due to Load or new selected device for Add.
 		if (currentName.empty() or mode == Modes::LOAD) {
@@ -120,33 +121,33 @@ DialogDevice::DialogDevice(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builder>
 
 		previousName = name;
 
-		if (Defaults::isIdUser(name)) {
+		if (Defaults::isIdUser(type)) {
 			Defaults::populateComboBoxWithIds(
 				idListstore,
-				Defaults::devicesInfo.at(name).maxIds,
+				Defaults::getInfo(type).maxIds,
 				[=](const string& id) {
-					return devicesHandler->isUsed(Defaults::createHardwareUniqueId({{NAME, name}, {ID, id}}));
+					return isHardwareUsed(Defaults::createHardwareKey(type, id, ""));
 				},
 				"Device Hardware Number",
 				"Hardware #"
 			);
 			comboBoxId->get_parent()->show();
 		}
-		if (Defaults::isSerial(name)) {
+		if (Defaults::isSerial(type)) {
 			inputDevicePort->get_parent()->show();
 		}
 
-		if (Defaults::isMonocrome(name)) {
+		if (Defaults::isMonocrome(type)) {
 			changePoint->get_parent()->show();
 		}
 
-		if (Defaults::isVariable(name)) {
+		if (Defaults::isVariable(type)) {
 			spinnerLeds->get_parent()->show();
 			spinnerLeds->get_adjustment()->set_upper(pins);
 		}
 		DataDialogs::DialogElement::getInstance()->changeNumberOfPins(pins);
 		btnAddElement->set_sensitive(true);
-		breaf->set_text(Defaults::devicesInfo.at(name).breaf);
+		breaf->set_text(Defaults::getInfo(type).breaf);
 		btnApply->set_sensitive(true);
 	});
 }
@@ -178,7 +179,7 @@ void DialogDevice::clearFormOthers() {
 	DataDialogs::DialogElement::getInstance()->changeNumberOfPins(0);
 }
 
-void DialogDevice::isValid() const {
+const string DialogDevice::validate() const {
 
 	string
 		name(comboBoxDevices->get_active_id()),
@@ -187,47 +188,49 @@ void DialogDevice::isValid() const {
 
 	bool checkDupe = true;
 
-	if (name.empty()) {
-		throw Message("Invalid device");
+	const Defaults::DeviceType type(Defaults::getDeviceType(name));
+	if (type == Defaults::DeviceType::invalid) {
+		return "Invalid device";
 	}
 
 	/*if (Defaults::isSerial(name)) {
 		// Serial can be empty only once per device.
 		if (port.empty()) {
 			inputDevicePort->grab_focus();
-			throw Message("You need to enter a serial port\n");
+			return "You need to enter a serial port\n";
 		}
 	}*/
 
-	if (Defaults::isIdUser(name) and id.empty()) {
-		throw Message("Invalid device number");
+	if (Defaults::isIdUser(type) and id.empty()) {
+		return "Invalid device number";
 	}
 
-	if (Defaults::isVariable(name)) {
+	if (Defaults::isVariable(type)) {
 		string pins(spinnerLeds->get_text());
-		if (not Defaults::isBetween(pins, 1, Defaults::devicesInfo.at(name).pins)) {
+		if (not Defaults::isBetween(pins, 1, Defaults::getInfo(type).pins)) {
 			if (mode != Modes::LOAD)
 				spinnerLeds->grab_focus();
-			throw Message("The number of pins need to be between one and the number of pins the device allows (" + std::to_string(Defaults::devicesInfo.at(name).pins) + ")");
+			return "The number of pins need to be between one and the number of pins the device allows (" + std::to_string(Defaults::getInfo(type).pins) + ")";
 		}
 	}
 
-	string
-		newName(createUniqueId()),
-		deviceName("Device " + Defaults::devicesInfo.at(name).name);
+	const Defaults::HardwareKey newKey(Defaults::createHardwareKey(type, id, port));
+	const string deviceName(string("Device ") + Defaults::getInfo(type).name);
 	if (mode == Modes::EDIT) {
-		checkDupe = (currentData->createUniqueId() != newName);
+		checkDupe = (dynamic_cast<Storage::Device*>(currentData)->getHardwareKey() != newKey);
 	}
+	checkDupe = checkDupe and isHardwareUsed(newKey);
 
-	if (Defaults::isIdUser(name) and checkDupe and devicesHandler->isUsed(newName)) {
-		throw Message(deviceName + " ID " + id + " already exists");
+	if (Defaults::isIdUser(type) and checkDupe) {
+		return deviceName + " ID " + id + " already exists";
 	}
-	if (Defaults::isSerial(name) and checkDupe and devicesHandler->isUsed(newName)) {
-		throw Message(deviceName + " that connects to " + (port.empty() ? "<autodetect>" : port) + " already exists");
+	if (Defaults::isSerial(type) and checkDupe) {
+		return deviceName + " that connects to " + (port.empty() ? "<autodetect>" : port) + " already exists";
 	}
-	if (checkDupe and devicesHandler->isUsed(newName)) {
-		throw Message(deviceName + " already exists");
+	if (checkDupe) {
+		return deviceName + " already exists";
 	}
+	return "";
 }
 
 void DialogDevice::storeData() {
@@ -242,53 +245,55 @@ void DialogDevice::storeData() {
 	currentData->wipe();
 
 	const string name(comboBoxDevices->get_active_id());
+	const Defaults::DeviceType type(Defaults::getDeviceType(name));
 
 	currentData->setValue(NAME, name);
-	if (Defaults::isIdUser(name)) {
+	if (Defaults::isIdUser(type)) {
 		currentData->setValue(ID, comboBoxId->get_active_id());
 	}
 
-	if (Defaults::isSerial(name)) {
+	if (Defaults::isSerial(type)) {
 		currentData->setValue(PORT, inputDevicePort->get_text());
 	}
 
-	if (Defaults::isVariable(name)) {
+	if (Defaults::isVariable(type)) {
 		currentData->setValue(PINS, spinnerLeds->get_text());
 	}
 
-	if (Defaults::isMonocrome(name)) {
+	if (Defaults::isMonocrome(type)) {
 		currentData->setValue(CHANGE_POINT, std::to_string(static_cast<uint8_t>(changePoint->get_value())));
 	}
+	dynamic_cast<Storage::Device*>(currentData)->resolveType();
 	DataDialogs::DialogElement::getInstance()->reindex();
 }
 
 void DialogDevice::retrieveData() {
 
-	const string name(currentData->getValue(NAME));
+	const Defaults::DeviceType type(dynamic_cast<Storage::Device*>(currentData)->getType());
 
-	comboBoxDevices->set_active_id(name);
+	comboBoxDevices->set_active_id(currentData->getValue(NAME));
 
-	if (Defaults::isIdUser(name)) {
+	if (Defaults::isIdUser(type)) {
 		comboBoxId->set_active_id(currentData->getValue(ID));
 	}
-	if (Defaults::isSerial(name)) {
+	if (Defaults::isSerial(type)) {
 		inputDevicePort->set_text(currentData->getValue(PORT));
 	}
-	if (Defaults::isVariable(name)) {
+	if (Defaults::isVariable(type)) {
 		spinnerLeds->set_text(currentData->getValue(PINS));
 	}
-	if (Defaults::isMonocrome(name)) {
+	if (Defaults::isMonocrome(type)) {
 		changePoint->set_value(std::stod(currentData->getValue(CHANGE_POINT, std::to_string(DEFAULT_CHANGE_VALUE))));
 	}
 	markDevicesUsed();
 }
 
 string const DialogDevice::createUniqueId() const {
-	return Defaults::createHardwareUniqueId({
-		{NAME, comboBoxDevices->get_active_id()},
-		{ID,   comboBoxId->get_active_id()},
-		{PORT, inputDevicePort->get_text()}
-	});
+	return Defaults::createHardwareUniqueId(
+		Defaults::getDeviceType(comboBoxDevices->get_active_id()),
+		comboBoxId->get_active_id(),
+		inputDevicePort->get_text()
+	);
 }
 
 const string DialogDevice::getType() const {
@@ -300,19 +305,29 @@ LEDSpicerUI::Ui::Storage::Data* DialogDevice::getData(unordered_map<string, stri
 }
 
 void DialogDevice::markDevicesUsed() {
-	for (auto& di : Defaults::devicesInfo) {
-		const uint total    = devicesHandler->count(di.first);
-		const auto& children = devicesListstore->children();
-
-		for (auto iter = children.begin(); iter != children.end(); ++iter) {
-			Gtk::TreeModel::Row dataRow = *iter;
-
-			string data;
-			dataRow.get_value(0, data);
-			if (data == di.first) {
-				dataRow.set_value(2, total < di.second.maxIds);
-				break;
-			}
-		}
+	// count used devices per type.
+	std::array<uint, Defaults::devicesInfo.size()> totals{};
+	for (auto i : *items) {
+		auto type(dynamic_cast<Storage::Device*>(i->getData())->getType());
+		if (type != Defaults::DeviceType::invalid)
+			++totals[static_cast<uint8_t>(type)];
+	}
+	const auto& children = devicesListstore->children();
+	for (auto iter = children.begin(); iter != children.end(); ++iter) {
+		Gtk::TreeModel::Row dataRow = *iter;
+
+		string data;
+		dataRow.get_value(0, data);
+		const Defaults::DeviceType type(Defaults::getDeviceType(data));
+		if (type != Defaults::DeviceType::invalid)
+			dataRow.set_value(2, totals[static_cast<uint8_t>(type)] < Defaults::getInfo(type).maxIds);
+	}
+}
+
+bool DialogDevice::isHardwareUsed(Defaults::HardwareKey key) const {
+	for (auto i : *items) {
+		if (i->getData() != currentData and dynamic_cast<Storage::Device*>(i->getData())->getHardwareKey() == key)
+			return true;
 	}
+	return false;
 }
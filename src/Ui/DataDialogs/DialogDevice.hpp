@@ -60,7 +60,7 @@ public:
 
 	void clearForm() override;
 
-	void isValid() const override;
+	const string validate() const override;
 
 	void storeData() override;
 
@@ -104,6 +104,13 @@ protected:
 	 * Marks a device disabled if it depleted all its IDs.
 	 */
 	void markDevicesUsed();
+
+	/**
+	 * Checks if any other device uses the same hardware.
+	 * @param key
+	 * @return true if the key is used.
+	 */
+	bool isHardwareUsed(Defaults::HardwareKey key) const;
 };
 
 } /* namespace */
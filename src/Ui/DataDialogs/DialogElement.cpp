@@ -47,8 +47,10 @@ DialogElement::DialogElement(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builde
 	setSignalAdd();
 	setSignalApply();
 
+	enableBulkEdit();
+
 	// Pins layout.
-	builder->get_widget("FlowBoxPinLayout", pinsBox);
+	builder->get_widget_derived("PinLayout", pinLayout);
 
 	// Fields.
 	builder->get_widget("pin",  pin);
@@ -152,13 +154,13 @@ void DialogElement::clearForm() {
 	drawPins();
 }
 
-void DialogElement::isValid() const {
+const string DialogElement::validate() const {
 	// Check invalid name
 	string name(createUniqueId());
 	if (name.empty()) {
 		if (mode != Modes::LOAD)
 			inputElementName->grab_focus();
-		throw Message("Missing element name");
+		return "Missing element name";
 	}
 
 	// If is not edit, or data is not the same, check for dupes.
@@ -166,13 +168,13 @@ void DialogElement::isValid() const {
 		if (mode != Modes::EDIT or currentData->createUniqueId() != name) {
 			if (mode != Modes::LOAD)
 				inputElementName->grab_focus();
-			throw Message("Element with name " + name + " already exist");
+			return "Element with name " + name + " already exist";
 		}
 	}
 
 	// Check missing type.
 	/*if (inputElementType->get_active_id() == "0")
-		throw Message("Missing element type");*/
+		return "Missing element type";*/
 
 
 	// Check for changes against old values.
@@ -186,22 +188,23 @@ void DialogElement::isValid() const {
 	};
 
 	// Check for pin errors.
-	std::function<void(Gtk::Entry*)> checkPin = [&](Gtk::Entry* pin) {
+	std::function<string(Gtk::Entry*)> checkPin = [&](Gtk::Entry* pin) -> string {
 		string p(pin->get_text());
 		string name(pin->get_placeholder_text());
 		// Check empty.
 		if (p.empty()) {
 			if (mode != Modes::LOAD)
 				pin->grab_focus();
-			throw Message("Enter a valid pin number for " + name);
+			return "Enter a valid pin number for " + name;
 		}
 
 		// Numeric check and range.
 		if (not Defaults::isBetween(p, 1, numberOfPins)) {
 			if (mode != Modes::LOAD)
 				pin->grab_focus();
-			throw Message("The " + name + " must be a number from 1 and " + std::to_string(numberOfPins));
+			return "The " + name + " must be a number from 1 and " + std::to_string(numberOfPins);
 		}
+		return "";
 	};
 
 	if (pin->get_text().empty()) {
@@ -211,7 +214,7 @@ void DialogElement::isValid() const {
 			pinG->get_text().empty() and
 			pinB->get_text().empty()
 		) {
-			throw Message("Missing element pin out information");
+			return "Missing element pin out information";
 		}
 		// RGB checks
 		for (auto e: {pinR, pinG, pinB}) {
@@ -222,7 +225,7 @@ void DialogElement::isValid() const {
 					if (found) {
 						if (mode != Modes::LOAD)
 							pin->grab_focus();
-						throw Message("Pin " + p->get_text() + " is set more than once");
+						return "Pin " + p->get_text() + " is set more than once";
 					}
 					found = true;
 				}
@@ -234,14 +237,18 @@ void DialogElement::isValid() const {
 			}
 			// Value is new or changed.
 			if (not found) {
-				checkPin(e);
+				string error(checkPin(e));
+				if (not error.empty())
+					return error;
 			}
 		}
 	}
 	else {
 		// Check for changes, solenoid or pin.
 		if (mode != Modes::EDIT or not checkOld(pin)) {
-			checkPin(pin);
+			string error(checkPin(pin));
+			if (not error.empty())
+				return error;
 		}
 
 		// Check solenoid field.
@@ -252,9 +259,10 @@ void DialogElement::isValid() const {
 		) {
 			if (mode != Modes::LOAD)
 				timeOn->grab_focus();
-			throw Message("Enter a number for the milliseconds.");
+			return "Enter a number for the milliseconds.";
 		}
 	}
+	return "";
 }
 
 void DialogElement::storeData() {
@@ -352,42 +360,14 @@ void DialogElement::changeNumberOfPins(const uint8_t newSize) {
 		if (not deleted.empty())
 			Message::displayInfo("Element(s) " + deleted + "have been deleted due to resizing.");
 	}
-	pinsBox->set_max_children_per_line(findLargestDivisor(newSize));
 	numberOfPins = newSize;
+	pinLayout->setPins(numberOfPins, findLargestDivisor(numberOfPins));
 	drawPins();
 }
 
 void DialogElement::drawPins() {
-
-	for (auto& child : pinsBox->get_children())
-		pinsBox->remove(*child);
-
-	// Fill pins.
-	for (auto c = 1; c <= numberOfPins; ++c) {
-		auto label = Gtk::make_managed<Gtk::Label>(std::to_string(c));
-		vector<Storage::BoxButton*> elementsUse;
-		findElementsByPin(std::to_string(c), elementsUse);
-		string labelTxt("Pin " + std::to_string(c) + " is used by element ");
-		vector<string> elementsTxt;
-		for (auto bb : elementsUse)
-			elementsTxt.push_back(bb->getData()->getValue(NAME));
-		if (elementsUse.size() > 1) {
-			label->get_style_context()->add_class(COLOR_MULTIPLE);
-			std::string lastElement = std::move(elementsTxt.back());
-			elementsTxt.pop_back();
-			label->set_tooltip_text(labelTxt + Defaults::implode(elementsTxt, ", ") + " and " + lastElement);
-		}
-		else if (elementsUse.size()) {
-			label->get_style_context()->add_class(Storage::Element::getPinCssByData(c, elementsUse[0]->getData()));
-			label->set_tooltip_text(labelTxt + elementsTxt[0]);
-		}
-		else {
-			label->get_style_context()->add_class(NO_COLOR);
-			label->set_tooltip_text("Pin " + std::to_string(c) + " is not used");
-		}
-		pinsBox->add(*label);
-	}
-	pinsBox->show_all();
+	if (items)
+		pinLayout->update(*items);
 }
 
 const string DialogElement::getType() const {
@@ -405,6 +385,82 @@ void DialogElement::addButtons(Storage::BoxButton* boxButton) {
 	boxButton->show_all();
 }
 
+void DialogElement::createBulkMenu(Gtk::Menu* menu, const vector<Storage::BoxButton*>& selected) {
+	addMenuItem(menu, "Set default color", [&, selected]() {
+		string color;
+		if (DialogColors::getInstance()->pickColor(color))
+			bulkEdit(selected, [&color](unordered_map<string, string>& values) {
+				if (color.empty())
+					values.erase(DEFAULT_COLOR);
+				else
+					values[DEFAULT_COLOR] = color;
+			});
+	});
+
+	// The types are the ones from the form.
+	auto types(Gtk::make_managed<Gtk::Menu>());
+	for (const auto& row : inputElementType->get_model()->children()) {
+		Glib::ustring text, id;
+		row.get_value(0, text);
+		row.get_value(1, id);
+		if (id == "0")
+			continue;
+		addMenuItem(types, text, [&, selected, id]() {
+			bulkEdit(selected, [&id](unordered_map<string, string>& values) {
+				values[TYPE] = id;
+			});
+		});
+	}
+	addMenuItem(menu, "Set type")->set_submenu(*types);
+
+	addMenuItem(menu, "Shift pins", [&, selected]() {
+		int offset = askPinOffset();
+		if (not offset)
+			return;
+		bulkEdit(selected, [offset](unordered_map<string, string>& values) {
+			for (auto key : {PIN, SOLENOID, RED_PIN, GREEN_PIN, BLUE_PIN}) {
+				auto v = values.find(key);
+				if (v != values.end() and Defaults::isNumber(v->second))
+					v->second = std::to_string(std::stoi(v->second) + offset);
+			}
+		});
+	});
+
+	// Elements can be in many groups, they are added.
+	auto groups(Gtk::make_managed<Gtk::Menu>());
+	for (const auto& group : *groupCollectionHandler) {
+		addMenuItem(groups, group, [&, selected, group]() {
+			vector<string> names;
+			for (auto boxButton : selected)
+				names.push_back(boxButton->getData()->getValue(NAME));
+			size_t added = DialogGroup::getInstance()->addElements(group, names);
+			Message::displayInfo(std::to_string(added) + " element(s) added to " + group + ".", dynamic_cast<Gtk::Window*>(box->get_toplevel()));
+		});
+	}
+	auto addToGroup(addMenuItem(menu, "Add to group"));
+	addToGroup->set_submenu(*groups);
+	addToGroup->set_sensitive(groups->get_children().size());
+}
+
+void DialogElement::afterBulk() {
+	drawPins();
+}
+
+int DialogElement::askPinOffset() {
+	Gtk::Dialog dialog("Shift pins", *dynamic_cast<Gtk::Window*>(box->get_toplevel()), true);
+	Gtk::Label label("Move the selected elements by");
+	Gtk::SpinButton offset(Gtk::Adjustment::create(0, -numberOfPins, numberOfPins, 1, 10));
+	Gtk::HBox container(false, 5);
+	container.get_style_context()->add_class("formContainer");
+	container.pack_start(label, Gtk::PACK_SHRINK);
+	container.pack_start(offset, Gtk::PACK_EXPAND_WIDGET);
+	dialog.get_content_area()->pack_start(container, Gtk::PACK_EXPAND_WIDGET);
+	dialog.add_button("Cancel", Gtk::RESPONSE_CANCEL)->get_style_context()->add_class("backgroundRed");
+	dialog.add_button("Shift", Gtk::RESPONSE_APPLY)->get_style_context()->add_class("backgroundGreen");
+	dialog.show_all_children();
+	return dialog.run() == Gtk::RESPONSE_APPLY ? offset.get_value_as_int() : 0;
+}
+
 void DialogElement::findElementsByPin(const string& pin, vector<Storage::BoxButton*>& elements) {
 	for (auto boxButton : *items) {
 		for (auto v : {PIN, SOLENOID, RED_PIN, GREEN_PIN, BLUE_PIN}) {
@@ -21,6 +21,8 @@
  */
 
 #include "DialogForm.hpp"
+#include "DialogGroup.hpp"
+#include "PinLayout.hpp"
 #include "Storage/Element.hpp"
 
 #ifndef UI_DIALOGELEMENT_HPP_
@@ -63,7 +65,7 @@ public:
 
 	void clearForm() override;
 
-	void isValid() const override;
+	const string validate() const override;
 
 	void storeData() override;
 
@@ -78,7 +80,7 @@ public:
 	void changeNumberOfPins(const uint8_t newSize);
 
 	/**
-	 * Redraw the pin box.
+	 * Updates the pin layout with the current elements.
 	 */
 	void drawPins();
 
@@ -105,7 +107,7 @@ protected:
 
 	Gtk::ToggleButton* solenoid    = nullptr;
 	Gtk::Button* inputDefaultColor = nullptr;
-	Gtk::FlowBox* pinsBox          = nullptr;
+	PinLayout* pinLayout           = nullptr;
 
 	// Only used by the UI
 	Gtk::ComboBoxText* inputElementType = nullptr;
@@ -118,6 +120,16 @@ protected:
 
 	void addButtons(Storage::BoxButton* boxButton) override;
 
+	void createBulkMenu(Gtk::Menu* menu, const vector<Storage::BoxButton*>& selected) override;
+
+	void afterBulk() override;
+
+	/**
+	 * Asks how many pins to move the elements.
+	 * @return the offset, 0 if canceled.
+	 */
+	int askPinOffset();
+
 	/**
 	 * finds all elements that uses a pin.
 	 *
@@ -24,6 +24,10 @@
 
 using namespace LEDSpicerUI::Ui::DataDialogs;
 
+DialogForm::DataChangedSignal DialogForm::dataChanged;
+
+DialogForm::BulkChangedSignal DialogForm::bulkChanged;
+
 DialogForm::DialogForm(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builder>& builder) : Gtk::Dialog(obj) {
 	// this needs to be run last
 	signal_show().connect(sigc::mem_fun(*this, &DialogForm::refreshBox), true);
@@ -34,20 +38,20 @@ DialogForm::~DialogForm() {
 }
 
 void DialogForm::createItems(vector<unordered_map<string, string>>& rawCollection, XMLHelper* values) {
+	TRACE_SPAN("createItems");
 	mode = Modes::LOAD;
-	string errors;
+	const string ownerName(owner ? " of " + owner->createPrettyName() : "");
 	for (auto& rawItem : rawCollection) {
 		clearForm();
 		currentData = getData(rawItem);
 		// Sanity check by load and unload, this will sanitize (or error out) the data.
 		currentData->activate();
 		retrieveData();
-		try {
-			isValid();
-		}
-		catch (Message& e) {
+		const string error(validate());
+		if (not error.empty()) {
+			const string name(currentData->getValue(NAME));
+			Diagnostics::error(error, getType() + (name.empty() ? "" : " " + name) + ownerName);
 			delete currentData;
-			errors += e.getMessage() + '\n';
 			continue;
 		}
 		storeData();
@@ -61,23 +65,27 @@ void DialogForm::createItems(vector<unordered_map<string, string>>& rawCollectio
 	// force a refresh to clean any box handle by main process.
 	refreshBox();
 	currentData = nullptr;
-	if (not errors.empty()) {
-		Message::displayError("Errors in " + getType() + ":\n" + errors);
-	}
 }
 
 void DialogForm::reindex() {
 	items->reindex(box);
 }
 
+void DialogForm::unload(const unordered_set<string>& uniqueIds) {
+	vector<Storage::BoxButton*> selected;
+	for (auto b : *items)
+		if (uniqueIds.count(b->getData()->createUniqueId()))
+			selected.push_back(b);
+	if (not selected.empty())
+		bulkDelete(selected);
+}
+
 void DialogForm::refreshBox() {
-	box->wipe();
+	TRACE_SPAN("refreshBox");
 	items->populateBox(box);
-	box->show_all();
 }
 
 void DialogForm::setOwner(Storage::BoxButtonCollection* collection, Storage::Data* owner) {
-	box->wipe();
 	DialogForm::owner = owner;
 	items = collection;
 	items->populateBox(box);
@@ -101,14 +109,12 @@ void DialogForm::setSignalAdd() {
 
 void DialogForm::setSignalApply() {
 	btnApply->signal_clicked().connect([&]() {
-		try {
-			// Apply changes after sanitize.
-			isValid();
+		// Apply changes after sanitize.
+		const string error(validate());
+		if (error.empty())
 			response(Gtk::RESPONSE_APPLY);
-		}
-		catch (Message& e) {
-			e.displayError(this);
-		}
+		else
+			Message::displayError(error, this);
 	});
 }
 
@@ -146,6 +152,145 @@ void DialogForm::createCloneButton(Storage::BoxButton* boxButton) {
 	});
 }
 
+DialogForm::DataChangedSignal& DialogForm::signalDataChanged() {
+	return dataChanged;
+}
+
+void DialogForm::notifyChanged(const string& previousId) {
+	if (currentData)
+		dataChanged.emit(currentData, previousId);
+	if (owner)
+		dataChanged.emit(owner, owner->createUniqueId());
+}
+
+DialogForm::BulkChangedSignal& DialogForm::signalBulkChanged() {
+	return bulkChanged;
+}
+
+void DialogForm::enableBulkEdit() {
+	box->set_selection_mode(Gtk::SELECTION_MULTIPLE);
+	box->add_events(Gdk::BUTTON_PRESS_MASK);
+	box->signal_button_press_event().connect([&](GdkEventButton* event) {
+		if (event->type != GDK_BUTTON_PRESS or event->button != GDK_BUTTON_SECONDARY)
+			return false;
+		// A right click outside the selection selects that item only.
+		auto child = box->get_child_at_pos(event->x, event->y);
+		if (child and not child->is_selected()) {
+			box->unselect_all();
+			box->select_child(*child);
+		}
+		auto selected = getSelected();
+		bulkMenu.reset(new Gtk::Menu());
+		if (not selected.empty()) {
+			addMenuItem(bulkMenu.get(), std::to_string(selected.size()) + " " + getType() + "(s) selected")->set_sensitive(false);
+			bulkMenu->append(*Gtk::make_managed<Gtk::SeparatorMenuItem>());
+			createBulkMenu(bulkMenu.get(), selected);
+			addMenuItem(bulkMenu.get(), "Delete", [&, selected]() {
+				if (Message::ask("Are you sure you want to remove " + std::to_string(selected.size()) + " " + getType() + "(s)?", dynamic_cast<Gtk::Window*>(box->get_toplevel())) == Gtk::RESPONSE_YES)
+					bulkDelete(selected);
+			});
+			bulkMenu->append(*Gtk::make_managed<Gtk::SeparatorMenuItem>());
+		}
+		addMenuItem(bulkMenu.get(), "Select all", [&]() {
+			box->select_all();
+		});
+		addMenuItem(bulkMenu.get(), "Select none", [&]() {
+			box->unselect_all();
+		});
+		bulkMenu->show_all();
+		bulkMenu->popup_at_pointer(reinterpret_cast<GdkEvent*>(event));
+		return true;
+	}, false);
+}
+
+vector<LEDSpicerUI::Ui::Storage::BoxButton*> DialogForm::getSelected() {
+	vector<Storage::BoxButton*> selected;
+	for (auto child : box->get_selected_children())
+		if (auto boxButton = dynamic_cast<Storage::BoxButton*>(child->get_child()))
+			selected.push_back(boxButton);
+	return selected;
+}
+
+Gtk::MenuItem* DialogForm::addMenuItem(Gtk::Menu* menu, const string& label, const std::function<void()>& action) {
+	auto item(Gtk::make_managed<Gtk::MenuItem>(label));
+	if (action)
+		item->signal_activate().connect(action);
+	menu->append(*item);
+	return item;
+}
+
+bool DialogForm::bulkEdit(const vector<Storage::BoxButton*>& selected, const std::function<void(unordered_map<string, string>&)>& change) {
+	mode = Modes::EDIT;
+	// Loads the changed values into the form, the data goes back to the old ones so the form sees a regular edit.
+	auto loadChanged = [&](Storage::BoxButton* boxButton) {
+		clearForm();
+		currentData = boxButton->getData();
+		currentData->activate();
+		const unordered_map<string, string> old(*currentData->getValues());
+		unordered_map<string, string> changed(old);
+		change(changed);
+		auto assign = [&](const unordered_map<string, string>& values) {
+			currentData->wipe();
+			for (auto& v : values)
+				currentData->setValue(v.first, v.second);
+		};
+		assign(changed);
+		retrieveData();
+		assign(old);
+	};
+
+	// Nothing is stored until all the items pass.
+	for (auto boxButton : selected) {
+		loadChanged(boxButton);
+		const string error(validate());
+		currentData->deActivate();
+		currentData = nullptr;
+		if (not error.empty()) {
+			Message::displayError(boxButton->getData()->createPrettyName() + ": " + error, dynamic_cast<Gtk::Window*>(box->get_toplevel()));
+			return false;
+		}
+	}
+
+	for (auto boxButton : selected) {
+		loadChanged(boxButton);
+		storeData();
+		boxButton->updateLabel();
+		currentData->deActivate();
+	}
+	currentData = nullptr;
+	Defaults::markDirty();
+	notifyBulkChanged(selected);
+	afterBulk();
+	return true;
+}
+
+void DialogForm::bulkDelete(const vector<Storage::BoxButton*>& selected) {
+	for (auto boxButton : selected) {
+		currentData = boxButton->getData();
+		currentData->activate();
+		afterDeleteConfirmation(boxButton);
+	}
+	currentData = nullptr;
+	Defaults::markDirty();
+	notifyBulkChanged(selected);
+	for (auto boxButton : selected) {
+		box->remove(*boxButton);
+		// This will also delete the object, the destructor must call deActivate if necessary.
+		items->remove(boxButton);
+	}
+	afterBulk();
+}
+
+void DialogForm::notifyBulkChanged(const vector<Storage::BoxButton*>& selected) {
+	vector<const Storage::Data*> changed;
+	changed.reserve(selected.size());
+	for (auto boxButton : selected)
+		changed.push_back(boxButton->getData());
+	bulkChanged.emit(changed);
+	if (owner)
+		dataChanged.emit(owner, owner->createUniqueId());
+}
+
 void DialogForm::addButtons(Storage::BoxButton* boxButton) {
 	createEditButton(boxButton);
 	createDeleteButton(boxButton);
@@ -172,6 +317,7 @@ void DialogForm::onAddClicked() {
 		box->add(*bPtr);
 		// Custom stuff.
 		afterCreate(bPtr);
+		notifyChanged("");
 		currentData->deActivate();
 	}
 	// Create voided, destroy form.
@@ -194,11 +340,13 @@ void DialogForm::onEditClicked(Storage::BoxButton* boxButton) {
 	// Populate form.
 	retrieveData();
 	if (run() == Gtk::RESPONSE_APPLY) {
+		const string previousId(currentData->createUniqueId());
 		afterEdit(boxButton);
 		Defaults::markDirty();
 		// Store data.
 		storeData();
 		boxButton->updateLabel();
+		notifyChanged(previousId);
 	}
 	currentData->deActivate();
 	currentData = nullptr;
@@ -210,6 +358,7 @@ void DialogForm::onDelClicked(Storage::BoxButton* boxButton) {
 	currentData->activate();
 	afterDeleteConfirmation(boxButton);
 	Defaults::markDirty();
+	notifyChanged(currentData->createUniqueId());
 	box->remove(*boxButton);
 	// This will also delete the object, the destructor must call deActivate if necessary.
 	items->remove(boxButton);
@@ -220,13 +369,14 @@ void DialogForm::onCloneClicked(Storage::BoxButton* boxButton) {
 	mode = Modes::ADD;
 	clearForm();
 	auto values = unordered_map<string, string>(boxButton->getData()->getValues()->begin(), boxButton->getData()->getValues()->end());
-	// Check for other copies.
-	auto name = values.at(NAME) + " copy";
-	uint8_t count = 0;
-	while (items->isset(name + (count ? std::to_string(count) : ""))) {
-		++count;
-	}
-	name += count ? std::to_string(count) : "";
+	// Check for other copies, the names are hashed once instead of scanning the collection for every try.
+	unordered_set<string> names;
+	for (auto b : *items)
+		names.insert(b->getData()->getValue(NAME));
+	const string base(values.at(NAME) + " copy");
+	string name(base);
+	for (size_t count = 1; names.count(name); ++count)
+		name = base + std::to_string(count);
 	values.at(NAME) = std::move(name);
 	currentData = getData(values);
 	// Add item and the box and set buttons.
@@ -238,6 +388,7 @@ void DialogForm::onCloneClicked(Storage::BoxButton* boxButton) {
 	storeData();
 	Defaults::markDirty();
 	bPtr->updateLabel();
+	notifyChanged("");
 	currentData->deActivate();
 	currentData = nullptr;
 }
@@ -21,9 +21,13 @@
  */
 
 #include "DialogColors.hpp"
+#include "Trace.hpp"
 #include "OrdenableFlowBox.hpp"
 #include "Storage/BoxButtonCollection.hpp"
 
+#include <unordered_set>
+using std::unordered_set;
+
 #ifndef UI_FORMDIALOG_HPP_
 #define UI_FORMDIALOG_HPP_ 1
 
@@ -59,6 +63,12 @@ public:
 	 */
 	virtual void load(XMLHelper* values) = 0;
 
+	/**
+	 * Removes the items with these unique IDs, the same as a bulk delete.
+	 * @param uniqueIds
+	 */
+	void unload(const unordered_set<string>& uniqueIds);
+
 	/**
 	 * Reindex the items.
 	 */
@@ -66,6 +76,7 @@ public:
 
 	/**
 	 * Refresh the box contents, intended to be used when an item is deleted directly without using the delete button.
+	 * Only the rows that changed are touched.
 	 */
 	virtual void refreshBox();
 
@@ -84,8 +95,9 @@ public:
 
 	/**
 	 * Check if the values on the fields are valid.
+	 * @return empty if valid, otherwise the reason why is not.
 	 */
-	virtual void isValid() const = 0;
+	virtual const string validate() const = 0;
 
 	/**
 	 * Send fields into the storage
@@ -110,8 +122,30 @@ public:
 	 */
 	virtual const string createUniqueId() const = 0;
 
+	/// Receives the data that changed and its unique ID before the change.
+	using DataChangedSignal = sigc::signal<void, const Storage::Data*, const string&>;
+
+	/**
+	 * @return a signal emitted when any form adds, edits, clones or deletes data, and for its owner.
+	 * Deleted data is still valid while the signal runs.
+	 */
+	static DataChangedSignal& signalDataChanged();
+
+	/// Receives all the data touched by a bulk operation.
+	using BulkChangedSignal = sigc::signal<void, const vector<const Storage::Data*>&>;
+
+	/**
+	 * @return a signal emitted once per bulk operation, the owner is emitted once on signalDataChanged.
+	 * Bulk operations never rename, so the unique IDs did not change. Deleted data is still valid while the signal runs.
+	 */
+	static BulkChangedSignal& signalBulkChanged();
+
 protected:
 
+	static DataChangedSignal dataChanged;
+
+	static BulkChangedSignal bulkChanged;
+
 	/// If true the form is in Edit mode.
 	Modes mode = Modes::ADD;
 
@@ -133,6 +167,9 @@ protected:
 	/// Owner access, only set if this Dialog is part of other storage, also may not been save yet, query the dialog instead for values.
 	Storage::Data* owner = nullptr;
 
+	/// Bulk operations menu, rebuilt on every right click.
+	std::unique_ptr<Gtk::Menu> bulkMenu;
+
 	/**
 	 * Constructor.
 	 * @param obj
@@ -197,6 +234,64 @@ protected:
 	 */
 	void createCloneButton(Storage::BoxButton* boxButton);
 
+	/**
+	 * Emits the changes for the current data and the owner.
+	 * @param previousId the current data unique ID before the change.
+	 */
+	void notifyChanged(const string& previousId);
+
+	/**
+	 * Allows to select many items, a right click opens a menu with the bulk operations.
+	 */
+	void enableBulkEdit();
+
+	/**
+	 * @return the selected box buttons.
+	 */
+	vector<Storage::BoxButton*> getSelected();
+
+	/**
+	 * Adds the bulk operations this form supports, delete is always added.
+	 * @param menu
+	 * @param selected
+	 */
+	virtual void createBulkMenu(Gtk::Menu* menu, const vector<Storage::BoxButton*>& selected) {}
+
+	/**
+	 * Utility to add an entry into a menu.
+	 * @param menu
+	 * @param label
+	 * @param action if not set the entry is only a label or a submenu holder.
+	 * @return the new entry.
+	 */
+	static Gtk::MenuItem* addMenuItem(Gtk::Menu* menu, const string& label, const std::function<void()>& action = nullptr);
+
+	/**
+	 * Changes many items as a single transaction.
+	 * Every item goes through the form like an edit, all are validated before any is stored, so is all or nothing.
+	 * @param selected
+	 * @param change receives a copy of the values of every item to modify.
+	 * @return true if stored, otherwise the first error is displayed.
+	 */
+	bool bulkEdit(const vector<Storage::BoxButton*>& selected, const std::function<void(unordered_map<string, string>&)>& change);
+
+	/**
+	 * Deletes many items at once.
+	 * @param selected
+	 */
+	void bulkDelete(const vector<Storage::BoxButton*>& selected);
+
+	/**
+	 * Emits the bulk change and the owner change, once.
+	 * @param selected
+	 */
+	void notifyBulkChanged(const vector<Storage::BoxButton*>& selected);
+
+	/**
+	 * Called after a bulk operation is stored.
+	 */
+	virtual void afterBulk() {}
+
 	/**
 	 * Function to create the necesary buttons in the boxButton.
 	 *
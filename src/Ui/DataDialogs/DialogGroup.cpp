@@ -70,6 +70,8 @@ DialogGroup::DialogGroup(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builder>&
 		DialogSelect::getInstance()->RunDialog();
 	});
 
+	enableBulkEdit();
+
 	btnGenerateGroupName->signal_clicked().connect([=]() {
 		comboBoxGN1->set_active(-1);
 		comboBoxGN2->set_active(-1);
@@ -102,12 +104,12 @@ void DialogGroup::clearForm() {
 	);
 }
 
-void DialogGroup::isValid() const {
+const string DialogGroup::validate() const {
 	string name(createUniqueId());
 	if (name.empty()) {
 		if (mode != Modes::LOAD)
 			inputGroupName->grab_focus();
-		throw Message("Invalid group name.");
+		return "Invalid group name.";
 	}
 
 	// If is not edit, or data is not the same, check for dupes.
@@ -115,15 +117,16 @@ void DialogGroup::isValid() const {
 		if (mode != Modes::EDIT or currentData->createUniqueId() != name) {
 			if (mode != Modes::LOAD)
 				inputGroupName->grab_focus();
-			throw Message("Group with name " + name + " already exist.");
+			return "Group with name " + name + " already exist.";
 		}
 	}
 
 	// Check no selected elements.
 	/*if (not dialogSelectElements->getNumberElements()) {
 		if (editMode or (not editMode and not fieldsData.count(NAME)))
-			throw Message("You need to add at least one element.");
+			return "You need to add at least one element.";
 	}*/
+	return "";
 }
 
 void DialogGroup::storeData() {
@@ -155,6 +158,26 @@ string const DialogGroup::createUniqueId() const {
 	return Defaults::createCommonUniqueId({inputGroupName->get_text()});
 }
 
+size_t DialogGroup::addElements(const string& group, const vector<string>& elements) {
+	for (auto boxButton : *items) {
+		if (boxButton->getData()->getValue(NAME) != group)
+			continue;
+		// Sets the element selector destination.
+		clearForm();
+		currentData = boxButton->getData();
+		currentData->activate();
+		size_t added = DialogSelect::getInstance()->add(elements);
+		currentData->deActivate();
+		currentData = nullptr;
+		if (added) {
+			Defaults::markDirty();
+			dataChanged.emit(boxButton->getData(), boxButton->getData()->createUniqueId());
+		}
+		return added;
+	}
+	return 0;
+}
+
 const string DialogGroup::getType() const {
 	return "group";
 }
@@ -162,3 +185,16 @@ const string DialogGroup::getType() const {
 LEDSpicerUI::Ui::Storage::Data* DialogGroup::getData(unordered_map<string, string>& rawData) {
 	return new Storage::Group(rawData);
 }
+
+void DialogGroup::createBulkMenu(Gtk::Menu* menu, const vector<Storage::BoxButton*>& selected) {
+	addMenuItem(menu, "Set default color", [&, selected]() {
+		string color;
+		if (DialogColors::getInstance()->pickColor(color))
+			bulkEdit(selected, [&color](unordered_map<string, string>& values) {
+				if (color.empty())
+					values.erase(DEFAULT_COLOR);
+				else
+					values[DEFAULT_COLOR] = color;
+			});
+	});
+}
@@ -60,7 +60,7 @@ public:
 
 	void clearForm() override;
 
-	void isValid() const override;
+	const string validate() const override;
 
 	void storeData() override;
 
@@ -68,6 +68,14 @@ public:
 
 	const string createUniqueId() const override;
 
+	/**
+	 * Adds elements into a group, the ones already there are skipped.
+	 * @param group the group name.
+	 * @param elements the element names.
+	 * @return the number of added elements.
+	 */
+	size_t addElements(const string& group, const vector<string>& elements);
+
 protected:
 
 	/// Self instance.
@@ -86,6 +94,8 @@ protected:
 	const string getType() const override;
 
 	Storage::Data* getData(unordered_map<string, string>& rawData) override;
+
+	void createBulkMenu(Gtk::Menu* menu, const vector<Storage::BoxButton*>& selected) override;
 };
 
 } /* namespace */
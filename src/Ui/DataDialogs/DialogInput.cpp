@@ -144,13 +144,13 @@ void DialogInput::clearFormOthers() {
 	switchInputBlink->set_state_flags(Gtk::StateFlags::STATE_FLAG_CHECKED, false);
 }
 
-void DialogInput::isValid() const {
+const string DialogInput::validate() const {
 
 	string filename(createUniqueId());
 	if (filename.empty()) {
 		if (mode != Modes::LOAD)
 			inputInputName->grab_focus();
-		throw Message("Invalid name.");
+		return "Invalid name.";
 	}
 	// Check if is used.
 	if (inputHandler->isUsed(filename)) {
@@ -158,7 +158,7 @@ void DialogInput::isValid() const {
 		if (mode != Modes::EDIT or filename != currentData->createUniqueId()) {
 			if (mode != Modes::LOAD)
 				inputInputName->grab_focus();
-			throw Message("Name already in use.");
+			return "Name already in use.";
 		}
 	}
 
@@ -168,7 +168,7 @@ void DialogInput::isValid() const {
 		if (not blinks.empty() and not Defaults::isNumber(blinks)) {
 			if (mode != Modes::LOAD)
 				spinInputTimes->grab_focus();
-			throw Message("Enter a valid number for blink times.");
+			return "Enter a valid number for blink times.";
 		}
 	}
 	if (
@@ -180,9 +180,10 @@ void DialogInput::isValid() const {
 		if (inputInputDevicesID->get_text().empty()) {
 			if (mode != Modes::LOAD)
 				inputInputDevicesID->grab_focus();
-			throw Message("At least one device ID need to be specified.");
+			return "At least one device ID need to be specified.";
 		}
 	}
+	return "";
 }
 
 void DialogInput::storeData() {
@@ -200,19 +201,19 @@ void DialogInput::storeData() {
 
 	if (name == "Actions") {
 		//fieldsData["blink"] = switchInputBlink->get_state_flags() & Gtk::StateFlags::STATE_FLAG_CHECKED ? "true" : "false";
-		currentData->setValue("blink", switchInputBlink->get_state() ? "true" : "false");
+		currentData->setValue(BLINK, switchInputBlink->get_state() ? "true" : "false");
 	}
 
 	if (name == "Blinker") {
-		currentData->setValue("times", spinInputTimes->get_text());
+		currentData->setValue(TIMES, spinInputTimes->get_text());
 	}
 
 	if (name == "Actions" or name == "Blinker") {
-		currentData->setValue("speed", comboBoxInputSpeed->get_active_text());
+		currentData->setValue(SPEED, comboBoxInputSpeed->get_active_text());
 	}
 
 	if (name == "Actions" or name == "Blinker" or name == "Impulse") {
-		currentData->setValue("listenEvents", inputInputDevicesID->get_text());
+		currentData->setValue(LISTEN_EVENTS, inputInputDevicesID->get_text());
 	}
 }
 
@@ -223,19 +224,19 @@ void DialogInput::retrieveData() {
 
 	if (name == "Actions") {
 //		switchInputBlink->set_state_flags(Gtk::StateFlags::STATE_FLAG_CHECKED, fieldsData["blink"] != "true");
-		switchInputBlink->set_active(currentData->getValue("blink") == "true");
+		switchInputBlink->set_active(currentData->getValue(BLINK) == "true");
 	}
 
 	if (name == "Blinker") {
-		spinInputTimes->set_text(currentData->getValue("times"));
+		spinInputTimes->set_text(currentData->getValue(TIMES));
 	}
 
 	if (name == "Actions" or name == "Blinker") {
-		comboBoxInputSpeed->set_active_text(currentData->getValue("speed"));
+		comboBoxInputSpeed->set_active_text(currentData->getValue(SPEED));
 	}
 
 	if (name == "Actions" or name == "Blinker" or name == "Impulse") {
-		inputInputDevicesID->set_text(currentData->getValue("listenEvents"));
+		inputInputDevicesID->set_text(currentData->getValue(LISTEN_EVENTS));
 	}
 }
 
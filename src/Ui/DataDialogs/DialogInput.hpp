@@ -61,7 +61,7 @@ public:
 
 	void clearForm() override;
 
-	void isValid() const override;
+	const string validate() const override;
 
 	void storeData() override;
 
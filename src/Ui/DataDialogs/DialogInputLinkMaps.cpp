@@ -121,10 +121,11 @@ void DialogInputLinkMaps::clearForm() {
 	indivitualMaps.wipe();
 }
 
-void DialogInputLinkMaps::isValid() const {
+const string DialogInputLinkMaps::validate() const {
 	if (isUsed(createUniqueId())) {
-		throw Message("This linked mapping already exists.");
+		return "This linked mapping already exists.";
 	}
+	return "";
 }
 
 void DialogInputLinkMaps::storeData() {
@@ -64,7 +64,7 @@ public:
 
 	void clearForm() override;
 
-	void isValid() const override;
+	const string validate() const override;
 
 	/**
 	 * Will convert the internal fake form data into real data.
@@ -55,19 +55,21 @@ DialogForm(obj, builder)
 	builder->get_widget("InputInputMapTrigger",    inputInputMapTrigger);
 	builder->get_widget("StackElementAndGroup",    stackElementAndGroup);
 
+	enableBulkEdit();
+
 	// Activate color button.
 	DialogColors::getInstance()->activateColorButton(inputMapDefaultColor);
 
+	// The combos follow the collections.
+	mapElementCollectionHandler->registerDestination(comboBoxInputMapElement);
+	mapGroupCollectionHandler->registerDestination(comboBoxInputMapGroup);
+
 	// When the page change on the stack remove other selection.
 	stackElementAndGroup->connect_property_changed("visible-child", [&]() {
-		if (stackElementAndGroup->get_visible_child_name() == "InputTypeElement") {
-			mapElementCollectionHandler->refreshComboBox(comboBoxInputMapElement);
+		if (stackElementAndGroup->get_visible_child_name() == "InputTypeElement")
 			comboBoxInputMapGroup->set_active(-1);
-		}
-		else {
-			mapGroupCollectionHandler->refreshComboBox(comboBoxInputMapGroup);
+		else
 			comboBoxInputMapElement->set_active(-1);
-		}
 	});
 }
 
@@ -76,8 +78,6 @@ void DialogInputMap::load(XMLHelper* values) {
 }
 
 void DialogInputMap::clearForm() {
-	mapElementCollectionHandler->refreshComboBox(comboBoxInputMapElement);
-	mapGroupCollectionHandler->refreshComboBox(comboBoxInputMapGroup);
 	comboBoxInputMapElement->set_active(-1);
 	comboBoxInputMapGroup->set_active(-1);
 	inputInputMapTrigger->set_text("");
@@ -85,33 +85,34 @@ void DialogInputMap::clearForm() {
 	DialogColors::getInstance()->colorizeButton(inputMapDefaultColor, NO_COLOR);
 }
 
-void DialogInputMap::isValid() const {
+const string DialogInputMap::validate() const {
 	if (stackElementAndGroup->get_visible_child_name() == "InputTypeElement") {
 		if (comboBoxInputMapElement->get_active_text().empty())
-			throw Message("Enter a valid element name.");
+			return "Enter a valid element name.";
 	}
 	else {
 		if (comboBoxInputMapGroup->get_active_text().empty())
-			throw Message("Enter a valid group name.");
+			return "Enter a valid group name.";
 	}
 
 	string trigger(inputInputMapTrigger->get_text());
 	if (trigger.empty()) {
 		if (mode != Modes::LOAD)
 			inputInputMapTrigger->grab_focus();
-		throw Message("Enter a trigger.");
+		return "Enter a trigger.";
 	}
 	// Check if is used.
 	if (inputMapCollectionHandler->isUsed(trigger)) {
 		// If editing and they are the same is OK.
 		if (mode != Modes::EDIT or trigger != currentData->createUniqueId()) {
-			throw Message("Trigger already in use.");
+			return "Trigger already in use.";
 		}
 	}
 
 	if (inputMapDefaultColor->get_tooltip_text().empty()) {
-		throw Message("You need to set a color.");
+		return "You need to set a color.";
 	}
+	return "";
 }
 
 void DialogInputMap::storeData() {
@@ -176,3 +177,27 @@ LEDSpicerUI::Ui::Storage::Data* DialogInputMap::getData(unordered_map<string, st
 const string DialogInputMap::getType() const {
 	return "Input Map";
 }
+
+void DialogInputMap::createBulkMenu(Gtk::Menu* menu, const vector<Storage::BoxButton*>& selected) {
+	addMenuItem(menu, "Set color", [&, selected]() {
+		string color;
+		if (DialogColors::getInstance()->pickColor(color))
+			bulkEdit(selected, [&color](unordered_map<string, string>& values) {
+				values[COLOR] = color;
+			});
+	});
+
+	// A map has one target, moving to a group replaces it.
+	auto groups(Gtk::make_managed<Gtk::Menu>());
+	for (const auto& group : *mapGroupCollectionHandler) {
+		addMenuItem(groups, group, [&, selected, group]() {
+			bulkEdit(selected, [&group](unordered_map<string, string>& values) {
+				values[TYPE]   = GROUP;
+				values[TARGET] = group;
+			});
+		});
+	}
+	auto moveToGroup(addMenuItem(menu, "Move to group"));
+	moveToGroup->set_submenu(*groups);
+	moveToGroup->set_sensitive(groups->get_children().size());
+}
@@ -66,7 +66,7 @@ public:
 
 	void clearForm() override;
 
-	void isValid() const override;
+	const string validate() const override;
 
 	void storeData() override;
 
@@ -93,6 +93,8 @@ protected:
 
 	Storage::Data* getData(unordered_map<string, string>& rawData) override;
 
+	void createBulkMenu(Gtk::Menu* menu, const vector<Storage::BoxButton*>& selected) override;
+
 };
 
 } /* namespace */
@@ -63,37 +63,38 @@ void DialogProcess::clearForm() {
 	inputRomPosition->set_text("0");
 }
 
-void DialogProcess::isValid() const {
+const string DialogProcess::validate() const {
 	string name(inputProcessName->get_text());
 	if (name.empty()) {
 		if (mode != Modes::LOAD)
 			inputProcessName->grab_focus();
-		throw Message("Invalid process name.");
+		return "Invalid process name.";
 	}
 
 	if (inputSystemType->get_text().empty()) {
 		if (mode != Modes::LOAD)
 			inputSystemType->grab_focus();
-		throw Message("Invalid system type.");
+		return "Invalid system type.";
 	}
 
 	string pos(inputRomPosition->get_text());
 	if (not pos.empty() and not Defaults::isNumber(pos)) {
 		if (mode != Modes::LOAD)
 			inputRomPosition->grab_focus();
-		throw Message("Position needs to be a number.");
+		return "Position needs to be a number.";
 	}
 
 	// If data is the same, just continue.
 	if (mode == Modes::EDIT and currentData->createUniqueId() == name)
-		return;
+		return "";
 
 	// Check new name for existence.
 	if (processHandler->isUsed(name)) {
 		if (mode != Modes::LOAD)
 			inputProcessName->grab_focus();
-		throw Message("Process " + name + " already registered.");
+		return "Process " + name + " already registered.";
 	}
+	return "";
 }
 
 void DialogProcess::storeData() {
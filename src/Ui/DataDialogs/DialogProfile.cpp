@@ -132,12 +132,12 @@ void DialogProfile::clearForm() {
 	btnProfilesAddEndTransitions->set_sensitive(animationsSize);
 }
 
-void DialogProfile::isValid() const {
+const string DialogProfile::validate() const {
 	string name(createUniqueId());
 	if (name.empty()) {
 		if (mode != Modes::LOAD)
 			inputProfileName->grab_focus();
-		throw Message("Invalid profile name.");
+		return "Invalid profile name.";
 	}
 
 	// If is not edit, or data is not the same, check for dupes.
@@ -145,12 +145,13 @@ void DialogProfile::isValid() const {
 		if (mode != Modes::EDIT or currentData->createUniqueId() != name) {
 			if (mode != Modes::LOAD)
 				inputProfileName->grab_focus();
-			throw Message("Profile with name " + name + " already exist.");
+			return "Profile with name " + name + " already exist.";
 		}
 	}
 	if (btnProfileBackgroundColor->get_tooltip_text().empty()) {
-		throw Message("Select a valid background color.");
+		return "Select a valid background color.";
 	}
+	return "";
 }
 
 void DialogProfile::storeData() {
@@ -238,7 +239,7 @@ void DialogProfile::prepareSelect(Selectors selector) const {
 			boxProfileEndTransitions,
 			COLLECTION_ANIMATIONS,
 			"endTransitions",
-			COLLECTION_GROUP,
+			COLLECTION_PROFILES,
 			DialogSelect::DELETER
 		);
 	break;
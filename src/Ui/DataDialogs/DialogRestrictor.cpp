@@ -72,8 +72,8 @@ DialogRestrictor::DialogRestrictor(BaseObjectType* obj, const Glib::RefPtr<Gtk::
 	row.set_value(2, false);
 	for (auto& d : Defaults::restrictorsInfo) {
 		row = *(restrictorsListstore->append());
-		row.set_value(0, d.first);
-		row.set_value(1, d.second.name);
+		row.set_value(0, string(d.id));
+		row.set_value(1, string(d.name));
 		row.set_value(2, true);
 	}
 
@@ -116,39 +116,41 @@ DialogRestrictor::DialogRestrictor(BaseObjectType* obj, const Glib::RefPtr<Gtk::
 		}
 
 		previousName = name;
+		const Defaults::RestrictorType type(Defaults::getRestrictorType(name));
 
-		if (name == "UltraStik360") {
+		if (type == Defaults::RestrictorType::UltraStik360) {
 			hasRestrictor->get_parent()->show();
 		}
-		if (name == "GPWiz49") {
+		if (type == Defaults::RestrictorType::GPWiz49) {
 			williamsMode->show();
 		}
-		if (name == "GPWiz40RotoX") {
+		if (type == Defaults::RestrictorType::GPWiz40RotoX) {
 			speedOn->get_parent()->get_parent()->show();
 		}
 
-		if (Defaults::isIdUser(name, false)) {
+		if (Defaults::isIdUser(type)) {
 			Defaults::populateComboBoxWithIds(
 				idListstore,
-				Defaults::restrictorsInfo.at(name).maxIds,
+				Defaults::getInfo(type).maxIds,
 				[=](const string& id) {
-					return restrictorsHandler->isUsed(Defaults::createHardwareUniqueId({{NAME, name}, {ID, id}}, false));
+					return isHardwareUsed(Defaults::createHardwareKey(type, id, ""));
 				},
 				"Restrictor Number",
 				"Hardware #"
 			);
 			comboBoxId->get_parent()->show();
 		}
-		if (Defaults::isSerial(name, false)) {
+		if (Defaults::isSerial(type)) {
 			serialPort->get_parent()->show();
 		}
 
 		// Set ways.
-		for (auto& w : Defaults::restrictorsInfo.at(name).ways) {
-			waysIcons.at(w)->show();
+		for (auto& w : Defaults::allWays) {
+			if (Defaults::hasWay(type, w))
+				waysIcons.at(w)->show();
 		}
 
-		breafRestrictor->set_label(Defaults::restrictorsInfo.at(name).breaf);
+		breafRestrictor->set_label(Defaults::getInfo(type).breaf);
 		btnAddRestrictorMap->set_sensitive(true);
 		btnApply->set_sensitive(true);
 	});
@@ -194,7 +196,7 @@ void DialogRestrictor::clearFormOthers() {
 	breafRestrictor->set_label("");
 }
 
-void DialogRestrictor::isValid() const {
+const string DialogRestrictor::validate() const {
 	string
 		name(comboBoxRestrictors->get_active_id()),
 		id(comboBoxId->get_active_id()),
@@ -202,30 +204,32 @@ void DialogRestrictor::isValid() const {
 
 	bool checkDupe = true;
 
-	if (name.empty()) {
-		throw Message("Invalid restrictor.");
+	const Defaults::RestrictorType type(Defaults::getRestrictorType(name));
+	if (type == Defaults::RestrictorType::invalid) {
+		return "Invalid restrictor.";
 	}
 
-	if (Defaults::isIdUser(name, false) and id.empty()) {
-		throw Message("Invalid restrictor number.");
+	if (Defaults::isIdUser(type) and id.empty()) {
+		return "Invalid restrictor number.";
 	}
 
-	string
-		newName(createUniqueId()),
-		hardwareName("Hardware " + Defaults::restrictorsInfo.at(name).name );
+	const Defaults::HardwareKey newKey(Defaults::createHardwareKey(type, id, port));
+	const string hardwareName(string("Hardware ") + Defaults::getInfo(type).name);
 	if (mode == Modes::EDIT) {
-		checkDupe = (currentData->createUniqueId() != newName);
+		checkDupe = (dynamic_cast<Storage::Restrictor*>(currentData)->getHardwareKey() != newKey);
 	}
+	checkDupe = checkDupe and isHardwareUsed(newKey);
 
-	if (Defaults::isIdUser(name, false) and checkDupe and restrictorsHandler->isUsed(newName)) {
-		throw Message(hardwareName + " ID " + id + " already exists.");
+	if (Defaults::isIdUser(type) and checkDupe) {
+		return hardwareName + " ID " + id + " already exists.";
 	}
-	if (Defaults::isSerial(name, false) and checkDupe and restrictorsHandler->isUsed(newName)) {
-		throw Message(hardwareName + " that connects to " + (port.empty() ? "<autodetect>" : port) + " already exists.");
+	if (Defaults::isSerial(type) and checkDupe) {
+		return hardwareName + " that connects to " + (port.empty() ? "<autodetect>" : port) + " already exists.";
 	}
-	if (checkDupe and restrictorsHandler->isUsed(newName)) {
-		throw Message(hardwareName + " already exists.");
+	if (checkDupe) {
+		return hardwareName + " already exists.";
 	}
+	return "";
 }
 
 void DialogRestrictor::storeData() {
@@ -241,50 +245,52 @@ void DialogRestrictor::storeData() {
 	currentData->wipe();
 
 	const string name(comboBoxRestrictors->get_active_id());
+	const Defaults::RestrictorType type(Defaults::getRestrictorType(name));
 
 	currentData->setValue(NAME, name);
-	if (Defaults::isIdUser(name, false)) {
+	if (Defaults::isIdUser(type)) {
 		currentData->setValue(ID, comboBoxId->get_active_id());
 	}
 
-	if (Defaults::isSerial(name, false)) {
+	if (Defaults::isSerial(type)) {
 		currentData->setValue(PORT, serialPort->get_text());
 	}
 
-	if (name == "UltraStik360") {
+	if (type == Defaults::RestrictorType::UltraStik360) {
 		currentData->setValue(US360_HAS_RESTRICTOR, hasRestrictor->get_active() ? "true" : "false");
 		currentData->setValue(US360_USE_MOUSE,      handleMouse->get_active()   ? "true" : "false");
 	}
-	else if (name == "GPWiz49") {
+	else if (type == Defaults::RestrictorType::GPWiz49) {
 		currentData->setValue(GZ49_WILLIAMS, williamsMode->get_active() ? "true" : "false");
 	}
-	else if (name == "GPWiz40RotoX") {
+	else if (type == Defaults::RestrictorType::GPWiz40RotoX) {
 		currentData->setValue(GZ40_SPEED_ON, std::to_string(static_cast<uint8_t>(speedOn->get_value())));
 		currentData->setValue(GZ40_SPEED_OFF, std::to_string(static_cast<uint8_t>(speedOff->get_value())));
 	}
+	dynamic_cast<Storage::Restrictor*>(currentData)->resolveType();
 }
 
 void DialogRestrictor::retrieveData() {
 
-	const string name(currentData->getValue(NAME));
+	const Defaults::RestrictorType type(dynamic_cast<Storage::Restrictor*>(currentData)->getType());
 
-	comboBoxRestrictors->set_active_id(name);
+	comboBoxRestrictors->set_active_id(currentData->getValue(NAME));
 
-	if (Defaults::isIdUser(name, false)) {
+	if (Defaults::isIdUser(type)) {
 		comboBoxId->set_active_id(currentData->getValue(ID));
 	}
-	if (Defaults::isSerial(name, false)) {
+	if (Defaults::isSerial(type)) {
 		serialPort->set_text(currentData->getValue(PORT));
 	}
 
-	if (name == "UltraStik360") {
+	if (type == Defaults::RestrictorType::UltraStik360) {
 		hasRestrictor->set_active(currentData->getValue(US360_HAS_RESTRICTOR) == "true");
 		handleMouse->set_active(currentData->getValue(US360_USE_MOUSE) == "true");
 	}
-	else if (name == "GPWiz49") {
+	else if (type == Defaults::RestrictorType::GPWiz49) {
 		williamsMode->set_active(currentData->getValue(GZ49_WILLIAMS) == "true");
 	}
-	else if (name == "GPWiz40RotoX") {
+	else if (type == Defaults::RestrictorType::GPWiz40RotoX) {
 		speedOn->set_value(std::stod(currentData->getValue(GZ40_SPEED_ON, std::to_string(GZ40_DEFAULT_SPEED))));
 		speedOff->set_value(std::stod(currentData->getValue(GZ40_SPEED_OFF, std::to_string(GZ40_DEFAULT_SPEED))));
 	}
@@ -292,11 +298,11 @@ void DialogRestrictor::retrieveData() {
 }
 
 string const DialogRestrictor::createUniqueId() const {
-	return Defaults::createHardwareUniqueId({
-		{NAME, comboBoxRestrictors->get_active_id()},
-		{ID,   comboBoxId->get_active_id()},
-		{PORT, serialPort->get_text()}
-	}, false);
+	return Defaults::createHardwareUniqueId(
+		Defaults::getRestrictorType(comboBoxRestrictors->get_active_id()),
+		comboBoxId->get_active_id(),
+		serialPort->get_text()
+	);
 }
 
 const string DialogRestrictor::getType() const {
@@ -308,20 +314,29 @@ LEDSpicerUI::Ui::Storage::Data* DialogRestrictor::getData(unordered_map<string,
 }
 
 void DialogRestrictor::markRestrictorUsed() {
-	for (auto& ri : Defaults::restrictorsInfo) {
-		// count used devices.
-		const uint total    = restrictorsHandler->count(ri.first);
-		const auto& children = restrictorsListstore->children();
-
-		for (auto iter = children.begin(); iter != children.end(); ++iter) {
-			Gtk::TreeModel::Row dataRow = *iter;
-
-			string data;
-			dataRow.get_value(0, data);
-			if (data == ri.first) {
-				dataRow.set_value(2, total < ri.second.maxIds);
-				break;
-			}
-		}
+	// count used restrictors per type.
+	std::array<uint, Defaults::restrictorsInfo.size()> totals{};
+	for (auto i : *items) {
+		auto type(dynamic_cast<Storage::Restrictor*>(i->getData())->getType());
+		if (type != Defaults::RestrictorType::invalid)
+			++totals[static_cast<uint8_t>(type)];
+	}
+	const auto& children = restrictorsListstore->children();
+	for (auto iter = children.begin(); iter != children.end(); ++iter) {
+		Gtk::TreeModel::Row dataRow = *iter;
+
+		string data;
+		dataRow.get_value(0, data);
+		const Defaults::RestrictorType type(Defaults::getRestrictorType(data));
+		if (type != Defaults::RestrictorType::invalid)
+			dataRow.set_value(2, totals[static_cast<uint8_t>(type)] < Defaults::getInfo(type).maxIds);
+	}
+}
+
+bool DialogRestrictor::isHardwareUsed(Defaults::HardwareKey key) const {
+	for (auto i : *items) {
+		if (i->getData() != currentData and dynamic_cast<Storage::Restrictor*>(i->getData())->getHardwareKey() == key)
+			return true;
 	}
+	return false;
 }
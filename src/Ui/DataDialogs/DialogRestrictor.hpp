@@ -59,7 +59,7 @@ public:
 
 	void clearForm() override;
 
-	void isValid() const override;
+	const string validate() const override;
 
 	void storeData() override;
 
@@ -110,6 +110,13 @@ protected:
 	void clearFormOthers();
 
 	void markRestrictorUsed();
+
+	/**
+	 * Checks if any other restrictor uses the same hardware.
+	 * @param key
+	 * @return true if the key is used.
+	 */
+	bool isHardwareUsed(Defaults::HardwareKey key) const;
 };
 
 } /* namespace */
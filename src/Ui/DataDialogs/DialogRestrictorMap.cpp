@@ -50,8 +50,11 @@ DialogRestrictorMap::DialogRestrictorMap(BaseObjectType* obj, const Glib::RefPtr
 	builder->get_widget("ComboboxRestrictorJoystick",  joystick);
 	builder->get_widget("ComboboxRestrictorInterface", interface);
 
-	// For checking.
+	// For checking, the type is resolved once per restrictor change.
 	builder->get_widget("ComboBoxRestrictors", comboBoxRestrictors);
+	comboBoxRestrictors->signal_changed().connect([&]() {
+		type = Defaults::getRestrictorType(comboBoxRestrictors->get_active_id());
+	});
 
 	// list of map ids to pick from.
 	liststoreRestrictorMapId = dynamic_cast<Gtk::ListStore*>(builder->get_object("liststoreRestrictorMapId").get());
@@ -66,30 +69,31 @@ void DialogRestrictorMap::clearForm() {
 	joystick->set_active(0);
 	populateInterfacesCombobox();
 	// Check if the hardware have interfaces left.
-	if (Defaults::isMulti(comboBoxRestrictors->get_active_id()))
+	if (Defaults::isMulti(type))
 		interface->get_parent()->show();
 	else
 		interface->get_parent()->hide();
 }
 
-void DialogRestrictorMap::isValid() const {
+const string DialogRestrictorMap::validate() const {
 
 	string newPlayer(createUniqueId());
 
 	if (player->get_active_id() == "0") {
-		throw Message("Invalid player number.");
+		return "Invalid player number.";
 	}
 	if (joystick->get_active_id() == "0") {
-		throw Message("Invalid joystick number.");
+		return "Invalid joystick number.";
 	}
-	if (Defaults::isMulti(comboBoxRestrictors->get_active_id()) and interface->get_active_id().empty()) {
-		throw Message("Select a hardware interface.");
+	if (Defaults::isMulti(type) and interface->get_active_id().empty()) {
+		return "Select a hardware interface.";
 	}
 	if (mode != Modes::EDIT or newPlayer != currentData->createUniqueId()) {
 		if (playerCombinations->isUsed(newPlayer)) {
-			throw Message("That player - joystick combination is already in use.");
+			return "That player - joystick combination is already in use.";
 		}
 	}
+	return "";
 }
 
 void DialogRestrictorMap::storeData() {
@@ -106,7 +110,7 @@ void DialogRestrictorMap::storeData() {
 	currentData->setValue(PLAYER,   player->get_active_id());
 	currentData->setValue(JOYSTICK, joystick->get_active_id());
 	// This is only necessary for multi hardware.
-	if (Defaults::isMulti(comboBoxRestrictors->get_active_id())) {
+	if (Defaults::isMulti(type)) {
 		currentData->setValue(RESTRICTOR_INTERFACE, interface->get_active_id());
 	}
 }
@@ -114,7 +118,7 @@ void DialogRestrictorMap::storeData() {
 void DialogRestrictorMap::retrieveData() {
 	player->set_active_id(currentData->getValue(PLAYER));
 	joystick->set_active_id(currentData->getValue(JOYSTICK));
-	if (Defaults::isMulti(comboBoxRestrictors->get_active_id())) {
+	if (Defaults::isMulti(type)) {
 		interface->set_active_id(currentData->getValue(RESTRICTOR_INTERFACE));
 	}
 }
@@ -125,7 +129,7 @@ string const DialogRestrictorMap::createUniqueId() const {
 
 const bool DialogRestrictorMap::checkAvailableInterfaces() const {
 	// Allowed interfaces.
-	auto total = Defaults::restrictorsInfo.at(comboBoxRestrictors->get_active_id()).interfaces;
+	auto total = Defaults::getInfo(type).interfaces;
 	// Size of the map box.
 	auto size = box->getSize();
 	return size < total;
@@ -140,10 +144,9 @@ LEDSpicerUI::Ui::Storage::Data* DialogRestrictorMap::getData(unordered_map<strin
 }
 
 void DialogRestrictorMap::populateInterfacesCombobox() {
-	string name(comboBoxRestrictors->get_active_id());
 	Defaults::populateComboBoxWithIds(
 		liststoreRestrictorMapId,
-		Defaults::restrictorsInfo.at(name).interfaces,
+		Defaults::getInfo(type).interfaces,
 		[&](const string& id) {
 			for (auto i : *items) {
 				if (i->getData()->getValue(RESTRICTOR_INTERFACE) == id)
@@ -60,7 +60,7 @@ public:
 
 	void clearForm() override;
 
-	void isValid() const override;
+	const string validate() const override;
 
 	void storeData() override;
 
@@ -82,6 +82,9 @@ protected:
 
 	Gtk::ListStore * liststoreRestrictorMapId = nullptr;
 
+	/// Type of the restrictor selected in the owner form.
+	Defaults::RestrictorType type = Defaults::RestrictorType::invalid;
+
 	DialogRestrictorMap(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builder>& builder);
 
 	/**
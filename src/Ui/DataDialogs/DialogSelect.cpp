@@ -48,6 +48,7 @@ DialogForm(obj, builder)
 	builder->get_widget("BoxAll",              boxAll);
 	builder->get_widget("BtnSelectAll",        btnSelectAll);
 	builder->get_widget("BtnSelectNone",       btnSelectNone);
+	builder->get_widget("InputFilterSelect",   inputFilter);
 
 	btnSelectAll->signal_clicked().connect([&]() {
 		boxAll->select_all();
@@ -57,8 +58,25 @@ DialogForm(obj, builder)
 		boxAll->unselect_all();
 	});
 
+	// Sorted as the collection, and filtered by the type ahead.
+	boxAll->set_sort_func([](Gtk::FlowBoxChild* a, Gtk::FlowBoxChild* b) {
+		return dynamic_cast<Gtk::Button*>(a->get_child())->get_label().raw().compare(
+			dynamic_cast<Gtk::Button*>(b->get_child())->get_label().raw()
+		);
+	});
+	boxAll->set_filter_func([&](Gtk::FlowBoxChild* child) {
+		return filter.empty() or dynamic_cast<Gtk::Button*>(child->get_child())->get_label().lowercase().find(filter) != Glib::ustring::npos;
+	});
+	inputFilter->signal_search_changed().connect([&]() {
+		filter = inputFilter->get_text().lowercase();
+		boxAll->invalidate_filter();
+	});
+
 	signal_show().connect([&]() {
+		inputFilter->set_text("");
+		filter.clear();
 		populateSelectables();
+		inputFilter->grab_focus();
 	});
 
 	setSignalApply();
@@ -79,12 +97,34 @@ void DialogSelect::RunDialog() {
 			box->add(*bPtr);
 		}
 		box->show_all();
+		if (owner)
+			dataChanged.emit(owner, owner->createUniqueId());
 	}
 	hide();
 }
 
+size_t DialogSelect::add(const vector<string>& names) {
+	unordered_set<string> existing;
+	for (auto b : *items)
+		existing.insert(b->getData()->getValue(NAME));
+	size_t added = 0;
+	for (const auto& name : names) {
+		if (not existing.insert(name).second)
+			continue;
+		unordered_map<string, string> rawData{{NAME, name}};
+		auto bPtr = items->add(getData(rawData));
+		addButtons(bPtr);
+		box->add(*bPtr);
+		++added;
+	}
+	box->show_all();
+	return added;
+}
+
 void DialogSelect::load(XMLHelper* values) {
 	// to avoid an error about empty selection, add 1 element and select it.
+	filter.clear();
+	boxAll->invalidate_filter();
 	populateSelectables();
 	boxAll->select_all();
 	createItems(values->getData(Defaults::createCommonUniqueId({owner->createUniqueId(), collection})), values);
@@ -109,10 +149,11 @@ void DialogSelect::clearFormOthers() {
 	items->wipe();
 }
 
-void DialogSelect::isValid() const {
+const string DialogSelect::validate() const {
 	if (not getNumberOfSelections())
-		throw Message("Please Select at least one");
-};
+		return "Please Select at least one";
+	return "";
+}
 
 const size_t DialogSelect::getNumberOfSelections() const {
 	return boxAll->get_selected_children().size();
@@ -147,34 +188,61 @@ void DialogSelect::addButtons(Storage::BoxButton* boxButton) {
 }
 
 void DialogSelect::populateSelectables() {
-	for (auto child : boxAll->get_children()) {
-		boxAll->remove(*child);
+	TRACE_SPAN("populateSelectables");
+	auto& pool = pools[type];
+
+	// Other collection was shown, its rows stay in its pool.
+	if (shownType != type) {
+		for (auto child : boxAll->get_children())
+			boxAll->remove(*child);
+		for (auto& row : pool)
+			boxAll->add(*row.second);
+		shownType = type;
 	}
-	for (auto& e : *Storage::CollectionHandler::getInstance(type)) {
-		auto b = Gtk::make_managed<Gtk::Button>(e);
-		b->get_child()->set_halign(Gtk::Align::ALIGN_START);
-		auto c = Gtk::make_managed<Gtk::FlowBoxChild>();
-		b->signal_clicked().connect([&, c, b]() {
-			bool a = c->is_selected();
-			if (a)
-				boxAll->unselect_child(*c);
-			else
-				boxAll->select_child(*c);
-			b->grab_focus();
-		});
-		c->add(*b);
-		boxAll->add(*c);
-		// activate selected.
-		if (exist(e))
-			boxAll->select_child(*c);
 
+	// Only the names that come or go are touched.
+	auto& names(Storage::CollectionHandler::getInstance(type)->get());
+	unordered_set<string> current(names.begin(), names.end());
+	for (auto row = pool.begin(); row != pool.end();) {
+		if (current.count(row->first)) {
+			++row;
+			continue;
+		}
+		boxAll->remove(*row->second);
+		row = pool.erase(row);
+	}
+	for (auto& name : names) {
+		auto& row = pool[name];
+		if (row)
+			continue;
+		row = createSelectable(name);
+		boxAll->add(*row);
 	}
 	boxAll->show_all();
-}
 
-bool DialogSelect::exist(const string& name) {
+	// Activate selected.
+	unordered_set<string> selected;
 	for (auto b : *items)
-		if (b->getData()->getValue(NAME) == name)
-			return true;
-	return false;
+		selected.insert(b->getData()->getValue(NAME));
+	boxAll->unselect_all();
+	for (auto& row : pool)
+		if (selected.count(row.first))
+			boxAll->select_child(*row.second);
+}
+
+std::unique_ptr<Gtk::FlowBoxChild> DialogSelect::createSelectable(const string& name) {
+	auto c = std::make_unique<Gtk::FlowBoxChild>();
+	auto b = Gtk::make_managed<Gtk::Button>(name);
+	b->get_child()->set_halign(Gtk::Align::ALIGN_START);
+	b->signal_clicked().connect([&, c = c.get(), b]() {
+		bool a = c->is_selected();
+		if (a)
+			boxAll->unselect_child(*c);
+		else
+			boxAll->select_child(*c);
+		b->grab_focus();
+	});
+	c->add(*b);
+	Stats::add(Stats::Counters::WIDGETS_CREATED, 2);
+	return c;
 }
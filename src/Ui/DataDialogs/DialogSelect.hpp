@@ -87,7 +87,7 @@ public:
 
 	void clearFormOthers();
 
-	void isValid() const override;
+	const string validate() const override;
 
 	void storeData() override {}
 
@@ -95,6 +95,13 @@ public:
 
 	const string createUniqueId() const override {return "";}
 
+	/**
+	 * Adds items by name into the current owner, skips the ones already there.
+	 * @param names
+	 * @return the number of added items.
+	 */
+	size_t add(const vector<string>& names);
+
 	/**
 	 * @return The number of selected boxes.
 	 */
@@ -113,6 +120,18 @@ protected:
 	/// Box where the selectables are displayed.
 	Gtk::FlowBox* boxAll = nullptr;
 
+	/// Type ahead filter for the selectables.
+	Gtk::SearchEntry* inputFilter = nullptr;
+
+	/// The current filter, lower case.
+	Glib::ustring filter;
+
+	/// Selectable rows by name, per collection, they are kept between shows and not managed.
+	unordered_map<string, unordered_map<string, std::unique_ptr<Gtk::FlowBoxChild>>> pools;
+
+	/// The collection the box is showing.
+	string shownType;
+
 	string
 		/// The current form type.
 		type,
@@ -138,14 +157,17 @@ protected:
 
 	void addButtons(Storage::BoxButton* boxButton) override;
 
+	/**
+	 * Brings the selectables in line with the collection and selects the ones the owner has.
+	 */
 	void populateSelectables();
 
 	/**
-	 * Checks if name exist in the items.
+	 * Creates a selectable row.
 	 * @param name
-	 * @return true if  found.
+	 * @return
 	 */
-	bool exist(const string& name);
+	std::unique_ptr<Gtk::FlowBoxChild> createSelectable(const string& name);
 
 };
 
@@ -0,0 +1,152 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogBandwidth.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "DialogBandwidth.hpp"
+#include "Storage/Device.hpp"
+
+using namespace LEDSpicerUI::Ui;
+
+DialogBandwidth::DialogBandwidth(Gtk::Window* parent, const Storage::BoxButtonCollection& devices) :
+	store(Gtk::TreeStore::create(columns)),
+	devices(devices)
+{
+	set_title("Output Bandwidth");
+	set_transient_for(*parent);
+	set_position(Gtk::WindowPosition::WIN_POS_CENTER_ON_PARENT);
+	set_default_size(700, 400);
+	set_modal(false);
+
+	auto box = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_VERTICAL, 2);
+	add(*box);
+	summary.get_style_context()->add_class("formContainer");
+	summary.set_halign(Gtk::Align::ALIGN_START);
+	box->pack_start(summary, Gtk::PACK_SHRINK);
+
+	view.set_model(store);
+	view.append_column("Connection / Device", columns.name);
+	view.append_column("Bytes per frame",     columns.bytes);
+	view.append_column("USB transfers",       columns.transfers);
+	view.append_column("Usage",               columns.usage);
+	view.append_column("State",               columns.state);
+	for (auto column : view.get_columns())
+		column->set_resizable(true);
+
+	auto scroll = Gtk::make_managed<Gtk::ScrolledWindow>();
+	scroll->add(view);
+	box->pack_start(*scroll);
+	box->show_all();
+
+	Defaults::signalChanged().connect(sigc::mem_fun(*this, &DialogBandwidth::queueRefresh));
+}
+
+void DialogBandwidth::setFps(uint16_t fps) {
+	this->fps = fps;
+	queueRefresh();
+}
+
+void DialogBandwidth::display() {
+	refresh();
+	present();
+}
+
+void DialogBandwidth::queueRefresh() {
+	if (pending or not get_visible())
+		return;
+	pending = true;
+	// Forms mark the data dirty before storing it, so wait until they are done.
+	Glib::signal_idle().connect_once([&]() {
+		pending = false;
+		refresh();
+	});
+}
+
+void DialogBandwidth::refresh() {
+
+	struct Bus {
+		Defaults::Connection connection;
+		FrameBudget::Load    total;
+		vector<std::pair<string, FrameBudget::Load>> devices;
+	};
+
+	// The estimation is a few products, it is done for every device on each refresh.
+	std::map<string, Bus> buses;
+	for (auto boxButton : devices) {
+		auto device = dynamic_cast<const Storage::Device*>(boxButton->getData());
+		if (not device or device->getType() == Defaults::DeviceType::invalid)
+			continue;
+
+		const auto  type = device->getType();
+		const auto& info = Defaults::getInfo(type);
+		const FrameBudget::Load load(FrameBudget::estimate(type, device->getPins()));
+
+		// Every serial device has its own port, USB devices share the bus.
+		string busName;
+		switch (info.connection) {
+		case Defaults::Connection::USB:
+			busName = "USB";
+			break;
+		case Defaults::Connection::SERIAL:
+			busName = device->getValue(PORT);
+			busName = "Serial " + (busName.empty() ? "<autodetect> " + device->createPrettyName() : busName);
+			break;
+		default:
+			busName = "Direct";
+		}
+		auto& bus = buses.emplace(busName, Bus{info.connection, {}, {}}).first->second;
+		bus.total += load;
+		bus.devices.emplace_back(device->createPrettyName(), load);
+	}
+
+	store->clear();
+	uint overloaded = 0, tight = 0;
+	for (const auto& [name, bus] : buses) {
+		auto busRow = *(store->append());
+		float usage = fillRow(busRow, name, bus.connection, bus.total);
+		if (usage >= 1)
+			++overloaded;
+		else if (usage >= FrameBudget::TIGHT)
+			++tight;
+		for (const auto& [deviceName, load] : bus.devices) {
+			auto row = *(store->append(busRow.children()));
+			fillRow(row, deviceName, bus.connection, load);
+		}
+	}
+	view.expand_all();
+	summary.set_text(
+		"At " + std::to_string(fps) + " FPS: " +
+		std::to_string(overloaded) + " overloaded and " +
+		std::to_string(tight) + " tight connections"
+	);
+}
+
+float DialogBandwidth::fillRow(Gtk::TreeRow& row, const string& name, Defaults::Connection connection, const FrameBudget::Load& load) {
+	row[columns.name] = name;
+	if (connection == Defaults::Connection::NONE)
+		return 0;
+	float usage = FrameBudget::usage(connection, load, fps);
+	row[columns.bytes]     = std::to_string(load.bytes);
+	row[columns.transfers] = connection == Defaults::Connection::USB ? std::to_string(load.transfers) : "";
+	row[columns.usage]     = std::to_string(static_cast<uint>(usage * 100 + 0.5)) + "%";
+	row[columns.state]     = FrameBudget::toString(usage);
+	return usage;
+}
@@ -0,0 +1,123 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogBandwidth.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Message.hpp"
+#include "FrameBudget.hpp"
+#include "Storage/BoxButtonCollection.hpp"
+
+#include <map>
+
+#ifndef UI_DIALOGBANDWIDTH_HPP_
+#define UI_DIALOGBANDWIDTH_HPP_ 1
+
+namespace LEDSpicerUI::Ui {
+
+/**
+ * LEDSpicerUI::Ui::DialogBandwidth
+ * Non modal window that displays the estimated output per frame of every device, grouped by connection.
+ * Devices are estimated again on every refresh, the estimation is cheap.
+ */
+class DialogBandwidth: public Gtk::Window {
+
+public:
+
+	/**
+	 * @param parent
+	 * @param devices the devices collection to analyze.
+	 */
+	DialogBandwidth(Gtk::Window* parent, const Storage::BoxButtonCollection& devices);
+
+	virtual ~DialogBandwidth() = default;
+
+	/**
+	 * Sets the frames per second to check against, updates the view if visible.
+	 * @param fps
+	 */
+	void setFps(uint16_t fps);
+
+	/**
+	 * Refresh and displays the window.
+	 */
+	void display();
+
+protected:
+
+	/**
+	 * Tree columns.
+	 */
+	class Columns : public Gtk::TreeModelColumnRecord {
+	public:
+		Columns() {
+			add(name);
+			add(bytes);
+			add(transfers);
+			add(usage);
+			add(state);
+		}
+		Gtk::TreeModelColumn<string> name;
+		Gtk::TreeModelColumn<string> bytes;
+		Gtk::TreeModelColumn<string> transfers;
+		Gtk::TreeModelColumn<string> usage;
+		Gtk::TreeModelColumn<string> state;
+	};
+
+	Columns columns;
+
+	Glib::RefPtr<Gtk::TreeStore> store;
+
+	Gtk::TreeView view;
+
+	Gtk::Label summary;
+
+	/// The devices to analyze.
+	const Storage::BoxButtonCollection& devices;
+
+	uint16_t fps = std::stoi(DEFAULT_FPS);
+
+	/// Set when a refresh is already queued.
+	bool pending = false;
+
+	/**
+	 * Estimates every device and rebuilds the view.
+	 */
+	void refresh();
+
+	/**
+	 * Queues a refresh for when the application is idle, so several changes are processed once.
+	 */
+	void queueRefresh();
+
+	/**
+	 * Fills a row.
+	 * @param row
+	 * @param name
+	 * @param connection
+	 * @param load
+	 * @return the usage.
+	 */
+	float fillRow(Gtk::TreeRow& row, const string& name, Defaults::Connection connection, const FrameBudget::Load& load);
+};
+
+} /* namespace */
+
+#endif /* UI_DIALOGBANDWIDTH_HPP_ */
@@ -93,6 +93,7 @@ DialogColors::DialogColors(BaseObjectType* obj, Glib::RefPtr<Gtk::Builder> const
 }
 
 void DialogColors::setColorsFromFile(const string& path) {
+	TRACE_SPAN("setColorsFromFile");
 
 	resetColorButtons();
 
@@ -106,7 +107,8 @@ void DialogColors::setColorsFromFile(const string& path) {
 		if (xmlElement) {
 			for (; xmlElement; xmlElement = xmlElement->NextSiblingElement()) {
 				auto colorAttr = colorsXML.processNode(xmlElement);
-				XMLHelper::checkAttributes({NAME, "color"}, colorAttr, "color");
+				if (not XMLHelper::checkAttributes({NAME, "color"}, colorAttr, "color").empty())
+					continue;
 				if (colorAttr[NAME] == "Random" || colors.count(colorAttr[NAME]))
 					continue;
 				colors[colorAttr[NAME]] = colorAttr["color"];
@@ -114,6 +116,7 @@ void DialogColors::setColorsFromFile(const string& path) {
 		}
 	}
 	catch (...) {}
+	hexColors = colors;
 
 	// Remove current CSS data (if any).
 	auto styleContext = Gtk::StyleContext::create();
@@ -129,6 +132,7 @@ void DialogColors::setColorsFromFile(const string& path) {
 	if (c.size()) {
 		currentProvider = Gtk::CssProvider::create();
 		currentProvider->load_from_data(c);
+		Stats::add(Stats::Counters::CSS_RELOADS);
 		styleContext->add_provider_for_screen(
 			Gdk::Screen::get_default(),
 			currentProvider,
@@ -163,6 +167,19 @@ bool DialogColors::isValidColor(const string& colorName) {
 	return false;
 }
 
+string DialogColors::getHexColor(const string& colorName) const {
+	if (colorName == "On")
+		return "FFFFFF";
+	if (colorName == "Off")
+		return "000000";
+	auto c(hexColors.find(colorName));
+	return c == hexColors.end() ? "" : c->second;
+}
+
+const unordered_map<string, string>& DialogColors::getHexColors() const {
+	return hexColors;
+}
+
 void DialogColors::activateColorButton(Gtk::Button* button) {
 	colorButtons.push_back(button);
 	button->signal_clicked().connect([&, button]() {
@@ -174,6 +191,14 @@ void DialogColors::activateColorButton(Gtk::Button* button) {
 	});
 }
 
+bool DialogColors::pickColor(string& color) {
+	bool picked = run() == Gtk::ResponseType::RESPONSE_OK;
+	if (picked)
+		color = selectedColor;
+	hide();
+	return picked;
+}
+
 void DialogColors::activateColorPicker(Gtk::Button* button, Gtk::FlowBox* destination) {
 	colorBoxes.push_back(destination);
 	button->signal_clicked().connect([&, destination]() {
@@ -22,6 +22,7 @@
 
 #include "XMLHelper.hpp"
 #include "Message.hpp"
+#include "Trace.hpp"
 
 #ifndef UI_DIALOGCOLORS_HPP_
 #define UI_DIALOGCOLORS_HPP_ 1
@@ -66,6 +67,17 @@ public:
 	 */
 	bool isValidColor(const string& colorName);
 
+	/**
+	 * @param colorName
+	 * @return the RRGGBB value of a color from the current file, On and Off included, empty if unknown.
+	 */
+	string getHexColor(const string& colorName) const;
+
+	/**
+	 * @return the colors from the current file, name and RRGGBB value.
+	 */
+	const unordered_map<string, string>& getHexColors() const;
+
 	/**
 	 * Converts a button into a color picker for the destination box.
 	 * @param button
@@ -79,6 +91,13 @@ public:
 	 */
 	void activateColorButton(Gtk::Button* button);
 
+	/**
+	 * Runs the dialog to pick a color.
+	 * @param color receives the picked color, empty to clear.
+	 * @return true if a color was picked.
+	 */
+	bool pickColor(string& color);
+
 	/**
 	 * Set no color for all registered color buttons.
 	 */
@@ -106,6 +125,9 @@ protected:
 	/// Last Selected color.
 	string selectedColor;
 
+	/// Color name to RRGGBB, from the current file.
+	unordered_map<string, string> hexColors;
+
 	/// Css provider for the current color file.
 	Glib::RefPtr<Gtk::CssProvider> currentProvider;
 
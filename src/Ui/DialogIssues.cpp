@@ -0,0 +1,136 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogIssues.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DialogIssues.hpp"
+
+using namespace LEDSpicerUI::Ui;
+
+DialogIssues::DialogIssues(Gtk::Window* parent) :
+	store(Gtk::ListStore::create(columns)),
+	filter(Gtk::TreeModelFilter::create(store))
+{
+	set_title("Issues");
+	set_transient_for(*parent);
+	set_position(Gtk::WindowPosition::WIN_POS_CENTER_ON_PARENT);
+	set_default_size(900, 400);
+	set_modal(false);
+
+	auto box = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_VERTICAL, 2);
+	auto hbox = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_HORIZONTAL, 2);
+	hbox->get_style_context()->add_class("formContainer");
+	add(*box);
+	box->pack_start(*hbox, Gtk::PACK_SHRINK);
+
+	severity.append("",    "All");
+	severity.append("err", "Errors");
+	severity.append("wrn", "Warnings");
+	severity.set_active_id("");
+	hbox->pack_start(severity, Gtk::PACK_SHRINK);
+	search.set_placeholder_text("Filter");
+	hbox->pack_start(search);
+	hbox->pack_end(summary, Gtk::PACK_SHRINK);
+
+	filter->set_visible_func(sigc::mem_fun(*this, &DialogIssues::isVisible));
+	view.set_model(filter);
+	view.append_column("Type",    columns.severity);
+	view.append_column("File",    columns.source);
+	view.append_column("Line",    columns.line);
+	view.append_column("Where",   columns.place);
+	view.append_column("Problem", columns.message);
+	for (auto column : view.get_columns())
+		column->set_resizable(true);
+
+	auto scroll = Gtk::make_managed<Gtk::ScrolledWindow>();
+	scroll->add(view);
+	box->pack_start(*scroll);
+
+	severity.signal_changed().connect([&]() {
+		filter->refilter();
+	});
+	search.signal_search_changed().connect([&]() {
+		filter->refilter();
+	});
+	box->show_all();
+}
+
+void DialogIssues::display() {
+	if (Diagnostics::empty())
+		return;
+
+	fill(Diagnostics::getIssues());
+	showingLint = false;
+	set_title("Issues");
+	Diagnostics::clear();
+	severity.set_active_id("");
+	search.set_text("");
+	present();
+}
+
+void DialogIssues::displayLint(const vector<Diagnostics::Issue>& issues) {
+	fill(issues);
+	showingLint = true;
+	set_title("Project Check");
+	severity.set_active_id("");
+	search.set_text("");
+	present();
+}
+
+void DialogIssues::updateLint(const vector<Diagnostics::Issue>& issues) {
+	if (showingLint and get_visible())
+		fill(issues);
+}
+
+void DialogIssues::fill(const vector<Diagnostics::Issue>& issues) {
+	store->clear();
+	size_t errors = 0;
+	for (const auto& issue : issues) {
+		auto row = *(store->append());
+		row[columns.severity] = Diagnostics::toString(issue.severity);
+		row[columns.isError]  = issue.severity == Diagnostics::Severity::ERROR;
+		row[columns.source]   = Glib::path_get_basename(issue.source);
+		row[columns.line]     = issue.line ? std::to_string(issue.line) : "";
+		row[columns.place]    = issue.place;
+		row[columns.message]  = issue.message;
+		if (issue.severity == Diagnostics::Severity::ERROR)
+			++errors;
+	}
+	summary.set_text(std::to_string(errors) + " errors, " + std::to_string(issues.size() - errors) + " warnings");
+}
+
+bool DialogIssues::isVisible(const Gtk::TreeModel::const_iterator& iter) {
+	const auto row = *iter;
+	const string type(severity.get_active_id());
+	if (type == "err" and not row[columns.isError])
+		return false;
+	if (type == "wrn" and row[columns.isError])
+		return false;
+
+	string text(search.get_text());
+	if (text.empty())
+		return true;
+	for (auto column : {&columns.source, &columns.place, &columns.message}) {
+		const string value = row[*column];
+		if (value.find(text) != string::npos)
+			return true;
+	}
+	return false;
+}
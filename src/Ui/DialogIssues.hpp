@@ -0,0 +1,117 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogIssues.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Message.hpp"
+#include "Diagnostics.hpp"
+
+#ifndef UI_DIALOGISSUES_HPP_
+#define UI_DIALOGISSUES_HPP_ 1
+
+namespace LEDSpicerUI::Ui {
+
+/**
+ * LEDSpicerUI::Ui::DialogIssues
+ * Non modal window that lists the problems collected while importing.
+ */
+class DialogIssues: public Gtk::Window {
+
+public:
+
+	DialogIssues(Gtk::Window* parent);
+
+	virtual ~DialogIssues() = default;
+
+	/**
+	 * Displays the collected issues, if any, and clears the collector.
+	 */
+	void display();
+
+	/**
+	 * Displays the lint results.
+	 * @param issues
+	 */
+	void displayLint(const vector<Diagnostics::Issue>& issues);
+
+	/**
+	 * Refreshes the lint results if they are on screen.
+	 * @param issues
+	 */
+	void updateLint(const vector<Diagnostics::Issue>& issues);
+
+protected:
+
+	/**
+	 * Issues list columns.
+	 */
+	class Columns : public Gtk::TreeModelColumnRecord {
+	public:
+		Columns() {
+			add(severity);
+			add(isError);
+			add(source);
+			add(line);
+			add(place);
+			add(message);
+		}
+		Gtk::TreeModelColumn<string> severity;
+		Gtk::TreeModelColumn<bool>   isError;
+		Gtk::TreeModelColumn<string> source;
+		Gtk::TreeModelColumn<string> line;
+		Gtk::TreeModelColumn<string> place;
+		Gtk::TreeModelColumn<string> message;
+	};
+
+	Columns columns;
+
+	Glib::RefPtr<Gtk::ListStore> store;
+
+	Glib::RefPtr<Gtk::TreeModelFilter> filter;
+
+	/// Show all, only errors or only warnings.
+	Gtk::ComboBoxText severity;
+
+	/// Free text filter.
+	Gtk::SearchEntry search;
+
+	Gtk::TreeView view;
+
+	Gtk::Label summary;
+
+	/// The window shows the lint results, not the import issues.
+	bool showingLint = false;
+
+	/**
+	 * Replaces the listed issues.
+	 * @param issues
+	 */
+	void fill(const vector<Diagnostics::Issue>& issues);
+
+	/**
+	 * @param iter
+	 * @return true if the row matches the current filters.
+	 */
+	bool isVisible(const Gtk::TreeModel::const_iterator& iter);
+};
+
+} /* namespace */
+
+#endif /* UI_DIALOGISSUES_HPP_ */
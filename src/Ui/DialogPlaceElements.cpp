@@ -0,0 +1,351 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogPlaceElements.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "DialogPlaceElements.hpp"
+
+using namespace LEDSpicerUI::Ui;
+
+DialogPlaceElements::DialogPlaceElements(Gtk::Window* parent, Storage::BoxButtonCollection& devices, DialogIssues& dialogIssues) :
+	store(Gtk::ListStore::create(columns)),
+	btnPlace("Place"),
+	btnClone("Clone"),
+	btnApply("Apply"),
+	devices(devices),
+	dialogIssues(dialogIssues)
+{
+	set_title("Place Elements");
+	set_transient_for(*parent);
+	set_position(Gtk::WindowPosition::WIN_POS_CENTER_ON_PARENT);
+	set_default_size(700, 600);
+	set_modal(true);
+
+	auto box = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_VERTICAL, 2);
+	add(*box);
+
+	auto help = Gtk::make_managed<Gtk::Label>(
+		"One element per line, the name optionally followed by rgb or solenoid.\n"
+		"Names can be patterns, P{1..2}_BUTTON{1..8} creates 16 elements, {A,B} is a list.\n"
+		"Pins are taken from the free pins of all devices, RGB elements use three contiguous pins."
+	);
+	help->set_halign(Gtk::Align::ALIGN_START);
+	help->get_style_context()->add_class("formContainer");
+	box->pack_start(*help, Gtk::PACK_SHRINK);
+
+	auto specsScroll = Gtk::make_managed<Gtk::ScrolledWindow>();
+	specsScroll->add(specsView);
+	box->pack_start(*specsScroll);
+
+	btnPlace.get_style_context()->add_class("backgroundBlue");
+	box->pack_start(btnPlace, Gtk::PACK_SHRINK);
+	btnPlace.set_halign(Gtk::Align::ALIGN_END);
+
+	// Clone a device.
+	auto cloneBox = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_HORIZONTAL, 2);
+	cloneBox->get_style_context()->add_class("formContainer");
+	offset.set_range(-255, 255);
+	offset.set_increments(1, 10);
+	inputFind.set_placeholder_text("Replace");
+	inputReplace.set_placeholder_text("With");
+	inputFind.set_tooltip_text("Renames the copies, P1 with P2 turns P1_BUTTON1 into P2_BUTTON1");
+	cloneBox->pack_start(*Gtk::make_managed<Gtk::Label>("Clone"), Gtk::PACK_SHRINK);
+	cloneBox->pack_start(comboSource);
+	cloneBox->pack_start(*Gtk::make_managed<Gtk::Label>("into"), Gtk::PACK_SHRINK);
+	cloneBox->pack_start(comboTarget);
+	cloneBox->pack_start(*Gtk::make_managed<Gtk::Label>("pin offset"), Gtk::PACK_SHRINK);
+	cloneBox->pack_start(offset, Gtk::PACK_SHRINK);
+	cloneBox->pack_start(inputFind, Gtk::PACK_SHRINK);
+	cloneBox->pack_start(inputReplace, Gtk::PACK_SHRINK);
+	btnClone.get_style_context()->add_class("backgroundBlue");
+	cloneBox->pack_start(btnClone, Gtk::PACK_SHRINK);
+	box->pack_start(*cloneBox, Gtk::PACK_SHRINK);
+
+	view.set_model(store);
+	view.append_column("Element", columns.name);
+	view.append_column("Device",  columns.device);
+	view.append_column("Pins",    columns.pins);
+	for (auto column : view.get_columns())
+		column->set_resizable(true);
+	auto viewScroll = Gtk::make_managed<Gtk::ScrolledWindow>();
+	viewScroll->add(view);
+	box->pack_start(*viewScroll);
+
+	auto buttons = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_HORIZONTAL, 2);
+	buttons->get_style_context()->add_class("formContainer");
+	summary.set_halign(Gtk::Align::ALIGN_START);
+	buttons->pack_start(summary);
+	btnApply.get_style_context()->add_class("backgroundGreen");
+	buttons->pack_start(btnApply, Gtk::PACK_SHRINK);
+	box->pack_start(*buttons, Gtk::PACK_SHRINK);
+	box->show_all();
+
+	btnPlace.signal_clicked().connect(sigc::mem_fun(*this, &DialogPlaceElements::place));
+	btnClone.signal_clicked().connect(sigc::mem_fun(*this, &DialogPlaceElements::clone));
+	btnApply.signal_clicked().connect(sigc::mem_fun(*this, &DialogPlaceElements::apply));
+	// Any edit invalidates the result.
+	specsView.get_buffer()->signal_changed().connect([&]() {
+		btnApply.set_sensitive(false);
+	});
+}
+
+void DialogPlaceElements::display() {
+	pending.clear();
+	store->clear();
+	summary.set_text("");
+	btnApply.set_sensitive(false);
+	comboSource.remove_all();
+	comboTarget.remove_all();
+	for (auto d : devices) {
+		comboSource.append(d->getData()->createUniqueId(), d->getData()->createPrettyName());
+		comboTarget.append(d->getData()->createUniqueId(), d->getData()->createPrettyName());
+	}
+	comboSource.set_active(0);
+	comboTarget.set_active(0);
+	present();
+}
+
+unordered_set<string> DialogPlaceElements::getUsedNames() {
+	const auto& names(Storage::CollectionHandler::getInstance(COLLECTION_ELEMENT)->get());
+	return unordered_set<string>(names.begin(), names.end());
+}
+
+LEDSpicerUI::Ui::Storage::Device* DialogPlaceElements::findDevice(const string& id) {
+	for (auto d : devices)
+		if (d->getData()->createUniqueId() == id)
+			return dynamic_cast<Storage::Device*>(d->getData());
+	return nullptr;
+}
+
+vector<string> DialogPlaceElements::readSpecs(vector<PinSolver::Spec>& specs) {
+	vector<string> skipped;
+	unordered_set<string> names(getUsedNames());
+	for (auto& line : Defaults::explode(specsView.get_buffer()->get_text(), '\n')) {
+		Defaults::trim(line);
+		if (line.empty())
+			continue;
+		auto parts(Defaults::explode(line, ' ', 2));
+		PinSolver::Kinds kind = PinSolver::Kinds::SINGLE;
+		if (parts.size() > 1) {
+			string k(parts[1]);
+			Defaults::trim(k);
+			if (k == "rgb" or k == "RGB")
+				kind = PinSolver::Kinds::RGB;
+			else if (k == "solenoid" or k == "SOLENOID")
+				kind = PinSolver::Kinds::SOLENOID;
+		}
+		for (auto& name : Defaults::expandPattern(parts[0], MAX_ELEMENTS - specs.size())) {
+			name = Defaults::createCommonUniqueId({name});
+			if (not names.insert(name).second) {
+				skipped.push_back(name);
+				continue;
+			}
+			specs.push_back({std::move(name), kind});
+		}
+	}
+	return skipped;
+}
+
+void DialogPlaceElements::place() {
+	vector<PinSolver::Spec> specs;
+	vector<string> skipped;
+	try {
+		skipped = readSpecs(specs);
+	}
+	catch (Message& e) {
+		e.displayError(this);
+		return;
+	}
+
+	vector<Storage::Device*> boardDevices;
+	vector<PinSolver::Board> boards;
+	for (auto d : devices) {
+		auto device = dynamic_cast<Storage::Device*>(d->getData());
+		if (not device or device->getType() == Defaults::DeviceType::invalid)
+			continue;
+		PinSolver::Board board{device->createUniqueId(), device->getPins(), Defaults::isMonocrome(device->getType()), {}};
+		for (auto e : device->getElements())
+			for (auto pin : {PIN, SOLENOID, RED_PIN, GREEN_PIN, BLUE_PIN}) {
+				const string value(e->getData()->getValue(pin));
+				if (Defaults::isBetween(value, 1, board.pins))
+					board.used.push_back(std::stoi(value));
+			}
+		boards.push_back(std::move(board));
+		boardDevices.push_back(device);
+	}
+
+	auto result(PinSolver::solve(boards, specs));
+
+	pending.clear();
+	for (const auto& placement : result.placements)
+		pending.push_back({boardDevices[placement.board], createElement(specs[placement.spec], placement.pin)});
+
+	string text(
+		std::to_string(result.placements.size()) + " elements on " +
+		std::to_string(result.boards) + " devices, " +
+		std::to_string(result.freePins) + " pins left"
+	);
+	if (not result.unplaced.empty()) {
+		vector<string> names;
+		for (auto s : result.unplaced)
+			names.push_back(specs[s].name);
+		text += "\n" + std::to_string(result.unplaced.size()) + " did not fit, " +
+			(result.missingPins ? std::to_string(result.missingPins) + " pins missing" : "not enough contiguous pins for RGB") +
+			": " + Defaults::implode(names, ", ");
+	}
+	if (not skipped.empty())
+		text += "\nSkipped existing or repeated names: " + Defaults::implode(skipped, ", ");
+	if (specs.size() == MAX_ELEMENTS)
+		text += "\nOnly " + std::to_string(MAX_ELEMENTS) + " elements can be created at once";
+	showPending(text);
+}
+
+void DialogPlaceElements::clone() {
+	auto
+		source = findDevice(comboSource.get_active_id()),
+		target = findDevice(comboTarget.get_active_id());
+	if (not source or not target)
+		return;
+
+	const int shift = offset.get_value_as_int();
+	const string
+		find(inputFind.get_text()),
+		replace(inputReplace.get_text());
+
+	// Pins already used in the target.
+	vector<bool> used(target->getPins() + 1, false);
+	for (auto e : target->getElements())
+		for (auto pin : {PIN, SOLENOID, RED_PIN, GREEN_PIN, BLUE_PIN}) {
+			const string value(e->getData()->getValue(pin));
+			if (Defaults::isBetween(value, 1, target->getPins()))
+				used[std::stoi(value)] = true;
+		}
+
+	pending.clear();
+	unordered_set<string> names(getUsedNames());
+	vector<string> skipped;
+	for (auto e : source->getElements()) {
+		unordered_map<string, string> values(e->getData()->getValues()->begin(), e->getData()->getValues()->end());
+
+		// Move the pins, all of them need to fit.
+		vector<int> pins;
+		bool fits = true;
+		for (auto pin : {PIN, SOLENOID, RED_PIN, GREEN_PIN, BLUE_PIN}) {
+			auto value(values.find(pin));
+			if (value == values.end() or not Defaults::isNumber(value->second) or value->second.empty())
+				continue;
+			int moved = std::stoi(value->second) + shift;
+			if (moved < 1 or moved > target->getPins() or used[moved]) {
+				fits = false;
+				break;
+			}
+			value->second = std::to_string(moved);
+			pins.push_back(moved);
+		}
+
+		string name(values[NAME]);
+		if (not find.empty()) {
+			for (size_t position = name.find(find); position != string::npos; position = name.find(find, position + replace.size())) {
+				name.replace(position, find.size(), replace);
+			}
+		}
+		if (not fits or pins.empty()) {
+			skipped.push_back(values[NAME]);
+			continue;
+		}
+		// A hash lookup per try, not a scan of the collection.
+		if (names.count(name)) {
+			const string base(name + "_copy");
+			name = base;
+			for (size_t count = 1; names.count(name); ++count)
+				name = base + std::to_string(count);
+		}
+		names.insert(name);
+		values[NAME] = name;
+		for (auto pin : pins)
+			used[pin] = true;
+		pending.push_back({target, std::move(values)});
+	}
+
+	string text(std::to_string(pending.size()) + " elements cloned into " + target->createPrettyName());
+	if (not skipped.empty())
+		text += "\nPins out of range or in use: " + Defaults::implode(skipped, ", ");
+	showPending(text);
+}
+
+void DialogPlaceElements::showPending(const string& text) {
+	store->clear();
+	for (const auto& element : pending) {
+		auto row = *(store->append());
+		row[columns.name]   = element.values.at(NAME);
+		row[columns.device] = element.device->createPrettyName();
+		vector<string> pins;
+		for (auto pin : {PIN, SOLENOID, RED_PIN, GREEN_PIN, BLUE_PIN}) {
+			auto value(element.values.find(pin));
+			if (value != element.values.end())
+				pins.push_back(value->second);
+		}
+		row[columns.pins] = Defaults::implode(pins, ',');
+	}
+	summary.set_text(text);
+	btnApply.set_sensitive(not pending.empty());
+}
+
+void DialogPlaceElements::apply() {
+	// One batch per device.
+	unordered_map<Storage::Device*, Batch> batches;
+	for (auto& element : pending)
+		batches[element.device].add(
+			Defaults::createCommonUniqueId({element.device->createUniqueId(), COLLECTION_ELEMENT}),
+			std::move(element.values)
+		);
+	pending.clear();
+
+	Diagnostics::clear();
+	for (auto& batch : batches) {
+		batch.first->loadElements(&batch.second);
+		// One notification per device, not per element.
+		DataDialogs::DialogForm::signalDataChanged().emit(batch.first, batch.first->createUniqueId());
+	}
+	Defaults::markDirty();
+	hide();
+	dialogIssues.display();
+}
+
+unordered_map<string, string> DialogPlaceElements::createElement(const PinSolver::Spec& spec, uint16_t pin) {
+	unordered_map<string, string> element{
+		{NAME, spec.name},
+		{TYPE, Defaults::detectElementType(spec.name)}
+	};
+	switch (spec.kind) {
+	case PinSolver::Kinds::RGB:
+		element.emplace(RED_PIN,   std::to_string(pin));
+		element.emplace(GREEN_PIN, std::to_string(pin + 1));
+		element.emplace(BLUE_PIN,  std::to_string(pin + 2));
+		break;
+	case PinSolver::Kinds::SOLENOID:
+		element.emplace(SOLENOID, std::to_string(pin));
+		break;
+	default:
+		element.emplace(PIN, std::to_string(pin));
+	}
+	return element;
+}
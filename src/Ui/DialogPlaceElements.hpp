@@ -0,0 +1,181 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogPlaceElements.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "PinSolver.hpp"
+#include "DialogIssues.hpp"
+#include "Storage/Device.hpp"
+
+#include <unordered_set>
+using std::unordered_set;
+
+#ifndef UI_DIALOGPLACEELEMENTS_HPP_
+#define UI_DIALOGPLACEELEMENTS_HPP_ 1
+
+namespace LEDSpicerUI::Ui {
+
+/**
+ * LEDSpicerUI::Ui::DialogPlaceElements
+ * Window to create many elements at once:
+ * - From a list of names or patterns, the pins are picked by the PinSolver across all the devices.
+ * - Cloning the elements of a device into another one with a pin offset.
+ * Nothing changes until the result is applied, then every device loads its new elements in one go.
+ */
+class DialogPlaceElements: public Gtk::Window {
+
+public:
+
+	/// Maximum number of elements a pattern can create.
+	static constexpr size_t MAX_ELEMENTS = 4096;
+
+	/**
+	 * @param parent
+	 * @param devices the devices that will receive the elements.
+	 * @param dialogIssues to report elements that could not be loaded.
+	 */
+	DialogPlaceElements(Gtk::Window* parent, Storage::BoxButtonCollection& devices, DialogIssues& dialogIssues);
+
+	virtual ~DialogPlaceElements() = default;
+
+	/**
+	 * Clears the previous result and displays the window.
+	 */
+	void display();
+
+protected:
+
+	/**
+	 * Tree columns.
+	 */
+	class Columns : public Gtk::TreeModelColumnRecord {
+	public:
+		Columns() {
+			add(name);
+			add(device);
+			add(pins);
+		}
+		Gtk::TreeModelColumn<string> name;
+		Gtk::TreeModelColumn<string> device;
+		Gtk::TreeModelColumn<string> pins;
+	};
+
+	/**
+	 * Elements waiting to be loaded, stored like a config file does.
+	 */
+	class Batch : public XMLHelper {
+	public:
+		void add(const string& collection, unordered_map<string, string>&& values) {
+			extractedData[collection].push_back(std::move(values));
+		}
+	};
+
+	/**
+	 * An element ready to be created.
+	 */
+	struct Pending {
+		Storage::Device* device;
+		unordered_map<string, string> values;
+	};
+
+	Columns columns;
+
+	Glib::RefPtr<Gtk::ListStore> store;
+
+	Gtk::TreeView view;
+
+	Gtk::TextView specsView;
+
+	Gtk::Label summary;
+
+	Gtk::ComboBoxText
+		comboSource,
+		comboTarget;
+
+	Gtk::SpinButton offset;
+
+	Gtk::Entry
+		inputFind,
+		inputReplace;
+
+	Gtk::Button
+		btnPlace,
+		btnClone,
+		btnApply;
+
+	Storage::BoxButtonCollection& devices;
+
+	DialogIssues& dialogIssues;
+
+	/// Elements that will be created on apply.
+	vector<Pending> pending;
+
+	/**
+	 * @return the names of all the elements in the project, to check new names.
+	 */
+	static unordered_set<string> getUsedNames();
+
+	/**
+	 * @param id
+	 * @return the device with that unique id, or nullptr.
+	 */
+	Storage::Device* findDevice(const string& id);
+
+	/**
+	 * Reads the specs, one pattern per line, optionally followed by rgb or solenoid.
+	 * Names already in use or repeated are skipped.
+	 * @param specs
+	 * @return the skipped names.
+	 */
+	vector<string> readSpecs(vector<PinSolver::Spec>& specs);
+
+	/**
+	 * Solves the placement and shows it.
+	 */
+	void place();
+
+	/**
+	 * Copies the elements of the source device into the target one, moving the pins by the offset.
+	 */
+	void clone();
+
+	/**
+	 * Shows the pending elements.
+	 * @param text summary text.
+	 */
+	void showPending(const string& text);
+
+	/**
+	 * Creates the pending elements.
+	 */
+	void apply();
+
+	/**
+	 * @param spec
+	 * @param pin the first pin.
+	 * @return the element values.
+	 */
+	static unordered_map<string, string> createElement(const PinSolver::Spec& spec, uint16_t pin);
+};
+
+} /* namespace */
+
+#endif /* UI_DIALOGPLACEELEMENTS_HPP_ */
@@ -0,0 +1,270 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogPreview.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DialogPreview.hpp"
+
+#include <cmath>
+
+using namespace LEDSpicerUI::Ui;
+
+DialogPreview::DialogPreview(
+	Gtk::Window* parent,
+	const Storage::BoxButtonCollection& devices,
+	const Storage::BoxButtonCollection& groups,
+	const Storage::BoxButtonCollection& profiles,
+	const Storage::BoxButtonCollection& animations,
+	const Storage::BoxButtonCollection& inputs,
+	ProfileResolver& profileResolver
+) :
+	devices(devices),
+	groups(groups),
+	profiles(profiles),
+	animations(animations),
+	inputs(inputs),
+	profileResolver(profileResolver)
+{
+	set_title("Preview");
+	set_transient_for(*parent);
+	set_position(Gtk::WindowPosition::WIN_POS_CENTER_ON_PARENT);
+	set_default_size(900, 500);
+	set_modal(false);
+
+	auto box = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_VERTICAL, 2);
+	auto hbox = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_HORIZONTAL, 2);
+	hbox->get_style_context()->add_class("formContainer");
+	add(*box);
+	box->pack_start(*hbox, Gtk::PACK_SHRINK);
+
+	hbox->pack_start(*Gtk::make_managed<Gtk::Label>("Profile"), Gtk::PACK_SHRINK);
+	hbox->pack_start(inputProfile, Gtk::PACK_SHRINK);
+	inputTrigger.set_placeholder_text("Trigger");
+	inputTrigger.set_tooltip_text("Fires the input maps of the profile with this trigger");
+	hbox->pack_start(inputTrigger, Gtk::PACK_SHRINK);
+	auto btnTrigger = Gtk::make_managed<Gtk::Button>("Fire");
+	btnTrigger->get_style_context()->add_class("backgroundGreen");
+	hbox->pack_start(*btnTrigger, Gtk::PACK_SHRINK);
+
+	box->pack_start(area);
+	box->pack_start(summary, Gtk::PACK_SHRINK);
+	summary.set_halign(Gtk::Align::ALIGN_START);
+
+	inputProfile.signal_changed().connect(sigc::mem_fun(*this, &DialogPreview::loadProfile));
+	inputTrigger.signal_activate().connect(sigc::mem_fun(*this, &DialogPreview::fireTrigger));
+	btnTrigger->signal_clicked().connect(sigc::mem_fun(*this, &DialogPreview::fireTrigger));
+	area.signal_draw().connect(sigc::mem_fun(*this, &DialogPreview::onDraw));
+
+	// Any edit while open, the engine is rebuilt outside the forms.
+	DataDialogs::DialogForm::signalDataChanged().connect([&](const Storage::Data*, const string&) {
+		outdated = true;
+	});
+	DataDialogs::DialogForm::signalBulkChanged().connect([&](const vector<const Storage::Data*>&) {
+		outdated = true;
+	});
+
+	signal_hide().connect([&]() {
+		if (tickId)
+			area.remove_tick_callback(tickId);
+		tickId = 0;
+		statsTimer.disconnect();
+	});
+	box->show_all();
+}
+
+void DialogPreview::setFps(uint16_t fps) {
+	DialogPreview::fps = fps;
+	engine.setFps(fps);
+}
+
+void DialogPreview::display() {
+	const string selected(inputProfile.get_active_text());
+	inputProfile.remove_all();
+	for (auto p : profiles)
+		inputProfile.append(p->getData()->getValue(FILENAME));
+	createLayout();
+	// Reloads the profile.
+	inputProfile.set_active_text(selected);
+	if (inputProfile.get_active_row_number() < 0)
+		inputProfile.set_active(0);
+	loadProfile();
+
+	if (not tickId)
+		tickId = area.add_tick_callback(sigc::mem_fun(*this, &DialogPreview::onTick));
+	if (not statsTimer.connected())
+		statsTimer = Glib::signal_timeout().connect([&]() {
+			summary.set_text(
+				std::to_string(engine.getLeds()) + " LEDs at " + std::to_string(fps) + " FPS " +
+				PreviewEngine::toString(engine.getStats(), fps) +
+				" Present: " + std::to_string(static_cast<uint32_t>(presentTime)) + "µs"
+			);
+			return true;
+		}, STATS_TIME);
+	outdated = false;
+	show();
+	present();
+}
+
+void DialogPreview::createLayout() {
+	leds.clear();
+	for (auto d : devices)
+		for (auto e : dynamic_cast<const Storage::Device*>(d->getData())->getElements())
+			leds.emplace(e->getData()->getValue(NAME), leds.size());
+
+	engine.setLayout(leds.size());
+	engine.setFps(fps);
+	// Twice as wide as tall.
+	columns = std::max<uint32_t>(1, std::ceil(std::sqrt(leds.size() * 2.0)));
+	uint32_t rows = std::max<uint32_t>(1, (leds.size() + columns - 1) / columns);
+	surface = Cairo::ImageSurface::create(Cairo::Format::FORMAT_RGB24, columns, rows);
+}
+
+void DialogPreview::loadProfile() {
+	engine.clearActors();
+	const string name(inputProfile.get_active_text());
+	auto profile(dynamic_cast<const Storage::Profile*>(find(profiles, FILENAME, name)));
+	vector<std::pair<uint32_t, PreviewEngine::Color>> lit;
+	if (profile) {
+		// Every element has a color, the background included.
+		for (const auto& [element, color] : profileResolver.resolve({name})) {
+			auto led(leds.find(element));
+			if (led != leds.end())
+				lit.emplace_back(led->second, toColor(color));
+		}
+	}
+	engine.setBase(PreviewEngine::Color(), lit);
+	engine.restart();
+	if (not profile)
+		return;
+
+	for (auto b : profile->getAnimations()) {
+		auto animation(dynamic_cast<Storage::Animation*>(find(animations, NAME, b->getData()->getValue(NAME))));
+		if (not animation)
+			continue;
+		try {
+			for (const auto& actor : animation->getActors()) {
+				auto colors(Defaults::explode(XMLHelper::valueOf(actor, "colors"), ','));
+				const string color(XMLHelper::valueOf(actor, COLOR, colors.empty() ? "" : colors.front()));
+				engine.addActor(
+					XMLHelper::valueOf(actor, TYPE),
+					findLeds(GROUP, XMLHelper::valueOf(actor, ACTOR_TARGET)),
+					toColor(color),
+					toColor(colors.size() > 1 ? colors[1] : "Off"),
+					XMLHelper::valueOf(actor, SPEED),
+					XMLHelper::valueOf(actor, "direction").find("Backward") == 0
+				);
+			}
+		}
+		catch (Message& e) {
+			summary.set_text(XMLHelper::cleanError(e.getMessage()));
+		}
+	}
+}
+
+void DialogPreview::fireTrigger() {
+	const string trigger(inputTrigger.get_text());
+	auto profile(dynamic_cast<const Storage::Profile*>(find(profiles, FILENAME, inputProfile.get_active_text())));
+	if (not profile or trigger.empty())
+		return;
+	for (auto b : profile->getInputs()) {
+		auto input(dynamic_cast<const Storage::Input*>(find(inputs, FILENAME, b->getData()->getValue(NAME))));
+		if (not input)
+			continue;
+		for (auto m : input->getMaps()) {
+			auto map(m->getData());
+			if (map->getValue(TRIGGER) == trigger)
+				engine.trigger(findLeds(map->getValue(TYPE), map->getValue(TARGET)), toColor(map->getValue(COLOR)), TRIGGER_TIME);
+		}
+	}
+}
+
+vector<uint32_t> DialogPreview::findLeds(const string& type, const string& target) const {
+	vector<uint32_t> r;
+	if (type == ELEMENT) {
+		auto led(leds.find(target));
+		if (led != leds.end())
+			r.push_back(led->second);
+		return r;
+	}
+	auto group(dynamic_cast<const Storage::Group*>(find(groups, NAME, target)));
+	if (not group)
+		return r;
+	for (auto e : group->getElements()) {
+		auto led(leds.find(e->getData()->getValue(NAME)));
+		if (led != leds.end())
+			r.push_back(led->second);
+	}
+	return r;
+}
+
+LEDSpicerUI::PreviewEngine::Color DialogPreview::toColor(const string& colorName) const {
+	return PreviewEngine::Color::fromHex(DialogColors::getInstance()->getHexColor(colorName));
+}
+
+LEDSpicerUI::Ui::Storage::Data* DialogPreview::find(const Storage::BoxButtonCollection& collection, const string& key, const string& name) {
+	for (auto b : collection)
+		if (b->getData()->getValue(key) == name)
+			return b->getData();
+	return nullptr;
+}
+
+bool DialogPreview::onTick(const Glib::RefPtr<Gdk::FrameClock>& clock) {
+	if (outdated) {
+		outdated = false;
+		createLayout();
+		loadProfile();
+	}
+	if (engine.update(clock->get_frame_time())) {
+		present();
+		area.queue_draw();
+	}
+	return true;
+}
+
+void DialogPreview::present() {
+	auto start(std::chrono::steady_clock::now());
+	surface->flush();
+	const uint8_t* frame(engine.getFrame());
+	unsigned char* data(surface->get_data());
+	const int stride(surface->get_stride());
+	for (uint32_t led = 0, total = engine.getLeds(); led < total; data += stride) {
+		auto row(reinterpret_cast<uint32_t*>(data));
+		for (uint32_t c = 0; c < columns and led < total; ++c, ++led, frame += 3)
+			row[c] = frame[0] << 16 | frame[1] << 8 | frame[2];
+	}
+	surface->mark_dirty();
+	double elapsed(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+	presentTime = presentTime ? presentTime + (elapsed - presentTime) * PreviewEngine::SMOOTHING : elapsed;
+}
+
+bool DialogPreview::onDraw(const Cairo::RefPtr<Cairo::Context>& cr) {
+	if (not surface)
+		return false;
+	// Keep the LEDs square.
+	double scale(std::min(
+		static_cast<double>(area.get_allocated_width())  / surface->get_width(),
+		static_cast<double>(area.get_allocated_height()) / surface->get_height()
+	));
+	cr->scale(scale, scale);
+	cr->set_source(surface, 0, 0);
+	Cairo::RefPtr<Cairo::SurfacePattern>::cast_static(cr->get_source())->set_filter(Cairo::Filter::FILTER_NEAREST);
+	cr->paint();
+	return true;
+}
@@ -0,0 +1,170 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogPreview.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PreviewEngine.hpp"
+#include "ProfileResolver.hpp"
+#include "Storage/Animation.hpp"
+#include "Storage/Input.hpp"
+
+#ifndef UI_DIALOGPREVIEW_HPP_
+#define UI_DIALOGPREVIEW_HPP_ 1
+
+namespace LEDSpicerUI::Ui {
+
+/**
+ * LEDSpicerUI::Ui::DialogPreview
+ * Non modal window that renders a profile on every element, one square per element in device order.
+ * Animations run at the configured FPS, typing a trigger fires the input maps of the profile.
+ */
+class DialogPreview: public Gtk::Window {
+
+public:
+
+	/// How long a trigger stays lit, in seconds.
+	static constexpr float TRIGGER_TIME = 1;
+
+	/// How often the stats are refreshed, in milliseconds.
+	static constexpr uint STATS_TIME = 500;
+
+	DialogPreview(
+		Gtk::Window* parent,
+		const Storage::BoxButtonCollection& devices,
+		const Storage::BoxButtonCollection& groups,
+		const Storage::BoxButtonCollection& profiles,
+		const Storage::BoxButtonCollection& animations,
+		const Storage::BoxButtonCollection& inputs,
+		ProfileResolver& profileResolver
+	);
+
+	virtual ~DialogPreview() = default;
+
+	/**
+	 * @param fps
+	 */
+	void setFps(uint16_t fps);
+
+	/**
+	 * Rebuilds and displays the preview.
+	 */
+	void display();
+
+protected:
+
+	const Storage::BoxButtonCollection
+		& devices,
+		& groups,
+		& profiles,
+		& animations,
+		& inputs;
+
+	ProfileResolver& profileResolver;
+
+	PreviewEngine engine;
+
+	uint16_t fps = 60;
+
+	/// Element name to LED.
+	unordered_map<string, uint32_t> leds;
+
+	/// LEDs per row.
+	uint32_t columns = 1;
+
+	/// The frame, one pixel per LED.
+	Cairo::RefPtr<Cairo::ImageSurface> surface;
+
+	/// Microseconds to copy a frame into the surface, average.
+	double presentTime = 0;
+
+	/// Set when any data changes, the preview is rebuilt on the next tick.
+	bool outdated = false;
+
+	/// Tick callback, 0 when not running.
+	guint tickId = 0;
+
+	sigc::connection statsTimer;
+
+	Gtk::ComboBoxText inputProfile;
+
+	Gtk::Entry inputTrigger;
+
+	Gtk::DrawingArea area;
+
+	Gtk::Label summary;
+
+	/**
+	 * Assigns a LED to every element.
+	 */
+	void createLayout();
+
+	/**
+	 * Sets the base colors and the actors from the selected profile.
+	 */
+	void loadProfile();
+
+	/**
+	 * Lights the targets of every map with the trigger in the entry.
+	 */
+	void fireTrigger();
+
+	/**
+	 * @param type Element or Group.
+	 * @param target
+	 * @return the LEDs of the target.
+	 */
+	vector<uint32_t> findLeds(const string& type, const string& target) const;
+
+	/**
+	 * @param colorName
+	 * @return the color, black if unknown.
+	 */
+	PreviewEngine::Color toColor(const string& colorName) const;
+
+	/**
+	 * @param collection
+	 * @param key
+	 * @param name
+	 * @return the data with that name or nullptr.
+	 */
+	static Storage::Data* find(const Storage::BoxButtonCollection& collection, const string& key, const string& name);
+
+	/**
+	 * Runs on every frame of the window.
+	 * @param clock
+	 * @return
+	 */
+	bool onTick(const Glib::RefPtr<Gdk::FrameClock>& clock);
+
+	/**
+	 * Copies the engine frame into the surface.
+	 */
+	void present();
+
+	/**
+	 * @param cr
+	 * @return
+	 */
+	bool onDraw(const Cairo::RefPtr<Cairo::Context>& cr);
+};
+
+} /* namespace */
+
+#endif /* UI_DIALOGPREVIEW_HPP_ */
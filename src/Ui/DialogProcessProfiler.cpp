@@ -0,0 +1,137 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogProcessProfiler.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "DialogProcessProfiler.hpp"
+
+using namespace LEDSpicerUI::Ui;
+
+DialogProcessProfiler::DialogProcessProfiler(Gtk::Window* parent) :
+	Gtk::Dialog("Process Lookup Profiler", *parent, true),
+	budget(Gtk::Adjustment::create(0.5, 0.01, 10, 0.05, 0.5), 0.05, 2),
+	samples(Gtk::Adjustment::create(10, 1, 1000, 1, 10))
+{
+	set_position(Gtk::WindowPosition::WIN_POS_CENTER_ON_PARENT);
+
+	add_button("_Close", Gtk::RESPONSE_CANCEL)->get_style_context()->add_class("backgroundRed");
+	btnApply = add_button("_Use Suggested", Gtk::RESPONSE_APPLY);
+	btnApply->get_style_context()->add_class("backgroundGreen");
+
+	auto grid = Gtk::make_managed<Gtk::Grid>();
+	grid->get_style_context()->add_class("formContainer");
+	grid->set_row_spacing(5);
+	grid->set_column_spacing(5);
+	grid->attach(*Gtk::make_managed<Gtk::Label>("CPU budget (%)", Gtk::Align::ALIGN_START), 0, 0);
+	grid->attach(budget, 1, 0);
+	grid->attach(*Gtk::make_managed<Gtk::Label>("Scans", Gtk::Align::ALIGN_START), 0, 1);
+	grid->attach(samples, 1, 1);
+	grid->attach(*Gtk::make_managed<Gtk::Label>("Processes directory", Gtk::Align::ALIGN_START), 0, 2);
+	grid->attach(procRoot, 1, 2);
+	btnRun = Gtk::make_managed<Gtk::Button>("Run");
+	grid->attach(*btnRun, 0, 3, 2);
+	result.set_halign(Gtk::Align::ALIGN_START);
+	grid->attach(result, 0, 4, 2);
+
+	procRoot.set_text(PROC_ROOT);
+	procRoot.set_tooltip_text("Use a copy of a proc directory to get reproducible results");
+	btnRun->signal_clicked().connect(sigc::mem_fun(*this, &DialogProcessProfiler::onRun));
+	finished.connect(sigc::mem_fun(*this, &DialogProcessProfiler::onFinished));
+
+	get_content_area()->add(*grid);
+	grid->show_all();
+}
+
+DialogProcessProfiler::~DialogProcessProfiler() {
+	stop();
+}
+
+uint DialogProcessProfiler::profile(const vector<string>& names, uint runEvery) {
+	this->names    = names;
+	this->runEvery = runEvery ? runEvery : DEFAULT_RUN_EVERY;
+	suggestion     = 0;
+	result.set_text("");
+	btnApply->set_sensitive(false);
+	int response = run();
+	stop();
+	hide();
+	return response == Gtk::RESPONSE_APPLY ? suggestion : 0;
+}
+
+void DialogProcessProfiler::onRun() {
+	if (worker.joinable())
+		return;
+	btnRun->set_sensitive(false);
+	btnApply->set_sensitive(false);
+	const uint scans(samples.get_value_as_int());
+	result.set_text("Profiling, about " + std::to_string((scans - 1) * runEvery / 1000) + " seconds...");
+	cancel = false;
+	error.clear();
+	worker = std::thread([&, scans, root = procRoot.get_text().raw()]() {
+		try {
+			ProcessProfiler profiler(names, root);
+			measured = profiler.profile(scans, runEvery, cancel);
+		}
+		catch (Message& e) {
+			error = e.getMessage();
+		}
+		finished.emit();
+	});
+}
+
+void DialogProcessProfiler::onFinished() {
+	if (worker.joinable())
+		worker.join();
+	btnRun->set_sensitive(true);
+	// Closed while profiling.
+	if (cancel)
+		return;
+	if (not error.empty()) {
+		result.set_text("");
+		Message::displayError(error, this);
+		return;
+	}
+	const auto& r(measured);
+	suggestion = ProcessProfiler::suggestRunEvery(r.cpuPerScan, budget.get_value() / 100);
+	char text[512];
+	snprintf(
+		text,
+		sizeof(text),
+		"%u processes, %u matching, %.1fµs CPU (%.1fµs wall) per scan.\n"
+		"Every %ums uses %.3f%% CPU, suggested interval: %ums.",
+		r.processes,
+		r.matches,
+		r.cpuPerScan,
+		r.wallPerScan,
+		runEvery,
+		ProcessProfiler::cpuUsage(r.cpuPerScan, runEvery) * 100,
+		suggestion
+	);
+	result.set_text(text);
+	btnApply->set_sensitive(suggestion != runEvery);
+}
+
+void DialogProcessProfiler::stop() {
+	cancel = true;
+	if (worker.joinable())
+		worker.join();
+	btnRun->set_sensitive(true);
+}
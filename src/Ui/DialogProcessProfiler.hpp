@@ -0,0 +1,111 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogProcessProfiler.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Message.hpp"
+#include "ProcessProfiler.hpp"
+
+#include <thread>
+
+#ifndef UI_DIALOGPROCESSPROFILER_HPP_
+#define UI_DIALOGPROCESSPROFILER_HPP_ 1
+
+namespace LEDSpicerUI::Ui {
+
+/**
+ * LEDSpicerUI::Ui::DialogProcessProfiler
+ * Dialog to measure the cost of the process lookup and suggest an interval for a CPU budget.
+ * The scans run on a worker at the current interval, the dialog stays responsive meanwhile.
+ */
+class DialogProcessProfiler: public Gtk::Dialog {
+
+public:
+
+	DialogProcessProfiler(Gtk::Window* parent);
+
+	virtual ~DialogProcessProfiler();
+
+	/**
+	 * Runs the dialog.
+	 * @param names the process names to look for.
+	 * @param runEvery the current interval in milliseconds, 0 for the default.
+	 * @return the suggested interval if the user accepted it, 0 otherwise.
+	 */
+	uint profile(const vector<string>& names, uint runEvery);
+
+protected:
+
+	/// Allowed CPU usage, in percent of one core.
+	Gtk::SpinButton budget;
+
+	/// Number of scans to average.
+	Gtk::SpinButton samples;
+
+	/// Directory with the processes, can be a fake one for benchmarks.
+	Gtk::Entry procRoot;
+
+	Gtk::Label result;
+
+	Gtk::Button
+		* btnApply = nullptr,
+		* btnRun   = nullptr;
+
+	vector<string> names;
+
+	uint
+		runEvery   = 0,
+		suggestion = 0;
+
+	/// Runs the scans.
+	std::thread worker;
+
+	/// Set to stop the worker.
+	std::atomic<bool> cancel{false};
+
+	/// Brings the worker results into the UI thread.
+	Glib::Dispatcher finished;
+
+	/// Worker results, read after the worker ends.
+	ProcessProfiler::Result measured;
+
+	/// Worker error, empty if none.
+	string error;
+
+	/**
+	 * Starts profiling with the current settings.
+	 */
+	void onRun();
+
+	/**
+	 * Displays the result of the worker.
+	 */
+	void onFinished();
+
+	/**
+	 * Cancels the worker and waits for it.
+	 */
+	void stop();
+};
+
+} /* namespace */
+
+#endif /* UI_DIALOGPROCESSPROFILER_HPP_ */
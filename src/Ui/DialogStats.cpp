@@ -0,0 +1,73 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogStats.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DialogStats.hpp"
+
+using namespace LEDSpicerUI::Ui;
+
+DialogStats::DialogStats(Gtk::Window* parent) :
+	store(Gtk::ListStore::create(columns))
+{
+	set_title("Statistics");
+	set_transient_for(*parent);
+	set_position(Gtk::WindowPosition::WIN_POS_CENTER_ON_PARENT);
+	set_default_size(450, 400);
+	set_modal(false);
+
+	view.set_model(store);
+	view.append_column("Counter", columns.name);
+	view.append_column("Value",   columns.value);
+	for (auto column : view.get_columns())
+		column->set_resizable(true);
+
+	auto scroll = Gtk::make_managed<Gtk::ScrolledWindow>();
+	scroll->add(view);
+	add(*scroll);
+	scroll->show_all();
+
+	signal_hide().connect([&]() {
+		timer.disconnect();
+	});
+}
+
+void DialogStats::display() {
+	refresh();
+	if (not timer.connected())
+		timer = Glib::signal_timeout().connect(sigc::mem_fun(*this, &DialogStats::refresh), REFRESH_MS);
+	present();
+}
+
+bool DialogStats::refresh() {
+	// Rows are updated in place so the selection and scroll survive.
+	auto report(Stats::createReport());
+	auto rows(store->children());
+	size_t c = 0;
+	for (auto& line : report) {
+		auto row = c < rows.size() ? *rows[c] : *store->append();
+		row[columns.name]  = line.first;
+		row[columns.value] = line.second;
+		++c;
+	}
+	while (rows.size() > c)
+		store->erase(rows[c]);
+	return true;
+}
@@ -0,0 +1,80 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      DialogStats.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Message.hpp"
+#include "Stats.hpp"
+
+#ifndef UI_DIALOGSTATS_HPP_
+#define UI_DIALOGSTATS_HPP_ 1
+
+namespace LEDSpicerUI::Ui {
+
+/**
+ * LEDSpicerUI::Ui::DialogStats
+ * Hidden debug window with the live runtime statistics, opened with Ctrl+Shift+D.
+ */
+class DialogStats: public Gtk::Window {
+
+public:
+
+	/// Refresh period while visible.
+	static constexpr uint REFRESH_MS = 500;
+
+	DialogStats(Gtk::Window* parent);
+
+	virtual ~DialogStats() = default;
+
+	/**
+	 * Shows the window and keeps it updated until closed.
+	 */
+	void display();
+
+protected:
+
+	class Columns : public Gtk::TreeModelColumnRecord {
+	public:
+		Columns() {
+			add(name);
+			add(value);
+		}
+		Gtk::TreeModelColumn<string> name;
+		Gtk::TreeModelColumn<string> value;
+	};
+
+	Columns columns;
+
+	Glib::RefPtr<Gtk::ListStore> store;
+
+	Gtk::TreeView view;
+
+	sigc::connection timer;
+
+	/**
+	 * Reads the counters again.
+	 * @return true to keep the timer.
+	 */
+	bool refresh();
+};
+
+} /* namespace */
+
+#endif /* UI_DIALOGSTATS_HPP_ */
@@ -34,7 +34,14 @@ MainDialogs::MainDialogs(Glib::RefPtr<Gtk::Builder> const &builder, Gtk::Applica
 		Gtk::FileChooserAction::FILE_CHOOSER_ACTION_SELECT_FOLDER,
 		Gtk::DialogFlags::DIALOG_MODAL | Gtk::DialogFlags::DIALOG_DESTROY_WITH_PARENT | Gtk::DialogFlags::DIALOG_USE_HEADER_BAR
 	),
-	inputs(FILENAME)
+	dialogIssues(window),
+	dialogStats(window),
+	dialogBandwidth(window, devices),
+	dialogProcessProfiler(window),
+	dialogPlaceElements(window, devices, dialogIssues),
+	inputs(FILENAME),
+	profileResolver(devices, groups, profiles),
+	dialogPreview(window, devices, groups, profiles, animations, inputs, profileResolver)
 {
 
 	DialogColors::initialize(builder);
@@ -52,6 +59,7 @@ MainDialogs::MainDialogs(Glib::RefPtr<Gtk::Builder> const &builder, Gtk::Applica
 	DataDialogs::DialogGroup::initialize(builder);
 	DataDialogs::DialogInput::initialize(builder);
 	DataDialogs::DialogProfile::initialize(builder);
+	DataDialogs::DialogAnimation::initialize(builder);
 
 	// Connect primary dialogs with the collections.
 	DataDialogs::DialogDevice::getInstance()->setOwner(&devices);
@@ -60,6 +68,7 @@ MainDialogs::MainDialogs(Glib::RefPtr<Gtk::Builder> const &builder, Gtk::Applica
 	DataDialogs::DialogGroup::getInstance()->setOwner(&groups);
 	DataDialogs::DialogInput::getInstance()->setOwner(&inputs);
 	DataDialogs::DialogProfile::getInstance()->setOwner(&profiles);
+	DataDialogs::DialogAnimation::getInstance()->setOwner(&animations);
 
 	// Create select work directory FileChooserDialog
 	dialogSelectWorkingDirectory.set_transient_for(*window);
@@ -76,6 +85,7 @@ MainDialogs::~MainDialogs() {
 	// data dialogs.
 	delete DataDialogs::DialogSelect::getInstance();
 	delete DataDialogs::DialogProfile::getInstance();
+	delete DataDialogs::DialogAnimation::getInstance();
 	delete DataDialogs::DialogElement::getInstance();
 	delete DataDialogs::DialogRestrictorMap::getInstance();
 	delete DataDialogs::DialogRestrictor::getInstance();
@@ -91,6 +101,7 @@ MainDialogs::~MainDialogs() {
 
 	// the order is important.
 	profiles.wipe();
+	animations.wipe();
 	processes.wipe();
 	inputs.wipe();
 	groups.wipe();
@@ -21,12 +21,20 @@
  */
 
 #include "DialogImport.hpp"
+#include "DialogIssues.hpp"
+#include "DialogStats.hpp"
+#include "DialogBandwidth.hpp"
+#include "DialogPlaceElements.hpp"
+#include "DialogProcessProfiler.hpp"
+#include "ProfileResolver.hpp"
+#include "DialogPreview.hpp"
 #include "DataDialogs/DialogDevice.hpp"
 #include "DataDialogs/DialogRestrictor.hpp"
 #include "DataDialogs/DialogProcess.hpp"
 #include "DataDialogs/DialogGroup.hpp"
 #include "DataDialogs/DialogInput.hpp"
 #include "DataDialogs/DialogProfile.hpp"
+#include "DataDialogs/DialogAnimation.hpp"
 
 #ifndef UI_MAINDIALOGS_HPP_
 #define UI_MAINDIALOGS_HPP_ 1
@@ -63,6 +71,21 @@ protected:
 
 	/// File chooser dialog.
 	Gtk::FileChooserDialog dialogSelectWorkingDirectory;
+
+	/// Problems found while importing.
+	DialogIssues dialogIssues;
+
+	/// Runtime statistics, for debugging.
+	DialogStats dialogStats;
+
+	/// Devices output estimation.
+	DialogBandwidth dialogBandwidth;
+
+	/// Process lookup cost.
+	DialogProcessProfiler dialogProcessProfiler;
+
+	/// Bulk element creation.
+	DialogPlaceElements dialogPlaceElements;
 	/**
 	 * @}
 	 */
@@ -81,7 +104,15 @@ protected:
 		/// Created inputs in the dialog inputs.
 		inputs,
 		/// Created profiles in the dialog profiles.
-		profiles;
+		profiles,
+		/// Created or found animations in the dialog animations.
+		animations;
+
+	/// Effective colors of the profiles, needs the collections.
+	ProfileResolver profileResolver;
+
+	/// Profiles rendering, needs the collections and the resolver.
+	DialogPreview dialogPreview;
 
 };
 
@@ -85,6 +85,7 @@ MainWindow::MainWindow(BaseObjectType* obj, Glib::RefPtr<Gtk::Builder> const &bu
 
 	// Save project
 	btnSaveProject->signal_clicked().connect([&]() {
+		TRACE_SPAN("save");
 		try {
 			// sanity checks.
 			if (inputDefaultProfile->get_active_text().empty()) {
@@ -107,6 +108,10 @@ MainWindow::MainWindow(BaseObjectType* obj, Glib::RefPtr<Gtk::Builder> const &bu
 					throw Message("Unable to save, a file with the name " + d + " already exist.");
 				}
 			}
+			// Full check, problems do not block the save.
+			auto issues(Lint::run(*createLintSnapshot()));
+			if (not issues.empty())
+				dialogIssues.displayLint(issues);
 			// Create config section.
 			string xmlData("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<!-- " DEFAULT_MESSAGE "-->\n<LEDSpicer\n");
 			Defaults::increaseTab();
@@ -160,17 +165,28 @@ MainWindow::MainWindow(BaseObjectType* obj, Glib::RefPtr<Gtk::Builder> const &bu
 			xmlData += "</LEDSpicer>\n";
 
 			// Save config
-			string configFile(workingDirectory + CONFIG_FILE);
-			Glib::file_set_contents(configFile, xmlData);
+			XMLHelper::write(workingDirectory + CONFIG_FILE, xmlData);
+			// The next outside change is compared with what was saved.
+			ConfigFile saved(workingDirectory + CONFIG_FILE);
+			projectWatcher.setBaseline(workingDirectory + CONFIG_FILE, saved);
+
+			// Save animations, the ones never edited are already on disk.
+			for (auto a : animations) {
+				auto animation(dynamic_cast<Storage::Animation*>(a->getData()));
+				if (animation->isModified())
+					animation->save();
+			}
+			// Deleted or renamed.
+			for (const string& name : AnimationCatalogue::getNames())
+				if (not animations.isset(name))
+					AnimationCatalogue::remove(name);
+
 			Defaults::cleanDirty();
 			Message::displayInfo("Project saved successfully.");
 		}
 		catch (Message &e) {
 			e.displayError();
 		}
-		catch (const Glib::FileError& e) {
-			Message::displayError("Unable to the project, failed to write to " CONFIG_FILE " " + string(e.what()));
-		}
 	});
 
 	// About.
@@ -200,6 +216,7 @@ MainWindow::MainWindow(BaseObjectType* obj, Glib::RefPtr<Gtk::Builder> const &bu
 	builder->get_widget_derived("ListBoxDatasource", listBoxDataSource, "BtnDatasourceUp", "BtnDatasourceDown");
 	inputColors->signal_changed().connect([&]() {
 		DialogColors::getInstance()->setColorsFromFile(dataDirectory + inputColors->get_active_id() + ".xml");
+		postLint();
 	});
 
 	/*******************
@@ -207,6 +224,17 @@ MainWindow::MainWindow(BaseObjectType* obj, Glib::RefPtr<Gtk::Builder> const &bu
 	 *******************/
 	builder->get_widget("InputRunEvery", inputRunEvery);
 	Defaults::registerWidget(inputRunEvery);
+	Gtk::Button* btnProfileProcess;
+	builder->get_widget("BtnProfileProcess", btnProfileProcess);
+	btnProfileProcess->signal_clicked().connect([&]() {
+		vector<string> names;
+		for (auto p : processes)
+			names.push_back(p->getData()->getValue(PARAM_PROCESS_NAME));
+		string runEvery(inputRunEvery->get_text());
+		uint suggested = dialogProcessProfiler.profile(names, Defaults::isNumber(runEvery) ? std::stoi(runEvery) : 0);
+		if (suggested)
+			inputRunEvery->set_text(std::to_string(suggested));
+	});
 
 	/*******************
 	 * Default Profile *
@@ -214,6 +242,19 @@ MainWindow::MainWindow(BaseObjectType* obj, Glib::RefPtr<Gtk::Builder> const &bu
 	builder->get_widget("InputDefaultProfile", inputDefaultProfile);
 	Defaults::registerWidget(inputDefaultProfile);
 
+	// Project files written outside the editor.
+	projectWatcher.signalChanged().connect(sigc::mem_fun(*this, &MainWindow::reload));
+
+	// Hidden statistics window.
+	signal_key_press_event().connect([&](GdkEventKey* event) {
+		const auto modifiers = GDK_CONTROL_MASK | GDK_SHIFT_MASK;
+		if ((event->state & modifiers) == modifiers and gdk_keyval_to_lower(event->keyval) == GDK_KEY_d) {
+			dialogStats.display();
+			return true;
+		}
+		return false;
+	}, false);
+
 	// Check for unsaved project.
 	signal_delete_event().connect([](GdkEventAny* event) {
 		if (Defaults::isDirty())
@@ -224,10 +265,18 @@ MainWindow::MainWindow(BaseObjectType* obj, Glib::RefPtr<Gtk::Builder> const &bu
 }
 
 MainWindow::~MainWindow() {
+	coverageCancel = true;
+	if (coverageWorker.joinable())
+		coverageWorker.join();
 	delete listBoxDataSource;
 }
 
 void MainWindow::openDataDirectory(const string& dataDirectory) {
+	// The coverage report reads the games data, it stops after the chunks in progress.
+	if (coverageWorker.joinable()) {
+		coverageCancel = true;
+		coverageWorker.join();
+	}
 	// Set color list.
 	inputColors->remove_all();
 	inputColors->append("", "Select Colors");
@@ -249,13 +298,9 @@ void MainWindow::openDataDirectory(const string& dataDirectory) {
 			continue;
 
 		string filename(fileInfo->get_name());
-		for (auto& f : {"gameData.xml", "colors.ini", "controls.ini"}) {
-			string f2(f);
-			if (filename == f2) {
-				msg += "✅ Games data file " + f2 + " Found\n";
-				continue;
-			}
-		}
+		// Too big to be loaded as a colors file.
+		if (filename == GAME_DATA_FILE)
+			continue;
 		auto parts = Defaults::explode(filename, '.');
 		string ext(parts.back());
 		if (ext == "xml") {
@@ -270,10 +315,12 @@ void MainWindow::openDataDirectory(const string& dataDirectory) {
 		}
 	}
 
+	// Index the games data files, big files are only scanned when they change.
+	msg += GameData::open(dataDirectory);
 	if (msg.empty())
 		throw Message("The directory does not contain any useful file");
 	// Warning game data files not found.
-	for (auto& f : {"gameData.xml", "colors.ini", "controls.ini"}) {
+	for (auto& f : {GAME_DATA_FILE, COLORS_FILE, CONTROLS_FILE}) {
 		if (msg.find(f) == string::npos) {
 			msg += "❌ Games data file " + string(f) + " Not Found\n";
 		}
@@ -289,21 +336,109 @@ void MainWindow::prepareDialogs(Glib::RefPtr<Gtk::Builder> const &builder) {
 	builder->get_widget("BoxRandomColors",   boxRandomColors);
 	DialogColors::getInstance()->activateColorPicker(btnAddRandomColor, boxRandomColors);
 
+	// Devices output estimation, follows the FPS setting.
+	Gtk::Button* btnDeviceBandwidth;
+	builder->get_widget("BtnDeviceBandwidth", btnDeviceBandwidth);
+	btnDeviceBandwidth->signal_clicked().connect([&]() {
+		dialogBandwidth.setFps(inputFPS->get_value_as_int());
+		dialogBandwidth.display();
+	});
+	inputFPS->signal_value_changed().connect([&]() {
+		dialogBandwidth.setFps(inputFPS->get_value_as_int());
+		dialogPreview.setFps(inputFPS->get_value_as_int());
+	});
+
+	// Profiles rendering.
+	Gtk::Button* btnPreview;
+	builder->get_widget("BtnPreview", btnPreview);
+	btnPreview->signal_clicked().connect([&]() {
+		dialogPreview.setFps(inputFPS->get_value_as_int());
+		dialogPreview.display();
+	});
+
+	// Games coverage report.
+	builder->get_widget("BtnCoverageReport", btnCoverageReport);
+	btnCoverageReport->signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::writeCoverageReport));
+	coverageDispatcher.connect([&]() {
+		// Already joined if the data directory changed meanwhile.
+		if (coverageWorker.joinable())
+			coverageWorker.join();
+		btnCoverageReport->set_sensitive(true);
+		if (not coverageError.empty())
+			Message::displayError(coverageError);
+		else
+			Message::displayInfo(std::to_string(coverageGames) + " games written into " + coverageFile);
+	});
+
+	// Background project check, the worker only wakes the dispatcher.
+	builder->get_widget("BtnLint", btnLint);
+	btnLint->signal_clicked().connect([&]() {
+		dialogIssues.displayLint(lint.getIssues());
+	});
+	lint.setNotify([&]() {
+		lintDispatcher.emit();
+	});
+	lintDispatcher.connect([&]() {
+		auto issues(lint.getIssues());
+		btnLint->set_label(std::to_string(issues.size()));
+		btnLint->set_tooltip_text(issues.empty() ? "No problems found" : std::to_string(issues.size()) + " problems found");
+		dialogIssues.updateLint(issues);
+	});
+	DataDialogs::DialogForm::signalDataChanged().connect([&](const Storage::Data* data, const string& previousId) {
+		postLint({previousId, data->createUniqueId(), data->getValue(NAME), data->getValue(FILENAME)});
+	});
+	DataDialogs::DialogForm::signalBulkChanged().connect([&](const vector<const Storage::Data*>& changed) {
+		vector<string> names;
+		for (auto data : changed) {
+			names.push_back(data->createUniqueId());
+			names.push_back(data->getValue(NAME));
+		}
+		postLint(names);
+	});
+
+	// Single file projects.
+	Gtk::Button
+		* btnExportBundle,
+		* btnImportBundle;
+	builder->get_widget("BtnExportBundle", btnExportBundle);
+	builder->get_widget("BtnImportBundle", btnImportBundle);
+	btnExportBundle->signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::exportBundle));
+	btnImportBundle->signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::importBundle));
+
+	// Layouts and colors from other programs.
+	Gtk::Button* btnImportForeign;
+	builder->get_widget("BtnImportForeign", btnImportForeign);
+	btnImportForeign->signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::importForeign));
+
+	// Bulk elements.
+	Gtk::Button* btnPlaceElements;
+	builder->get_widget("BtnPlaceElements", btnPlaceElements);
+	btnPlaceElements->signal_clicked().connect([&]() {
+		if (not devices.getSize()) {
+			Message::displayError("Create the devices that will receive the elements first");
+			return;
+		}
+		dialogPlaceElements.display();
+	});
+
 	// Dialog to import config files.
 	Gtk::Button* btnImportConfig;
 	builder->get_widget("BtnImportConfig", btnImportConfig);
 	btnImportConfig->signal_clicked().connect([&]() {
 		if (dialogImportConfig.run() == Gtk::ResponseType::RESPONSE_OK) {
 			string newPath = dialogImportConfig.get_file()->get_path();
+			Diagnostics::clear();
 			try {
 				import(newPath, false, dialogImportConfig.getConfigParameters());
 			}
 			catch (Message& e) {
-				Message::displayError(XMLHelper::cleanError(e.getMessage()));
+				Diagnostics::setSource(newPath);
+				Diagnostics::error(XMLHelper::cleanError(e.getMessage()));
 			}
 			Defaults::markDirty();
 		}
 		dialogImportConfig.hide();
+		dialogIssues.display();
 	});
 
 	// Dialog to import input plugin files.
@@ -313,30 +448,70 @@ void MainWindow::prepareDialogs(Glib::RefPtr<Gtk::Builder> const &builder) {
 		if (dialogImportInput.run() == Gtk::ResponseType::RESPONSE_OK) {
 			// Retrieve the selected files or directories
 			vector<string> selectedFiles(dialogImportInput.get_filenames());
+			Diagnostics::clear();
 			// Process each selected file or directory
 			for (const auto& selectedFile : selectedFiles) {
 				try {
 					import(selectedFile, false, IMPORT_INPUTS);
 				}
 				catch (Message& e) {
-					Message::displayError(XMLHelper::cleanError(e.getMessage()));
+					// Keep going, a broken file should not stop the others.
+					Diagnostics::setSource(selectedFile);
+					Diagnostics::error(XMLHelper::cleanError(e.getMessage()));
 				}
 			}
 		}
 		dialogImportInput.hide();
+		dialogIssues.display();
+	});
+
+	// Animation files from other projects.
+	Gtk::Button* btnImportAnimation;
+	builder->get_widget("BtnImportAnimation", btnImportAnimation);
+	btnImportAnimation->signal_clicked().connect([&]() {
+		Gtk::FileChooserDialog dialog(*this, "Import Animations", Gtk::FileChooserAction::FILE_CHOOSER_ACTION_OPEN);
+		dialog.add_button("_Cancel", Gtk::RESPONSE_CANCEL)->get_style_context()->add_class("backgroundRed");
+		dialog.add_button("_Import", Gtk::RESPONSE_OK)->get_style_context()->add_class("backgroundGreen");
+		dialog.set_select_multiple(true);
+		auto filter(Gtk::FileFilter::create());
+		filter->set_name("Animation files");
+		filter->add_pattern("*" ANIMATIONS_EXTENSION);
+		dialog.add_filter(filter);
+		if (dialog.run() != Gtk::RESPONSE_OK)
+			return;
+		dialog.hide();
+		Diagnostics::clear();
+		for (const auto& selectedFile : dialog.get_filenames()) {
+			try {
+				DataDialogs::DialogAnimation::getInstance()->import(selectedFile);
+				Defaults::markDirty();
+			}
+			catch (Message& e) {
+				Diagnostics::setSource(selectedFile);
+				Diagnostics::error(XMLHelper::cleanError(e.getMessage()));
+			}
+		}
+		dialogIssues.display();
 	});
 
 	Gtk::Button
 		* btnOpenProject,
-		* btnAddInput;
-	builder->get_widget("BtnSelectDir", btnOpenProject);
-	builder->get_widget("BtnAddInput",  btnAddInput);
+		* btnAddInput,
+		* btnAddAnimation;
+	builder->get_widget("BtnSelectDir",    btnOpenProject);
+	builder->get_widget("BtnAddInput",     btnAddInput);
+	builder->get_widget("BtnAddAnimation", btnAddAnimation);
 
 	// Activate configuration tabs.
-	Gtk::Notebook* MainTabs = nullptr;
-	builder->get_widget("MainTabs", MainTabs);
+	builder->get_widget("MainTabs", mainTabs);
 
-	MainTabs->signal_switch_page().connect([=](Gtk::Widget* page, guint pageNum) {
+	mainTabs->signal_switch_page().connect([=](Gtk::Widget* page, guint pageNum) {
+		// Animations, actors need groups.
+		if (pageNum == 3) {
+			bool sensitive(Storage::CollectionHandler::getInstance(COLLECTION_GROUP)->getSize());
+			btnImportAnimation->set_sensitive(sensitive);
+			btnAddAnimation->set_sensitive(sensitive);
+		}
 		// Inputs
 		if (pageNum == 4) {
 			bool sensitive(
@@ -347,7 +522,7 @@ void MainWindow::prepareDialogs(Glib::RefPtr<Gtk::Builder> const &builder) {
 		}
 	});
 
-	btnOpenProject->signal_clicked().connect([&, MainTabs]() {
+	btnOpenProject->signal_clicked().connect([&]() {
 		if (dialogSelectWorkingDirectory.run() != Gtk::ResponseType::RESPONSE_OK) {
 			dialogSelectWorkingDirectory.hide();
 			return;
@@ -363,44 +538,60 @@ void MainWindow::prepareDialogs(Glib::RefPtr<Gtk::Builder> const &builder) {
 			dialogSelectWorkingDirectory.hide();
 			return;
 		}
-		// Set working directory.
-		workingDirectory = newPath;
-		Defaults::setSubtitle(workingDirectory);
-
-		// wipe random colors and any other color
-		setColorFile("");
-		bool exists = Glib::file_test(workingDirectory + CONFIG_FILE, Glib::FileTest::FILE_TEST_EXISTS);
-		// Old data.
-		try {
-			import(workingDirectory + CONFIG_FILE, true, IMPORT_ALL);
-		}
-		// New data.
-		catch (Message& e) {
-			if (exists)
-				Message::displayError(XMLHelper::cleanError("The config file raised an error:\n" + e.getMessage()));
-			// Wipe all data.
-			profiles.wipe();
-			devices.wipe();
-			restrictors.wipe();
-			processes.wipe();
-			groups.wipe();
-			inputs.wipe();
-			// This is necessary because the refresh is done at dialog open.
-			DataDialogs::DialogProfile::getInstance()->refreshBox();
-			DataDialogs::DialogDevice::getInstance()->refreshBox();
-			DataDialogs::DialogRestrictor::getInstance()->refreshBox();
-			DataDialogs::DialogProcess::getInstance()->refreshBox();
-			DataDialogs::DialogGroup::getInstance()->refreshBox();
-			DataDialogs::DialogInput::getInstance()->refreshBox();
-			unordered_map<string, string> values;
-			setConfiguration(values);
-		}
-		Defaults::cleanDirty();
-		MainTabs->set_sensitive(true);
 		dialogSelectWorkingDirectory.hide();
+		openProject(newPath);
 	});
 }
 
+void MainWindow::openProject(const string& directory) {
+	// Set working directory.
+	workingDirectory = directory;
+	Defaults::setSubtitle(workingDirectory);
+
+	// wipe random colors and any other color
+	setColorFile("");
+	bool exists = Glib::file_test(workingDirectory + CONFIG_FILE, Glib::FileTest::FILE_TEST_EXISTS);
+	Diagnostics::clear();
+	// Before the import, that remembers the loaded version.
+	projectWatcher.start(workingDirectory);
+	// Old data.
+	try {
+		import(workingDirectory + CONFIG_FILE, true, IMPORT_ALL);
+	}
+	// New data.
+	catch (Message& e) {
+		if (exists) {
+			Diagnostics::setSource(workingDirectory + CONFIG_FILE);
+			Diagnostics::error(XMLHelper::cleanError("The config file raised an error: " + e.getMessage()));
+		}
+		// Wipe all data.
+		profileResolver.clear();
+		profiles.wipe();
+		devices.wipe();
+		restrictors.wipe();
+		processes.wipe();
+		groups.wipe();
+		inputs.wipe();
+		// This is necessary because the refresh is done at dialog open.
+		DataDialogs::DialogProfile::getInstance()->refreshBox();
+		DataDialogs::DialogDevice::getInstance()->refreshBox();
+		DataDialogs::DialogRestrictor::getInstance()->refreshBox();
+		DataDialogs::DialogProcess::getInstance()->refreshBox();
+		DataDialogs::DialogGroup::getInstance()->refreshBox();
+		DataDialogs::DialogInput::getInstance()->refreshBox();
+		unordered_map<string, string> values;
+		setConfiguration(values);
+	}
+	// Only indexed, the files are read when edited.
+	animations.wipe();
+	AnimationCatalogue::open(workingDirectory);
+	DataDialogs::DialogAnimation::getInstance()->load(nullptr);
+	Defaults::cleanDirty();
+	mainTabs->set_sensitive(true);
+	dialogIssues.display();
+	postLint();
+}
+
 void MainWindow::setConfiguration(unordered_map<string, string>& values) {
 	// ledspicerd
 	inputUserId->set_text(XMLHelper::valueOf(values,        "userId",   DEFAULT_USERID));
@@ -427,7 +618,6 @@ string MainWindow::readConfiguration() {
 		{"version", "1.0"},
 		{"type",    "Configuration"},
 		{"userId",  inputUserId->get_text()},
-		{"userId",  inputUserId->get_text()},
 		{"groupId", inputGroupId->get_text()},
 		{"port",    inputPortNumber->get_text()},
 		{"fps",     inputFPS->get_text()},
@@ -444,10 +634,13 @@ string MainWindow::readConfiguration() {
 		r.emplace("craftProfile", "true");
 	}
 
-	return XMLHelper::toXML(r);
+	return XMLHelper::toXML(Defaults::configurationAttributes, r);
 }
 
 void MainWindow::import(const string& dataFilePath, bool wipe, uint8_t importFlags) {
+	TRACE_SPAN("import");
+	// Loaded data does not go through the forms.
+	profileResolver.clear();
 	if (importFlags & IMPORT_INPUTS) {
 		InputFile datafile(dataFilePath);
 		if (wipe) {
@@ -455,10 +648,14 @@ void MainWindow::import(const string& dataFilePath, bool wipe, uint8_t importFla
 			DataDialogs::DialogInput::getInstance()->refreshBox();
 		}
 		DataDialogs::DialogInput::getInstance()->load(&datafile);
+		if (projectWatcher.isInput(dataFilePath))
+			projectWatcher.setBaseline(dataFilePath, datafile);
 		return;
 	}
 
 	ConfigFile datafile(dataFilePath);
+	if (importFlags == IMPORT_ALL and projectWatcher.isConfig(dataFilePath))
+		projectWatcher.setBaseline(dataFilePath, datafile);
 	if (importFlags & IMPORT_CONFIG) {
 		auto c(datafile.getSettings());
 		// check if color are different.
@@ -510,6 +707,358 @@ void MainWindow::import(const string& dataFilePath, bool wipe, uint8_t importFla
 	}*/
 }
 
+void MainWindow::reload(const string& fileName) {
+	TRACE_SPAN("reload");
+	const bool config(projectWatcher.isConfig(fileName));
+	// Only the problems of this file are replaced.
+	Diagnostics::clear(fileName);
+	std::unique_ptr<XMLHelper> datafile;
+	try {
+		if (config)
+			datafile.reset(new ConfigFile(fileName));
+		else
+			datafile.reset(new InputFile(fileName));
+	}
+	catch (Message& e) {
+		// Half written files are common while an editor saves, only recorded, the next write brings it back.
+		Diagnostics::setSource(fileName);
+		Diagnostics::error(XMLHelper::cleanError(e.getMessage()));
+		return;
+	}
+	// The remembered version only moves once the model has the changes.
+	auto changes(projectWatcher.compare(fileName, *datafile));
+	if (changes.empty())
+		return;
+	// Only inputs already in the project follow their files.
+	if (not config) {
+		auto& rawInputs(datafile->getData(COLLECTION_INPUT));
+		if (rawInputs.empty() or not inputs.isset(XMLHelper::valueOf(rawInputs.front(), FILENAME, "")))
+			return;
+	}
+	const bool dirty(Defaults::isDirty());
+	if (dirty and Message::ask(Glib::path_get_basename(fileName) + " changed outside the editor, load the changes?\nUnsaved changes in the changed records will be lost.") != Gtk::RESPONSE_YES)
+		return;
+
+	profileResolver.clear();
+	// Replaced elements and groups keep their input maps.
+	Storage::CollectionHandler::deferRemovals();
+	// Users first, groups and inputs use the elements.
+	const vector<std::pair<string, DataDialogs::DialogForm*>> dialogs {
+		{COLLECTION_INPUT,       DataDialogs::DialogInput::getInstance()},
+		{COLLECTION_PROCESS,     DataDialogs::DialogProcess::getInstance()},
+		{COLLECTION_RESTRICTORS, DataDialogs::DialogRestrictor::getInstance()},
+		{COLLECTION_GROUP,       DataDialogs::DialogGroup::getInstance()},
+		{COLLECTION_DEVICES,     DataDialogs::DialogDevice::getInstance()},
+	};
+	for (auto& dialog : dialogs)
+		if (changes.remove.count(dialog.first) or changes.load.count(dialog.first)) {
+			auto ids(changes.remove[dialog.first]);
+			// New records may already exist, added in the editor and saved.
+			ids.insert(changes.load[dialog.first].begin(), changes.load[dialog.first].end());
+			dialog.second->unload(ids);
+		}
+	for (auto dialog = dialogs.rbegin(); dialog != dialogs.rend(); ++dialog) {
+		if (not changes.load.count(dialog->first))
+			continue;
+		// Only the changed records are created, the rest of the file is left alone.
+		const auto& ids(changes.load.at(dialog->first));
+		auto& raw(datafile->getData(dialog->first));
+		raw.erase(std::remove_if(raw.begin(), raw.end(), [&](const unordered_map<string, string>& record) {
+			return not ids.count(ProjectWatcher::createUniqueId(dialog->first, record));
+		}), raw.end());
+		dialog->second->load(datafile.get());
+	}
+	Storage::CollectionHandler::flushRemovals();
+
+	if (changes.settings) {
+		auto file(dynamic_cast<ConfigFile*>(datafile.get()));
+		auto c(file->getSettings());
+		setConfiguration(c);
+		inputRunEvery->set_text(file->getProcessLookupRunEvery());
+		Defaults::populateComboBoxText(inputDefaultProfile, {file->getDefaultProfile()});
+		inputDefaultProfile->set_active_text(file->getDefaultProfile());
+	}
+	projectWatcher.accept(fileName, changes);
+	if (not dirty)
+		Defaults::cleanDirty();
+	postLint();
+}
+
+Coverage::Layout MainWindow::createCoverageLayout() const {
+	Coverage::Layout layout;
+	for (auto d : devices)
+		for (auto e : dynamic_cast<const Storage::Device*>(d->getData())->getElements())
+			layout.elements.insert(e->getData()->getValue(NAME));
+
+	for (auto g : groups) {
+		auto& elements = layout.groups[g->getData()->getValue(NAME)];
+		for (auto e : dynamic_cast<const Storage::Group*>(g->getData())->getElements())
+			elements.push_back(e->getData()->getValue(NAME));
+	}
+
+	for (auto r : restrictors) {
+		auto restrictor = dynamic_cast<const Storage::Restrictor*>(r->getData());
+		for (auto m : restrictor->getPlayerMapping())
+			layout.restrictors[m->getData()->getValue(PLAYER)].push_back(restrictor->getType());
+	}
+
+	for (auto i : inputs)
+		for (auto m : dynamic_cast<const Storage::Input*>(i->getData())->getMaps())
+			layout.addTrigger(m->getData()->getValue(TYPE), m->getData()->getValue(TARGET), m->getData()->getValue(TRIGGER));
+	return layout;
+}
+
+std::shared_ptr<const Lint::Snapshot> MainWindow::createLintSnapshot() const {
+	auto snapshot(std::make_shared<Lint::Snapshot>());
+	for (auto d : devices) {
+		auto device = dynamic_cast<const Storage::Device*>(d->getData());
+		Lint::Snapshot::Device sd{device->createUniqueId(), device->getPins(), {}};
+		for (auto e : device->getElements()) {
+			auto element(e->getData());
+			Lint::Snapshot::Element se{element->getValue(NAME), element->getValue(DEFAULT_COLOR), {}};
+			for (auto pin : {PIN, SOLENOID, RED_PIN, GREEN_PIN, BLUE_PIN})
+				if (Defaults::isNumber(element->getValue(pin)))
+					se.pins.push_back(std::stoi(element->getValue(pin)));
+			sd.elements.push_back(std::move(se));
+		}
+		snapshot->devices.push_back(std::move(sd));
+	}
+
+	for (auto g : groups) {
+		Lint::Snapshot::Group sg{g->getData()->getValue(NAME), g->getData()->getValue(DEFAULT_COLOR), {}};
+		for (auto e : dynamic_cast<const Storage::Group*>(g->getData())->getElements())
+			sg.elements.push_back(e->getData()->getValue(NAME));
+		snapshot->groups.push_back(std::move(sg));
+	}
+
+	for (auto i : inputs) {
+		Lint::Snapshot::Input si{i->getData()->getValue(FILENAME), {}};
+		for (auto m : dynamic_cast<const Storage::Input*>(i->getData())->getMaps()) {
+			auto map(m->getData());
+			si.maps.push_back({map->getValue(TRIGGER), map->getValue(TYPE), map->getValue(TARGET), map->getValue(COLOR)});
+		}
+		snapshot->inputs.push_back(std::move(si));
+	}
+
+	for (auto r : restrictors) {
+		Lint::Snapshot::Restrictor sr{r->getData()->createUniqueId(), {}};
+		for (auto m : dynamic_cast<const Storage::Restrictor*>(r->getData())->getPlayerMapping())
+			sr.maps.emplace_back(m->getData()->getValue(PLAYER), m->getData()->getValue(JOYSTICK));
+		snapshot->restrictors.push_back(std::move(sr));
+	}
+
+	for (auto p : profiles) {
+		auto profile = dynamic_cast<const Storage::Profile*>(p->getData());
+		Lint::Snapshot::Profile sp;
+		sp.name       = profile->getValue(FILENAME);
+		sp.background = profile->getValue(BACKGROUND_COLOR);
+		for (auto b : profile->getAlwaysOnElements()) {
+			sp.elements.push_back(b->getData()->getValue(NAME));
+			sp.colors.push_back(b->getData()->getValue(COLOR));
+		}
+		for (auto b : profile->getAlwaysOnGroups()) {
+			sp.groups.push_back(b->getData()->getValue(NAME));
+			sp.colors.push_back(b->getData()->getValue(COLOR));
+		}
+		for (auto b : profile->getAnimations())
+			sp.animations.push_back(b->getData()->getValue(NAME));
+		for (auto b : profile->getInputs())
+			sp.inputs.push_back(b->getData()->getValue(NAME));
+		snapshot->profiles.push_back(std::move(sp));
+	}
+
+	for (auto a : animations)
+		snapshot->animations.insert(a->getData()->createUniqueId());
+	for (const auto& color : DialogColors::getInstance()->getHexColors())
+		snapshot->palette.insert(color.first);
+	return snapshot;
+}
+
+void MainWindow::postLint(const vector<string>& names) {
+	if (names.empty() or std::any_of(names.begin(), names.end(), [](const string& n) { return not n.empty(); }))
+		lint.post(createLintSnapshot(), names);
+}
+
+void MainWindow::writeCoverageReport() {
+	if (not GameData::isOpen()) {
+		Message::displayError("Select a data directory with games data files first");
+		return;
+	}
+
+	Gtk::FileChooserDialog dialog(*this, "Save Coverage Report", Gtk::FileChooserAction::FILE_CHOOSER_ACTION_SAVE);
+	dialog.add_button("_Cancel", Gtk::RESPONSE_CANCEL)->get_style_context()->add_class("backgroundRed");
+	dialog.add_button("_Save",   Gtk::RESPONSE_OK)->get_style_context()->add_class("backgroundGreen");
+	dialog.set_do_overwrite_confirmation(true);
+	dialog.set_current_name("coverage.csv");
+	if (dialog.run() != Gtk::RESPONSE_OK)
+		return;
+	const string fileName(dialog.get_filename());
+	dialog.hide();
+
+	std::ofstream file(fileName);
+	if (not file) {
+		Message::displayError("Unable to write " + fileName);
+		return;
+	}
+	// Thousands of games, the workers are joined away from the UI thread.
+	btnCoverageReport->set_sensitive(false);
+	coverageFile   = fileName;
+	coverageCancel = false;
+	coverageWorker = std::thread([&, layout = createCoverageLayout(), file = std::move(file)]() mutable {
+		coverageError.clear();
+		try {
+			Coverage coverage(std::move(layout));
+			coverageGames = coverage.run(file, 0, &coverageCancel);
+			if (coverageCancel)
+				coverageError = "The coverage report was stopped after " + std::to_string(coverageGames) + " games, " + coverageFile + " is incomplete";
+		}
+		catch (Message& e) {
+			coverageError = e.getMessage();
+		}
+		catch (std::exception& e) {
+			coverageError = "Unable to write the coverage report, " + string(e.what());
+		}
+		file.close();
+		coverageDispatcher.emit();
+	});
+}
+
+void MainWindow::exportBundle() {
+	if (workingDirectory.empty()) {
+		Message::displayError("Open a project first");
+		return;
+	}
+	if (Defaults::isDirty()) {
+		Message::displayError("Save the project before exporting it");
+		return;
+	}
+
+	Gtk::FileChooserDialog dialog(*this, "Export Project Bundle", Gtk::FileChooserAction::FILE_CHOOSER_ACTION_SAVE);
+	dialog.add_button("_Cancel", Gtk::RESPONSE_CANCEL)->get_style_context()->add_class("backgroundRed");
+	dialog.add_button("_Export", Gtk::RESPONSE_OK)->get_style_context()->add_class("backgroundGreen");
+	dialog.set_do_overwrite_confirmation(true);
+	dialog.set_current_name(Glib::path_get_basename(workingDirectory) + BUNDLE_EXTENSION);
+	if (dialog.run() != Gtk::RESPONSE_OK)
+		return;
+	const string fileName(dialog.get_filename());
+	dialog.hide();
+
+	try {
+		auto result(Bundle::create(fileName, workingDirectory));
+		Message::displayInfo(
+			std::to_string(result.written + result.skipped) + " files exported into " + fileName +
+			(result.skipped ? ", " + std::to_string(result.skipped) + " unchanged" : "")
+		);
+	}
+	catch (Message& e) {
+		e.displayError();
+	}
+}
+
+void MainWindow::importBundle() {
+	Gtk::FileChooserDialog dialog(*this, "Import Project Bundle", Gtk::FileChooserAction::FILE_CHOOSER_ACTION_OPEN);
+	dialog.add_button("_Cancel", Gtk::RESPONSE_CANCEL)->get_style_context()->add_class("backgroundRed");
+	dialog.add_button("_Next",   Gtk::RESPONSE_OK)->get_style_context()->add_class("backgroundGreen");
+	auto filter(Gtk::FileFilter::create());
+	filter->set_name("Project bundles");
+	filter->add_pattern("*" BUNDLE_EXTENSION);
+	dialog.add_filter(filter);
+	if (dialog.run() != Gtk::RESPONSE_OK)
+		return;
+	const string fileName(dialog.get_filename());
+	dialog.hide();
+
+	Gtk::FileChooserDialog directoryDialog(*this, "Extract Into", Gtk::FileChooserAction::FILE_CHOOSER_ACTION_SELECT_FOLDER);
+	directoryDialog.add_button("_Cancel",  Gtk::RESPONSE_CANCEL)->get_style_context()->add_class("backgroundRed");
+	directoryDialog.add_button("_Extract", Gtk::RESPONSE_OK)->get_style_context()->add_class("backgroundGreen");
+	if (not workingDirectory.empty())
+		directoryDialog.set_current_folder(workingDirectory);
+	if (directoryDialog.run() != Gtk::RESPONSE_OK)
+		return;
+	const string directory(directoryDialog.get_filename());
+	directoryDialog.hide();
+
+	if (Defaults::isDirty() and Message::ask("All unsaved changes will be loss, are you sure?") != Gtk::RESPONSE_YES)
+		return;
+
+	try {
+		Bundle bundle(fileName);
+		auto result(bundle.extract(directory));
+		Message::displayInfo(
+			std::to_string(result.written) + " files extracted into " + directory +
+			(result.skipped ? ", " + std::to_string(result.skipped) + " unchanged" : "")
+		);
+	}
+	catch (Message& e) {
+		e.displayError();
+		return;
+	}
+	openProject(directory);
+}
+
+void MainWindow::importForeign() {
+	Gtk::FileChooserDialog dialog(*this, "Import From Other Programs", Gtk::FileChooserAction::FILE_CHOOSER_ACTION_OPEN);
+	dialog.add_button("_Cancel", Gtk::RESPONSE_CANCEL)->get_style_context()->add_class("backgroundRed");
+	dialog.add_button("_Import", Gtk::RESPONSE_OK)->get_style_context()->add_class("backgroundGreen");
+	dialog.set_select_multiple(true);
+	auto filter(Gtk::FileFilter::create());
+	filter->set_name("Layouts and colors");
+	for (auto pattern : {"*.xml", "*.csv", "*.txt", "*.ini"})
+		filter->add_pattern(pattern);
+	dialog.add_filter(filter);
+
+	// Device that receives the layout elements.
+	auto box = Gtk::make_managed<Gtk::Box>(Gtk::Orientation::ORIENTATION_HORIZONTAL, 2);
+	box->get_style_context()->add_class("formContainer");
+	box->add(*Gtk::make_managed<Gtk::Label>("Add the elements into"));
+	auto comboDevices = Gtk::make_managed<Gtk::ComboBoxText>();
+	for (auto d : devices)
+		comboDevices->append(d->getData()->createUniqueId(), d->getData()->createPrettyName());
+	comboDevices->set_active(0);
+	box->add(*comboDevices);
+	box->show_all();
+	dialog.set_extra_widget(*box);
+
+	if (dialog.run() != Gtk::RESPONSE_OK)
+		return;
+	const string deviceId(comboDevices->get_active_id());
+	dialog.hide();
+
+	Storage::Device* device = nullptr;
+	for (auto d : devices)
+		if (d->getData()->createUniqueId() == deviceId)
+			device = dynamic_cast<Storage::Device*>(d->getData());
+
+	Diagnostics::clear();
+	profileResolver.clear();
+	auto palette(DialogColors::getInstance()->getHexColors());
+	for (const auto& selectedFile : dialog.get_filenames()) {
+		try {
+			ForeignFile foreign(selectedFile, deviceId, palette);
+			if (ForeignFile::isColorsFile(selectedFile)) {
+				auto& colors(foreign.getColors());
+				for (auto d : devices)
+					for (auto e : dynamic_cast<const Storage::Device*>(d->getData())->getElements()) {
+						auto color(colors.find(e->getData()->getValue(NAME)));
+						if (color != colors.end())
+							e->getData()->setValue(DEFAULT_COLOR, color->second);
+					}
+			}
+			else {
+				if (not device)
+					throw Message("Create the device that will receive the elements first");
+				device->loadElements(&foreign);
+			}
+			Defaults::markDirty();
+		}
+		catch (Message& e) {
+			Diagnostics::setSource(selectedFile);
+			Diagnostics::error(XMLHelper::cleanError(e.getMessage()));
+		}
+	}
+	dialogIssues.display();
+}
+
 void MainWindow::setColorFile(const string& colorFile) {
 
 	if (colorFile.empty()) {
@@ -25,6 +25,12 @@
 
 #include "ConfigFile.hpp"
 #include "InputFile.hpp"
+#include "AnimationCatalogue.hpp"
+#include "Coverage.hpp"
+#include "Lint.hpp"
+#include "ForeignFile.hpp"
+#include "Bundle.hpp"
+#include "ProjectWatcher.hpp"
 #include "OrdenableListBox.hpp"
 #include "MainDialogs.hpp"
 
@@ -74,12 +80,48 @@ protected:
 		* inputLogLevel       = nullptr,
 		* inputDefaultProfile = nullptr;
 
+	/// Project tabs, disabled until a project is open.
+	Gtk::Notebook* mainTabs = nullptr;
+
 	/// The list of data sources for ROM names.
 	OrdenableListBox* listBoxDataSource = nullptr;
 
 	/// Contains the possible pickers for colors when selecting colors randomly.
 	Gtk::FlowBox* boxRandomColors = nullptr;
 
+	/// Shows the number of lint problems, opens the list.
+	Gtk::Button* btnLint = nullptr;
+
+	/// Checks the project in the background.
+	Lint lint;
+
+	/// Brings the lint results into the UI thread.
+	Glib::Dispatcher lintDispatcher;
+
+	/// Writes the coverage report.
+	std::thread coverageWorker;
+
+	/// Brings the end of the coverage report into the UI thread.
+	Glib::Dispatcher coverageDispatcher;
+
+	/// Stops the coverage report between chunks.
+	std::atomic<bool> coverageCancel{false};
+
+	/// Games in the last coverage report.
+	size_t coverageGames = 0;
+
+	/// Why the last coverage report failed, empty if it did not.
+	string coverageError;
+
+	/// The last coverage report file.
+	string coverageFile;
+
+	/// Starts the coverage report, disabled while one runs.
+	Gtk::Button* btnCoverageReport = nullptr;
+
+	/// Reports project files written outside the editor.
+	ProjectWatcher projectWatcher;
+
 	/**
 	 * Process the selected data directory.
 	 * This directory should contain any data file, like colors, controls, etc.
@@ -88,6 +130,12 @@ protected:
 	 */
 	void openDataDirectory(const string& dataDirectory);
 
+	/**
+	 * Loads a project, or starts a new one if the directory has no configuration.
+	 * @param directory
+	 */
+	void openProject(const string& directory);
+
 	/**
 	 * Populates the configuration.
 	 * @param values if empty will use default values.
@@ -114,6 +162,50 @@ protected:
 	 */
 	void import(const string& ledspicerconf, bool wipe, uint8_t importFlags);
 
+	/**
+	 * Applies a project file written outside the editor, only the records that changed are replaced.
+	 * Asks first if there are unsaved changes, problems reading the file go to the diagnostics without a window.
+	 * @param fileName the configuration or an input inside the project.
+	 */
+	void reload(const string& fileName);
+
+	/**
+	 * @return the project layout for the coverage report.
+	 */
+	Coverage::Layout createCoverageLayout() const;
+
+	/**
+	 * @return a copy of the project for the lint.
+	 */
+	std::shared_ptr<const Lint::Snapshot> createLintSnapshot() const;
+
+	/**
+	 * Sends the project to the lint.
+	 * @param names the changed names, empty to check everything.
+	 */
+	void postLint(const vector<string>& names = {});
+
+	/**
+	 * Asks for a file and writes the coverage report into it.
+	 */
+	void writeCoverageReport();
+
+	/**
+	 * Asks for a file and writes the saved project into it as a bundle.
+	 */
+	void exportBundle();
+
+	/**
+	 * Asks for a bundle and a directory, extracts the bundle and opens the project.
+	 */
+	void importBundle();
+
+	/**
+	 * Asks for layout or colors files from other programs and imports them.
+	 * Layouts add elements to a device, colors set the default color of the elements with the same name.
+	 */
+	void importForeign();
+
 	/**
 	 * Sets the color file.
 	 * @param colorFile
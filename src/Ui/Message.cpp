@@ -22,6 +22,8 @@
 
 #include "Message.hpp"
 
+#include <iostream>
+
 using namespace LEDSpicerUI::Ui;
 
 Gtk::MessageDialog* Message::errorDialog    = nullptr;
@@ -29,10 +31,6 @@ Gtk::MessageDialog* Message::infoDialog     = nullptr;
 Gtk::MessageDialog* Message::questionDialog = nullptr;
 Gtk::Window* Message::main                  = nullptr;
 
-Message::Message(const string& errorMessage, Gtk::Window* transient) : error(errorMessage) {
-	displayError(errorMessage, transient);
-}
-
 void Message::initialize(Glib::RefPtr<Gtk::Builder> const &builder, Gtk::Window* main) {
 	builder->get_widget("DialogErrorMessage",    errorDialog);
 	builder->get_widget("DialogInfoMessage",     infoDialog);
@@ -61,6 +59,10 @@ string Message::getMessage() {
 }
 
 int Message::handleDialog(const string& message, Gtk::MessageDialog* dialog, Gtk::Window* transient) {
+	if (not dialog or not (transient or main)) {
+		std::cerr << message << std::endl;
+		return Gtk::RESPONSE_NONE;
+	}
 	dialog->set_transient_for(transient ? *transient : *main);
 	dialog->set_secondary_text(message);
 	int r = dialog->run();
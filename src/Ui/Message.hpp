@@ -34,14 +34,11 @@ class Message {
 
 public:
 
-	Message(const string& errorMessage) : error(errorMessage) {}
-
 	/**
-	 * Throws an error and displays a error message dialog over transient window.
-	 * @param errorMessage text message to display.
-	 * @param transient the window to be over.
+	 * Raising an error does not display it, the catch decides to display it or send it to the diagnostics.
+	 * @param errorMessage
 	 */
-	Message(const string& errorMessage, Gtk::Window* transient);
+	Message(const string& errorMessage) : error(errorMessage) {}
 
 	virtual ~Message() = default;
 
@@ -98,6 +95,13 @@ protected:
 	// Keeps a pointer to the main screen to center.
 	static Gtk::Window* main;
 
+	/**
+	 * Runs a dialog, before initialize (command line modes) the message goes to the standard error.
+	 * @param message
+	 * @param dialog
+	 * @param transient
+	 * @return the response, RESPONSE_NONE without dialogs.
+	 */
 	static int handleDialog(const string& message, Gtk::MessageDialog* dialog, Gtk::Window* transient);
 };
 
@@ -40,7 +40,8 @@ OrdenableFlowBox::OrdenableFlowBox(
 		btnDn->set_sensitive(false);
 	});
 	signal_selected_children_changed().connect([=]() {
-		if (not get_selected_children().size()) {
+		// Only one item can be moved at the time.
+		if (get_selected_children().size() != 1) {
 			btnUp->set_sensitive(false);
 			btnDn->set_sensitive(false);
 			return;
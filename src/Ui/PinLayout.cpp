@@ -0,0 +1,160 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      PinLayout.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PinLayout.hpp"
+
+using namespace LEDSpicerUI::Ui;
+
+PinLayout::PinLayout(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builder>& builder) :
+	Gtk::DrawingArea(obj)
+{
+	set_has_tooltip(true);
+	signal_query_tooltip().connect(sigc::mem_fun(*this, &PinLayout::onQueryTooltip));
+}
+
+void PinLayout::setPins(uint8_t total, uint8_t columns) {
+	this->columns = columns ? columns : 1;
+	pins.clear();
+	pins.resize(total);
+	set_size_request(-1, ((total + this->columns - 1) / this->columns) * PIN_HEIGHT);
+	queue_draw();
+}
+
+void PinLayout::update(const Storage::BoxButtonCollection& elements) {
+
+	vector<Pin> newPins(pins.size());
+	const std::array<std::pair<const char*, Use>, 5> uses{{
+		{PIN,       Use::PIN},
+		{SOLENOID,  Use::SOLENOID},
+		{RED_PIN,   Use::RED},
+		{GREEN_PIN, Use::GREEN},
+		{BLUE_PIN,  Use::BLUE}
+	}};
+
+	for (auto boxButton : elements) {
+		const auto data(boxButton->getData());
+		const string name(data->getValue(NAME));
+		for (auto& use : uses) {
+			const string value(data->getValue(use.first));
+			if (not Defaults::isBetween(value, 1, newPins.size()))
+				continue;
+			Pin& pin(newPins[std::stoi(value) - 1]);
+			// The same element can only be once per pin.
+			if (not pin.elements.empty() and pin.elements.back() == name)
+				continue;
+			pin.elements.push_back(name);
+			pin.use = pin.elements.size() > 1 ? Use::MULTIPLE : use.second;
+		}
+	}
+
+	for (uint8_t c = 0; c < pins.size(); ++c) {
+		if (pins[c] == newPins[c])
+			continue;
+		pins[c] = std::move(newPins[c]);
+		damagePin(c);
+	}
+}
+
+bool PinLayout::on_draw(const Cairo::RefPtr<Cairo::Context>& cr) {
+
+	if (pins.empty())
+		return true;
+
+	const int width(getPinWidth());
+	auto style(get_style_context());
+
+	// Only paint the pins inside the damaged area.
+	double x1, y1, x2, y2;
+	cr->get_clip_extents(x1, y1, x2, y2);
+	const int
+		firstRow(std::max(0, static_cast<int>(y1) / PIN_HEIGHT)),
+		lastRow(static_cast<int>(y2) / PIN_HEIGHT),
+		firstColumn(std::max(0, static_cast<int>(x1) / width)),
+		lastColumn(std::min(columns - 1, static_cast<int>(x2) / width));
+
+	for (int row = firstRow; row <= lastRow; ++row) {
+		for (int column = firstColumn; column <= lastColumn; ++column) {
+			const size_t index(row * columns + column);
+			if (index >= pins.size())
+				return true;
+			const int
+				x(column * width),
+				y(row * PIN_HEIGHT);
+			style->context_save();
+			style->add_class("pin");
+			if (pins[index].use != Use::NONE)
+				style->add_class(css[static_cast<uint8_t>(pins[index].use)]);
+			style->render_background(cr, x + 1, y + 1, width - 2, PIN_HEIGHT - 2);
+			style->render_frame(cr, x + 1, y + 1, width - 2, PIN_HEIGHT - 2);
+			auto layout(create_pango_layout(std::to_string(index + 1)));
+			int textWidth, textHeight;
+			layout->get_pixel_size(textWidth, textHeight);
+			style->render_layout(cr, x + (width - textWidth) / 2, y + (PIN_HEIGHT - textHeight) / 2, layout);
+			style->context_restore();
+		}
+	}
+	return true;
+}
+
+bool PinLayout::onQueryTooltip(int x, int y, bool keyboardTooltip, const Glib::RefPtr<Gtk::Tooltip>& tooltip) {
+	const int index(getPinAt(x, y));
+	if (index == -1)
+		return false;
+
+	const string pinNumber(std::to_string(index + 1));
+	const auto& elements(pins[index].elements);
+	if (elements.empty()) {
+		tooltip->set_text("Pin " + pinNumber + " is not used");
+		return true;
+	}
+
+	vector<string> elementsTxt(elements);
+	string labelTxt("Pin " + pinNumber + " is used by element ");
+	if (elementsTxt.size() > 1) {
+		string lastElement(std::move(elementsTxt.back()));
+		elementsTxt.pop_back();
+		tooltip->set_text(labelTxt + Defaults::implode(elementsTxt, ", ") + " and " + lastElement);
+	}
+	else {
+		tooltip->set_text(labelTxt + elementsTxt[0]);
+	}
+	return true;
+}
+
+int PinLayout::getPinAt(int x, int y) const {
+	if (x < 0 or y < 0)
+		return -1;
+	const int column(x / getPinWidth());
+	if (column >= columns)
+		return -1;
+	const size_t index((y / PIN_HEIGHT) * columns + column);
+	return index < pins.size() ? index : -1;
+}
+
+int PinLayout::getPinWidth() const {
+	return std::max(1, get_allocated_width() / columns);
+}
+
+void PinLayout::damagePin(uint8_t index) {
+	const int width(getPinWidth());
+	queue_draw_area((index % columns) * width, (index / columns) * PIN_HEIGHT, width, PIN_HEIGHT);
+}
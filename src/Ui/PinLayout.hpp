@@ -0,0 +1,121 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      PinLayout.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Storage/BoxButtonCollection.hpp"
+
+#ifndef UI_PINLAYOUT_HPP_
+#define UI_PINLAYOUT_HPP_ 1
+
+namespace LEDSpicerUI::Ui {
+
+/**
+ * LEDSpicerUI::Ui::PinLayout
+ * Draws the hardware pins and what elements are using them.
+ * The pins are painted from an occupancy table, only the pins that changed are repainted.
+ */
+class PinLayout: public Gtk::DrawingArea {
+
+public:
+
+	PinLayout() = delete;
+
+	PinLayout(BaseObjectType* obj, const Glib::RefPtr<Gtk::Builder>& builder);
+
+	virtual ~PinLayout() = default;
+
+	/**
+	 * Changes the number of pins and columns, everything will be repainted.
+	 * @param total
+	 * @param columns
+	 */
+	void setPins(uint8_t total, uint8_t columns);
+
+	/**
+	 * Updates the occupancy table from a list of elements and repaints the pins that changed.
+	 * @param elements
+	 */
+	void update(const Storage::BoxButtonCollection& elements);
+
+protected:
+
+	/// How a pin is used, the value is the position inside css.
+	enum class Use : uint8_t {NONE, PIN, SOLENOID, RED, GREEN, BLUE, MULTIPLE};
+
+	/**
+	 * Pin occupancy.
+	 */
+	struct Pin {
+		Use use = Use::NONE;
+		/// The names of the elements using this pin, the elements can be deleted before the next update.
+		vector<string> elements;
+
+		bool operator==(const Pin& other) const {
+			return use == other.use and elements == other.elements;
+		}
+	};
+
+	/// CSS classes for every Use.
+	static constexpr std::array<const char*, 7> css{NO_COLOR, COLOR_PIN, COLOR_SOLENOID, COLOR_RED, COLOR_GREEN, COLOR_BLUE, COLOR_MULTIPLE};
+
+	/// Height of every pin.
+	static constexpr int PIN_HEIGHT = 22;
+
+	/// Pin occupancy, pin 1 is at position 0.
+	vector<Pin> pins;
+
+	/// Number of pins per row.
+	uint8_t columns = 1;
+
+	bool on_draw(const Cairo::RefPtr<Cairo::Context>& cr) override;
+
+	/**
+	 * Creates the tooltip for the pin under the pointer.
+	 * @param x
+	 * @param y
+	 * @param keyboardTooltip
+	 * @param tooltip
+	 * @return
+	 */
+	bool onQueryTooltip(int x, int y, bool keyboardTooltip, const Glib::RefPtr<Gtk::Tooltip>& tooltip);
+
+	/**
+	 * @param x
+	 * @param y
+	 * @return the pin index under the coordinates, or -1.
+	 */
+	int getPinAt(int x, int y) const;
+
+	/**
+	 * @return the width of a pin.
+	 */
+	int getPinWidth() const;
+
+	/**
+	 * Repaints a single pin.
+	 * @param index
+	 */
+	void damagePin(uint8_t index);
+};
+
+} /* namespace */
+
+#endif /* UI_PINLAYOUT_HPP_ */
@@ -0,0 +1,204 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ProfileResolver.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ProfileResolver.hpp"
+
+using namespace LEDSpicerUI::Ui;
+
+ProfileResolver::ProfileResolver(
+	const Storage::BoxButtonCollection& devices,
+	const Storage::BoxButtonCollection& groups,
+	const Storage::BoxButtonCollection& profiles
+) :
+	devices(devices),
+	groups(groups),
+	profiles(profiles)
+{
+	DataDialogs::DialogForm::signalDataChanged().connect(sigc::mem_fun(*this, &ProfileResolver::invalidate));
+	DataDialogs::DialogForm::signalBulkChanged().connect(sigc::mem_fun(*this, &ProfileResolver::invalidateBulk));
+}
+
+const ProfileResolver::ColorTable& ProfileResolver::resolve(const vector<string>& stack) {
+	const auto& elements = getElements();
+
+	vector<std::pair<const Storage::Profile*, uint64_t>> current;
+	vector<const Layer*> currentLayers;
+	for (const auto& name : stack) {
+		auto profile = findProfile(name);
+		if (not profile)
+			continue;
+		currentLayers.push_back(&getLayer(profile));
+		current.emplace_back(profile, currentLayers.back()->generation);
+	}
+
+	auto& resolved = stacks[Defaults::implode(stack, FIELD_SEPARATOR)];
+	if (resolved.elementsGeneration == elementsGeneration and resolved.layers == current and not resolved.table.empty())
+		return resolved.table;
+
+	resolved.layers             = std::move(current);
+	resolved.elementsGeneration = elementsGeneration;
+	resolved.table.clear();
+
+	// The top most background wins.
+	string background(DEFAULT_PROFILE_BACKGROUND_COLOR);
+	for (auto layer : currentLayers)
+		if (not layer->background.empty())
+			background = layer->background;
+	for (const auto& e : elements)
+		resolved.table.emplace(e.first, background);
+
+	for (auto layer : currentLayers) {
+		for (const auto& [element, color] : layer->colors) {
+			auto e = elements.find(element);
+			// Not in this layout.
+			if (e == elements.end())
+				continue;
+			const string& c(color.empty() ? e->second : color);
+			if (not c.empty())
+				resolved.table[element] = c;
+		}
+	}
+	return resolved.table;
+}
+
+void ProfileResolver::invalidate(const Storage::Data* data, const string& previousId) {
+	if (auto profile = dynamic_cast<const Storage::Profile*>(data)) {
+		layers.erase(profile);
+		return;
+	}
+
+	// Elements and devices change the layout.
+	if (dynamic_cast<const Storage::Element*>(data) or dynamic_cast<const Storage::Device*>(data)) {
+		elementsValid = false;
+		++elementsGeneration;
+	}
+
+	const string name(data->getValue(NAME));
+	for (auto l = layers.begin(); l != layers.end();) {
+		if (l->second.names.count(name) or l->second.names.count(previousId))
+			l = layers.erase(l);
+		else
+			++l;
+	}
+}
+
+void ProfileResolver::invalidateBulk(const vector<const Storage::Data*>& changed) {
+	unordered_set<string> names;
+	bool layout = false;
+	for (auto data : changed) {
+		if (auto profile = dynamic_cast<const Storage::Profile*>(data)) {
+			layers.erase(profile);
+			continue;
+		}
+		if (dynamic_cast<const Storage::Element*>(data) or dynamic_cast<const Storage::Device*>(data))
+			layout = true;
+		names.insert(data->getValue(NAME));
+	}
+
+	if (layout) {
+		elementsValid = false;
+		++elementsGeneration;
+	}
+
+	for (auto l = layers.begin(); l != layers.end();) {
+		bool used = false;
+		for (const auto& name : names) {
+			if (l->second.names.count(name)) {
+				used = true;
+				break;
+			}
+		}
+		if (used)
+			l = layers.erase(l);
+		else
+			++l;
+	}
+}
+
+void ProfileResolver::clear() {
+	layers.clear();
+	stacks.clear();
+	elements.clear();
+	elementsValid = false;
+}
+
+const LEDSpicerUI::Ui::Storage::Profile* ProfileResolver::findProfile(const string& name) const {
+	for (auto b : profiles)
+		if (b->getData()->getValue(FILENAME) == name)
+			return dynamic_cast<const Storage::Profile*>(b->getData());
+	return nullptr;
+}
+
+const LEDSpicerUI::Ui::Storage::Group* ProfileResolver::findGroup(const string& name) const {
+	for (auto b : groups)
+		if (b->getData()->getValue(NAME) == name)
+			return dynamic_cast<const Storage::Group*>(b->getData());
+	return nullptr;
+}
+
+const ProfileResolver::Layer& ProfileResolver::getLayer(const Storage::Profile* profile) {
+	auto l = layers.find(profile);
+	if (l != layers.end())
+		return l->second;
+
+	Layer& layer = layers[profile];
+	layer.generation = ++generation;
+	layer.background = profile->getValue(BACKGROUND_COLOR);
+	// Groups first, elements override them.
+	for (auto b : profile->getAlwaysOnGroups()) {
+		const string name(b->getData()->getValue(NAME));
+		layer.names.insert(name);
+		auto group = findGroup(name);
+		if (not group)
+			continue;
+		string color(b->getData()->getValue(COLOR));
+		if (color.empty())
+			color = group->getValue(DEFAULT_COLOR);
+		for (auto e : group->getElements()) {
+			const string element(e->getData()->getValue(NAME));
+			layer.names.insert(element);
+			layer.colors.emplace_back(element, color);
+		}
+	}
+	for (auto b : profile->getAlwaysOnElements()) {
+		const string element(b->getData()->getValue(NAME));
+		layer.names.insert(element);
+		layer.colors.emplace_back(element, b->getData()->getValue(COLOR));
+	}
+	return layer;
+}
+
+const unordered_map<string, string>& ProfileResolver::getElements() {
+	if (elementsValid)
+		return elements;
+	elements.clear();
+	for (auto d : devices) {
+		auto device = dynamic_cast<const Storage::Device*>(d->getData());
+		if (not device)
+			continue;
+		for (auto e : device->getElements())
+			elements.emplace(e->getData()->getValue(NAME), e->getData()->getValue(DEFAULT_COLOR));
+	}
+	elementsValid = true;
+	return elements;
+}
@@ -0,0 +1,158 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ProfileResolver.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Storage/Device.hpp"
+#include "Storage/Element.hpp"
+#include "Storage/Group.hpp"
+#include "Storage/Profile.hpp"
+
+#include <map>
+#include <unordered_set>
+using std::unordered_set;
+
+#ifndef UI_PROFILERESOLVER_HPP_
+#define UI_PROFILERESOLVER_HPP_ 1
+
+namespace LEDSpicerUI::Ui {
+
+/**
+ * LEDSpicerUI::Ui::ProfileResolver
+ * Resolves the always on elements and groups of a stack of profiles into the color every element shows.
+ * Animations and inputs are not resolved, they change over time and the preview runs them on top of this table.
+ * Every profile is flattened once into a layer, and every stack result is kept until one of its layers changes.
+ * Changes arrive from the forms, only the layers that use the changed data are dropped.
+ */
+class ProfileResolver : public sigc::trackable {
+
+public:
+
+	/// Element name to color name, sorted by element.
+	using ColorTable = std::map<string, string>;
+
+	/**
+	 * @param devices where the elements are.
+	 * @param groups
+	 * @param profiles
+	 */
+	ProfileResolver(
+		const Storage::BoxButtonCollection& devices,
+		const Storage::BoxButtonCollection& groups,
+		const Storage::BoxButtonCollection& profiles
+	);
+
+	virtual ~ProfileResolver() = default;
+
+	/**
+	 * Resolves a stack of profiles, missing profiles are ignored.
+	 * @param stack profile names from bottom to top.
+	 * @return the color of every element, the reference is valid until the next call.
+	 */
+	const ColorTable& resolve(const vector<string>& stack);
+
+	/**
+	 * Drops anything that uses the data.
+	 * @param data
+	 * @param previousId the data unique ID before the change.
+	 */
+	void invalidate(const Storage::Data* data, const string& previousId);
+
+	/**
+	 * Drops anything that uses any of the data, in one pass over the layers.
+	 * @param changed
+	 */
+	void invalidateBulk(const vector<const Storage::Data*>& changed);
+
+	/**
+	 * Drops everything, needs to be called when the collections are wiped.
+	 */
+	void clear();
+
+protected:
+
+	/**
+	 * A flattened profile.
+	 */
+	struct Layer {
+		uint64_t generation;
+		string   background;
+		/// Element and color in the order they are applied, an empty color means the element default color.
+		vector<std::pair<string, string>> colors;
+		/// Every group and element name used.
+		unordered_set<string> names;
+	};
+
+	/**
+	 * A resolved stack and the layers it was made from.
+	 */
+	struct Stack {
+		vector<std::pair<const Storage::Profile*, uint64_t>> layers;
+		uint64_t   elementsGeneration;
+		ColorTable table;
+	};
+
+	const Storage::BoxButtonCollection
+		& devices,
+		& groups,
+		& profiles;
+
+	unordered_map<const Storage::Profile*, Layer> layers;
+
+	/// Resolved stacks by their names.
+	unordered_map<string, Stack> stacks;
+
+	/// Element names and their default colors.
+	unordered_map<string, string> elements;
+
+	bool elementsValid = false;
+
+	uint64_t
+		elementsGeneration = 0,
+		generation         = 0;
+
+	/**
+	 * @param name
+	 * @return the profile or nullptr if not found.
+	 */
+	const Storage::Profile* findProfile(const string& name) const;
+
+	/**
+	 * @param name
+	 * @return the group or nullptr if not found.
+	 */
+	const Storage::Group* findGroup(const string& name) const;
+
+	/**
+	 * @param profile
+	 * @return the flattened profile, built if needed.
+	 */
+	const Layer& getLayer(const Storage::Profile* profile);
+
+	/**
+	 * @return the elements and their default color, built if needed.
+	 */
+	const unordered_map<string, string>& getElements();
+};
+
+} /* namespace */
+
+#endif /* UI_PROFILERESOLVER_HPP_ */
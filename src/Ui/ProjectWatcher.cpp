@@ -0,0 +1,251 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ProjectWatcher.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ProjectWatcher.hpp"
+
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <map>
+
+using namespace LEDSpicerUI::Ui;
+
+bool ProjectWatcher::Changes::empty() const {
+	return remove.empty() and load.empty() and not settings;
+}
+
+ProjectWatcher::~ProjectWatcher() {
+	stop();
+}
+
+void ProjectWatcher::start(const string& directory) {
+	stop();
+	ProjectWatcher::directory = directory;
+	fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (fd == -1) {
+		Diagnostics::warning("Unable to watch the project for outside changes", directory);
+		return;
+	}
+	addWatch(directory);
+	addWatch(directory + "/inputs");
+	io = Glib::signal_io().connect(sigc::mem_fun(*this, &ProjectWatcher::onEvents), fd, Glib::IO_IN);
+}
+
+void ProjectWatcher::stop() {
+	io.disconnect();
+	debounce.disconnect();
+	if (fd != -1) {
+		// Closing the instance drops its watches.
+		close(fd);
+		fd = -1;
+	}
+	watches.clear();
+	pending.clear();
+	prints.clear();
+}
+
+void ProjectWatcher::setBaseline(const string& fileName, XMLHelper& file) {
+	prints[fileName] = createPrints(file);
+}
+
+ProjectWatcher::Changes ProjectWatcher::compare(const string& fileName, XMLHelper& file) const {
+	Changes changes;
+	changes.prints = createPrints(file);
+	const auto& current(changes.prints);
+	static const unordered_map<string, size_t> none;
+	auto remembered(prints.find(fileName));
+	const auto& previous(remembered == prints.end() ? none : remembered->second);
+	for (const auto& print : current) {
+		auto old(previous.find(print.first));
+		if (old != previous.end() and old->second == print.second)
+			continue;
+		if (print.first == SETTINGS) {
+			changes.settings = true;
+			continue;
+		}
+		// collection FIELD_SEPARATOR unique ID.
+		const size_t separator(print.first.find(FIELD_SEPARATOR));
+		const string
+			collection(print.first.substr(0, separator)),
+			id(print.first.substr(separator + 1));
+		if (old != previous.end())
+			changes.remove[collection].insert(id);
+		changes.load[collection].insert(id);
+	}
+	for (const auto& print : previous) {
+		if (current.count(print.first) or print.first == SETTINGS)
+			continue;
+		const size_t separator(print.first.find(FIELD_SEPARATOR));
+		changes.remove[print.first.substr(0, separator)].insert(print.first.substr(separator + 1));
+	}
+	return changes;
+}
+
+void ProjectWatcher::accept(const string& fileName, Changes& changes) {
+	prints[fileName] = std::move(changes.prints);
+}
+
+string ProjectWatcher::createUniqueId(const string& collection, const unordered_map<string, string>& record) {
+	if (collection == COLLECTION_DEVICES)
+		// Same defaults the configuration file uses for the elements.
+		return Defaults::createHardwareUniqueId(
+			Defaults::getDeviceType(XMLHelper::valueOf(record, NAME, "")),
+			XMLHelper::valueOf(record, ID, "1"),
+			XMLHelper::valueOf(record, PORT, "")
+		);
+	if (collection == COLLECTION_RESTRICTORS)
+		return Defaults::createHardwareUniqueId(
+			Defaults::getRestrictorType(XMLHelper::valueOf(record, NAME, "")),
+			XMLHelper::valueOf(record, ID, "1"),
+			XMLHelper::valueOf(record, PORT, "")
+		);
+	if (collection == COLLECTION_PROCESS)
+		return XMLHelper::valueOf(record, PARAM_PROCESS_NAME, "");
+	if (collection == COLLECTION_INPUT)
+		return Defaults::createCommonUniqueId({XMLHelper::valueOf(record, FILENAME, "")});
+	return Defaults::createCommonUniqueId({XMLHelper::valueOf(record, NAME, "")});
+}
+
+bool ProjectWatcher::isConfig(const string& fileName) const {
+	return fileName == directory + CONFIG_FILE;
+}
+
+bool ProjectWatcher::isInput(const string& fileName) const {
+	return
+		Glib::path_get_dirname(fileName) == directory + "/inputs" and
+		fileName.size() > 4 and
+		fileName.compare(fileName.size() - 4, 4, ".xml") == 0;
+}
+
+ProjectWatcher::ChangedSignal& ProjectWatcher::signalChanged() {
+	return changed;
+}
+
+void ProjectWatcher::addWatch(const string& path) {
+	for (const auto& watch : watches)
+		if (watch.second == path)
+			return;
+	// Writes in place and editors that save by renaming, the directory events bring new subdirectories.
+	int wd = inotify_add_watch(fd, path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR);
+	if (wd != -1)
+		watches[wd] = path;
+}
+
+bool ProjectWatcher::onEvents(Glib::IOCondition condition) {
+	alignas(struct inotify_event) char buffer[4096];
+	ssize_t size;
+	while ((size = read(fd, buffer, sizeof(buffer))) > 0) {
+		for (char* p = buffer; p < buffer + size; p += sizeof(struct inotify_event) + reinterpret_cast<struct inotify_event*>(p)->len) {
+			auto event(reinterpret_cast<struct inotify_event*>(p));
+			// Events were lost, check everything that is known.
+			if (event->mask & IN_Q_OVERFLOW) {
+				for (const auto& print : prints)
+					pending.insert(print.first);
+				continue;
+			}
+			if (not event->len or not watches.count(event->wd))
+				continue;
+			const string path(watches.at(event->wd) + "/" + event->name);
+			if (event->mask & IN_ISDIR) {
+				// The inputs directory is created with the first save.
+				if (path == directory + "/inputs")
+					addWatch(path);
+				continue;
+			}
+			// A new file is reported when written.
+			if (event->mask & IN_CREATE)
+				continue;
+			if (isConfig(path) or isInput(path))
+				pending.insert(path);
+		}
+	}
+	if (not pending.empty()) {
+		debounce.disconnect();
+		debounce = Glib::signal_timeout().connect(sigc::mem_fun(*this, &ProjectWatcher::onQuiet), DEBOUNCE_MS);
+	}
+	return true;
+}
+
+bool ProjectWatcher::onQuiet() {
+	// Handlers may ask the user and new events may arrive meanwhile.
+	vector<string> files(pending.begin(), pending.end());
+	pending.clear();
+	// The configuration first, inputs use its elements and groups.
+	std::stable_partition(files.begin(), files.end(), [&](const string& file) {
+		return isConfig(file);
+	});
+	for (const auto& file : files)
+		changed.emit(file);
+	return false;
+}
+
+unordered_map<string, size_t> ProjectWatcher::createPrints(XMLHelper& file) {
+	std::hash<string> hash;
+	unordered_map<string, size_t> result;
+
+	// The record with all its children, in order.
+	auto add = [&](const string& collection, const unordered_map<string, string>& record, const vector<string>& children) {
+		string print(createPrint(record));
+		for (const auto& child : children) {
+			print += RECORD_SEPARATOR + child;
+			for (const auto& childRecord : file.getData(child))
+				print += RECORD_SEPARATOR + createPrint(childRecord);
+		}
+		result[Defaults::createCommonUniqueId({collection, createUniqueId(collection, record)})] = hash(print);
+	};
+
+	for (const auto& record : file.getData(COLLECTION_DEVICES))
+		add(COLLECTION_DEVICES, record, {Defaults::createCommonUniqueId({createUniqueId(COLLECTION_DEVICES, record), COLLECTION_ELEMENT})});
+
+	for (const auto& record : file.getData(COLLECTION_GROUP))
+		add(COLLECTION_GROUP, record, {Defaults::createCommonUniqueId({XMLHelper::valueOf(record, NAME, ""), COLLECTION_GROUP})});
+
+	for (const auto& record : file.getData(COLLECTION_RESTRICTORS))
+		add(COLLECTION_RESTRICTORS, record, {Defaults::createCommonUniqueId({createUniqueId(COLLECTION_RESTRICTORS, record), COLLECTION_RESTRICTOR_MAP})});
+
+	for (const auto& record : file.getData(COLLECTION_PROCESS))
+		add(COLLECTION_PROCESS, record, {});
+
+	for (const auto& record : file.getData(COLLECTION_INPUT)) {
+		const string name(XMLHelper::valueOf(record, FILENAME, ""));
+		add(COLLECTION_INPUT, record, {
+			Defaults::createCommonUniqueId({name, COLLECTION_INPUT_MAPS}),
+			Defaults::createCommonUniqueId({name, COLLECTION_INPUT_LINKED_MAPS})
+		});
+	}
+
+	auto config(dynamic_cast<ConfigFile*>(&file));
+	if (config) {
+		auto settings(config->getSettings());
+		settings["defaultProfile"] = config->getDefaultProfile();
+		settings[PARAM_MILLISECONDS] = config->getProcessLookupRunEvery();
+		result[SETTINGS] = hash(createPrint(settings));
+	}
+	return result;
+}
+
+string ProjectWatcher::createPrint(const unordered_map<string, string>& record) {
+	string print;
+	for (const auto& field : std::map<string, string>(record.begin(), record.end()))
+		print += field.first + FIELD_SEPARATOR + field.second + FIELD_SEPARATOR;
+	return print;
+}
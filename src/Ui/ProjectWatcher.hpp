@@ -0,0 +1,196 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      ProjectWatcher.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Message.hpp"
+#include "ConfigFile.hpp"
+#include "InputFile.hpp"
+
+#include <unordered_set>
+using std::unordered_set;
+
+#ifndef UI_PROJECTWATCHER_HPP_
+#define UI_PROJECTWATCHER_HPP_ 1
+
+namespace LEDSpicerUI::Ui {
+
+/**
+ * LEDSpicerUI::Ui::ProjectWatcher
+ * Watches the working directory with inotify, on the main loop, and tells which project files were written outside the editor.
+ * Bursts of events are joined, the file is reported once after it stays quiet for DEBOUNCE_MS.
+ * Also keeps a print of every record of the last known version of each file, so a new version can be compared record by record.
+ */
+class ProjectWatcher {
+
+public:
+
+	/// Quiet time before a changed file is reported.
+	static constexpr uint DEBOUNCE_MS = 300;
+
+	/// Key for the configuration settings inside the records.
+	static constexpr char const* SETTINGS = "settings";
+
+	/**
+	 * The records that differ between two versions of a file, by collection and unique ID.
+	 */
+	struct Changes {
+		/// Records gone or changed, they need to be removed from the model.
+		unordered_map<string, unordered_set<string>> remove;
+		/// Records new or changed, they need to be loaded from the new file.
+		unordered_map<string, unordered_set<string>> load;
+		/// true if the configuration settings changed.
+		bool settings = false;
+		/// Prints of the new version, remembered by accept.
+		unordered_map<string, size_t> prints;
+
+		/**
+		 * @return true if nothing changed.
+		 */
+		bool empty() const;
+	};
+
+	ProjectWatcher() = default;
+
+	virtual ~ProjectWatcher();
+
+	/**
+	 * Starts watching a project, any previous one is stopped.
+	 * @param directory the working directory, without / at the end.
+	 */
+	void start(const string& directory);
+
+	/**
+	 * Stops watching and forgets every print.
+	 */
+	void stop();
+
+	/**
+	 * Remembers the records of a file as the version the model has.
+	 * @param fileName
+	 * @param file the parsed file.
+	 */
+	void setBaseline(const string& fileName, XMLHelper& file);
+
+	/**
+	 * Compares a new version of a file with the remembered one, the remembered one is kept until accept is called.
+	 * Records without a remembered version are reported as new.
+	 * @param fileName
+	 * @param file the parsed file.
+	 * @return
+	 */
+	Changes compare(const string& fileName, XMLHelper& file) const;
+
+	/**
+	 * Remembers the compared version, once the model has its changes.
+	 * @param fileName
+	 * @param changes the result of compare, its prints are moved.
+	 */
+	void accept(const string& fileName, Changes& changes);
+
+	/**
+	 * @param collection
+	 * @param record a raw record, as the files extract it.
+	 * @return the unique ID the model will give to the record.
+	 */
+	static string createUniqueId(const string& collection, const unordered_map<string, string>& record);
+
+	/**
+	 * @param fileName
+	 * @return true if the file is the project configuration.
+	 */
+	bool isConfig(const string& fileName) const;
+
+	/**
+	 * @param fileName
+	 * @return true if the file is an input plugin inside the project.
+	 */
+	bool isInput(const string& fileName) const;
+
+	/// Receives the full path of a file that changed.
+	using ChangedSignal = sigc::signal<void, const string&>;
+
+	/**
+	 * Emitted once per file when its burst of events ends.
+	 * @return
+	 */
+	ChangedSignal& signalChanged();
+
+protected:
+
+	/// The inotify instance, -1 when not watching.
+	int fd = -1;
+
+	/// The working directory.
+	string directory;
+
+	/// Watch descriptors and the directory they watch.
+	unordered_map<int, string> watches;
+
+	/// Files waiting for the end of their burst.
+	unordered_set<string> pending;
+
+	/// Prints of the remembered records, by file, by collection and unique ID.
+	unordered_map<string, unordered_map<string, size_t>> prints;
+
+	sigc::connection
+		io,
+		debounce;
+
+	ChangedSignal changed;
+
+	/**
+	 * Adds a directory to the watch list, missing directories are ignored.
+	 * @param path
+	 */
+	void addWatch(const string& path);
+
+	/**
+	 * Reads the queued inotify events.
+	 * @param condition
+	 * @return false to stop watching.
+	 */
+	bool onEvents(Glib::IOCondition condition);
+
+	/**
+	 * Reports the pending files.
+	 * @return false, the timeout runs once.
+	 */
+	bool onQuiet();
+
+	/**
+	 * Creates the prints of every record in a file.
+	 * Devices, groups, restrictors and inputs include their elements, maps and linked maps.
+	 * @param file
+	 * @return the prints by collection and unique ID.
+	 */
+	static unordered_map<string, size_t> createPrints(XMLHelper& file);
+
+	/**
+	 * @param record
+	 * @return a print of the record values, does not depend on the values order.
+	 */
+	static string createPrint(const unordered_map<string, string>& record);
+};
+
+} /* namespace */
+
+#endif /* UI_PROJECTWATCHER_HPP_ */
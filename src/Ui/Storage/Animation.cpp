@@ -0,0 +1,121 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Animation.cpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Animation.hpp"
+
+using namespace LEDSpicerUI::Ui::Storage;
+
+Animation::Animation(unordered_map<string, string>& data) :
+	Data(data),
+	diskName(getValue(NAME)),
+	// A new animation has nothing to read.
+	loaded(diskName.empty())
+{}
+
+Animation::~Animation() {
+	if (not getValue(NAME).empty()) {
+		CollectionHandler::getInstance(COLLECTION_ANIMATIONS)->remove(createUniqueId());
+	}
+}
+
+const string Animation::getCssClass() const {
+	return "AnimationBoxButton";
+}
+
+const string Animation::createPrettyName() const {
+	return fieldsData.at(NAME);
+}
+
+const string Animation::createTooltip() const {
+	AnimationCatalogue::Entry entry;
+	if (loaded)
+		entry = AnimationCatalogue::createEntry(actors);
+	else if (auto e = AnimationCatalogue::find(diskName))
+		entry = *e;
+	else
+		return "";
+	return "Actors: " + Defaults::implode(entry.types, ',') + "\nGroups: " + Defaults::implode(entry.targets, ',');
+}
+
+const string Animation::createUniqueId() const {
+	return getValue(NAME);
+}
+
+const string Animation::toXML() const {
+	string r(
+		"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+		"<!-- " DEFAULT_MESSAGE "-->\n"
+		"<LEDSpicer\n"
+		"\tversion=\"" PACKAGE_DATA_VERSION "\"\n"
+		"\ttype=\"Animation\"\n"
+		">\n"
+	);
+	Defaults::increaseTab();
+	for (const auto& actor : actors) {
+		r += Defaults::tab() + "<" ACTOR "\n";
+		Defaults::increaseTab();
+		// Type and target first, the rest depends on the type.
+		r += Defaults::tab() + TYPE "=\"" + XMLHelper::valueOf(actor, TYPE) + "\"\n";
+		r += Defaults::tab() + ACTOR_TARGET "=\"" + XMLHelper::valueOf(actor, ACTOR_TARGET) + "\"\n";
+		std::map<string, string> sorted(actor.begin(), actor.end());
+		sorted.erase(TYPE);
+		sorted.erase(ACTOR_TARGET);
+		for (const auto& v : sorted)
+			r += Defaults::tab() + v.first + "=\"" + v.second + "\"\n";
+		Defaults::reduceTab();
+		r += Defaults::tab() + "/>\n";
+	}
+	Defaults::reduceTab();
+	r += "</LEDSpicer>\n";
+	return r;
+}
+
+const vector<unordered_map<string, string>>& Animation::getActors() {
+	if (not loaded) {
+		actors = AnimationCatalogue::load(diskName);
+		loaded = true;
+	}
+	return actors;
+}
+
+void Animation::setActors(vector<unordered_map<string, string>>&& actors) {
+	Animation::actors = std::move(actors);
+	loaded   = true;
+	modified = true;
+}
+
+bool Animation::isModified() const {
+	// A rename needs a new file even if the actors were never read.
+	return modified or diskName != getValue(NAME);
+}
+
+const string& Animation::getDiskName() const {
+	return diskName;
+}
+
+void Animation::save() {
+	getActors();
+	AnimationCatalogue::save(getValue(NAME), actors, toXML());
+	// The old file, if renamed, is left for the caller to remove.
+	diskName = getValue(NAME);
+	modified = false;
+}
@@ -0,0 +1,100 @@
+/* -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/**
+ * @file      Animation.hpp
+ * @since     Oct 19, 2026
+ * @author    Patricio A. Rossi (MeduZa)
+ *
+ * @copyright Copyright © 2023 - 2024 Patricio A. Rossi (MeduZa)
+ *
+ * @copyright LEDSpicerUI is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * @copyright LEDSpicerUI is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * @copyright You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Data.hpp"
+#include "CollectionHandler.hpp"
+#include "AnimationCatalogue.hpp"
+
+#ifndef ANIMATION_HPP_
+#define ANIMATION_HPP_ 1
+
+namespace LEDSpicerUI::Ui::Storage {
+
+/**
+ * LEDSpicerUI::Ui::Storage::Animation
+ * An animation file, the actors are read from the catalogue the first time they are needed.
+ */
+class Animation: public Data {
+
+public:
+
+	Animation(unordered_map<string, string>& data);
+
+	virtual ~Animation();
+
+	const string getCssClass() const override;
+
+	const string createPrettyName() const override;
+
+	const string createTooltip() const override;
+
+	const string createUniqueId() const override;
+
+	const string toXML() const override;
+
+	/**
+	 * @return the actors, the file is parsed on the first call.
+	 * @throws Message if the file cannot be read.
+	 */
+	const vector<unordered_map<string, string>>& getActors();
+
+	/**
+	 * Replaces the actors, the animation needs to be saved.
+	 * @param actors
+	 */
+	void setActors(vector<unordered_map<string, string>>&& actors);
+
+	/**
+	 * @return true if the file on disk is not up to date.
+	 */
+	bool isModified() const;
+
+	/**
+	 * @return the name of the file on disk, empty if never saved.
+	 */
+	const string& getDiskName() const;
+
+	/**
+	 * Writes the animation file.
+	 * @throws Message
+	 */
+	void save();
+
+protected:
+
+	/// The name of the file on disk, empty if never saved.
+	string diskName;
+
+	/// The actors, only valid when loaded.
+	vector<unordered_map<string, string>> actors;
+
+	bool
+		/// True when the actors are in memory.
+		loaded   = false,
+		/// True when the actors or the name changed.
+		modified = false;
+
+};
+
+} /* namespace */
+
+#endif /* ANIMATION_HPP_ */
@@ -48,10 +48,13 @@ BoxButton::BoxButton(Data* form) :
 		get_style_context()->add_class(form->getCssClass());
 	updateLabel();
 	show_all();
+	Stats::created(getType());
+	Stats::add(Stats::Counters::WIDGETS_CREATED);
 }
 
 BoxButton::~BoxButton() {
 	if (data) {
+		Stats::destroyed(getType());
 		delete data;
 		data = nullptr;
 	}
@@ -77,3 +80,11 @@ void BoxButton::updateLabel() {
 	text = data->createPrettyName();
 	label->set_text(text);
 }
+
+string BoxButton::getType() const {
+	string type(data->getCssClass());
+	const string suffix("BoxButton");
+	if (type.size() > suffix.size() and not type.compare(type.size() - suffix.size(), suffix.size(), suffix))
+		type.erase(type.size() - suffix.size());
+	return type;
+}
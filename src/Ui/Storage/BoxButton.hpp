@@ -94,6 +94,10 @@ protected:
 	/// Label to display.
 	Gtk::Label* label;
 
+	/**
+	 * @return the kind of data, for the statistics.
+	 */
+	string getType() const;
 };
 
 } /* namespace */
@@ -119,9 +119,37 @@ void BoxButtonCollection::rename(const string& name, const string& newName) {
 }
 
 void BoxButtonCollection::populateBox(OrdenableFlowBox* box) {
-	for (auto i : itemsOrder)
-		box->add(*i);
-	box->show_all();
+	// Only the rows that differ are touched, a change in the middle of the list does not move the rest.
+	unordered_set<const Gtk::Widget*> current(itemsOrder.begin(), itemsOrder.end());
+	bool changed = false;
+	auto removeRow = [&](Gtk::FlowBoxChild* row) {
+		// Deleted buttons leave empty rows.
+		if (row->get_child())
+			row->remove();
+		box->remove(*row);
+		changed = true;
+		Stats::add(Stats::Counters::ROWS_REMOVED);
+	};
+	// Rows of deleted items or of another owner.
+	for (auto widget : box->get_children()) {
+		auto row = dynamic_cast<Gtk::FlowBoxChild*>(widget);
+		if (not current.count(row->get_child()))
+			removeRow(row);
+	}
+	// The rest follow the collection order, missing or moved items are inserted at their position.
+	for (size_t index = 0; index < itemsOrder.size(); ++index) {
+		auto item = itemsOrder[index];
+		auto row  = box->get_child_at_index(index);
+		if (row and row->get_child() == item)
+			continue;
+		if (auto moved = dynamic_cast<Gtk::FlowBoxChild*>(item->get_parent()))
+			removeRow(moved);
+		box->insert(*item, index);
+		changed = true;
+		Stats::add(Stats::Counters::WIDGETS_CREATED);
+	}
+	if (changed)
+		box->show_all();
 }
 
 void BoxButtonCollection::reindex(OrdenableFlowBox* box) {
@@ -23,6 +23,9 @@
 #include "OrdenableFlowBox.hpp"
 #include "BoxButton.hpp"
 
+#include <unordered_set>
+using std::unordered_set;
+
 #ifndef BOXBUTTONCOLLECTION_HPP_
 #define BOXBUTTONCOLLECTION_HPP_ 1
 
@@ -149,6 +152,8 @@ public:
 
 	/**
 	 * Populate an OrdenableFlowBox with the BoxButton items.
+	 * The box is updated in place, only rows of removed, added or moved items are touched.
+	 * Owners share the dialog box, so a different owner still replaces every row.
 	 * @param box The OrdenableFlowBox to be populated.
 	 */
 	void populateBox(OrdenableFlowBox* box);
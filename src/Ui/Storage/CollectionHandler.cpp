@@ -26,7 +26,11 @@ using namespace LEDSpicerUI::Ui::Storage;
 
 unordered_map<string, CollectionHandler*> CollectionHandler::collections;
 
-CollectionHandler::CollectionHandler(const string& collectionName) {
+bool CollectionHandler::deferred = false;
+
+CollectionHandler::CollectionHandler(const string& collectionName) :
+	model(Gtk::ListStore::create(columns))
+{
 	collections.emplace(collectionName, this);
 }
 
@@ -35,6 +39,21 @@ void CollectionHandler::wipe() {
 		delete c.second;
 }
 
+void CollectionHandler::deferRemovals() {
+	deferred = true;
+}
+
+void CollectionHandler::flushRemovals() {
+	deferred = false;
+	for (auto& c : collections) {
+		for (const auto& item : c.second->removed)
+			if (not c.second->isUsed(item))
+				for (auto destination : c.second->destinationGroups)
+					destination->remove(item);
+		c.second->removed.clear();
+	}
+}
+
 CollectionHandler* CollectionHandler::getInstance(const string& collectionName) {
 	if (not collections.count(collectionName))
 		new CollectionHandler(collectionName);
@@ -46,18 +65,24 @@ const size_t CollectionHandler::getSize() const {
 }
 
 void CollectionHandler::refreshComboBox(Gtk::ComboBoxText* comboBox) {
-	Defaults::populateComboBoxText(comboBox, collection);
+	if (comboBox->get_model() != model) {
+		comboBox->set_model(model);
+		Stats::add(Stats::Counters::COMBO_REFRESHES);
+	}
 }
 
 void CollectionHandler::refreshComboBox(Gtk::ComboBoxText* comboBox, const vector<string>& ignoreList) {
-	comboBox->remove_all();
-	for (const auto& item : collection)
-		if (std::find(ignoreList.begin(), ignoreList.end(), item) == ignoreList.end())
-			comboBox->append(item);
+	auto filter(Gtk::TreeModelFilter::create(model));
+	unordered_set<string> ignore(ignoreList.begin(), ignoreList.end());
+	filter->set_visible_func([&, ignore](const Gtk::TreeModel::const_iterator& row) {
+		return not ignore.count(Glib::ustring(row->get_value(columns.text)).raw());
+	});
+	comboBox->set_model(filter);
+	Stats::add(Stats::Counters::COMBO_REFRESHES);
 }
 
 const bool CollectionHandler::isUsed(const string& item) const {
-	return std::find(collection.begin(), collection.end(), item) != collection.end();
+	return std::binary_search(collection.begin(), collection.end(), item);
 }
 
 const size_t CollectionHandler::count(const string& search) const {
@@ -73,31 +98,30 @@ std::vector<string> const& CollectionHandler::get() const {
 }
 
 void CollectionHandler::add(const string& item) {
-	if (not item.empty() and not isUsed(item)) {
-		collection.push_back(item);
-		std::sort(collection.begin(), collection.end());
-		populateComboboxesSorted();
-	}
+	if (not item.empty() and not isUsed(item))
+		insert(item);
 }
 
 void CollectionHandler::remove(const string& item) {
 	if (item.empty() or not isUsed(item))
 		return;
-	collection.erase(std::remove(collection.begin(), collection.end(), item), collection.end());
+	erase(find(item));
+	if (deferred) {
+		removed.push_back(item);
+		return;
+	}
 	for (auto destination : destinationGroups)
 		destination->remove(item);
-	populateComboboxesSorted();
 }
 
 void CollectionHandler::replace(const string& oldItem, const string& newItem) {
 	if (oldItem.empty() or not isUsed(oldItem))
 		return;
 	if (oldItem != newItem) {
-		std::replace(collection.begin(), collection.end(), oldItem, newItem);
+		erase(find(oldItem));
+		insert(newItem);
 		for (auto destination : destinationGroups)
 			destination->rename(oldItem, newItem);
-		std::sort(collection.begin(), collection.end());
-		populateComboboxesSorted();
 	}
 }
 
@@ -106,7 +130,7 @@ void CollectionHandler::registerDestination(BoxButtonCollection* destination) {
 }
 
 void CollectionHandler::registerDestination(Gtk::ComboBoxText* destination) {
-	destinationComboBoxes.push_back(destination);
+	destination->set_model(model);
 }
 
 void CollectionHandler::release(BoxButtonCollection* destination) {
@@ -117,10 +141,12 @@ void CollectionHandler::release(BoxButtonCollection* destination) {
 }
 
 void CollectionHandler::release(Gtk::ComboBoxText* destination) {
-	destinationComboBoxes.erase(
-		std::remove(destinationComboBoxes.begin(), destinationComboBoxes.end(), destination),
-		destinationComboBoxes.end()
-	);
+	if (destination->get_model() == model)
+		destination->set_model(Gtk::ListStore::create(columns));
+}
+
+Glib::RefPtr<Gtk::ListStore> CollectionHandler::getModel() {
+	return model;
 }
 
 vector<string>::iterator CollectionHandler::begin() {
@@ -139,11 +165,23 @@ vector<string>::const_iterator CollectionHandler::end() const {
 	return collection.end();
 }
 
-void CollectionHandler::populateComboboxesSorted() {
-	for (auto comboBox : destinationComboBoxes) {
-		comboBox->remove_all();
-		for (const auto& item : collection) {
-			comboBox->append(item);
-		}
-	}
+size_t CollectionHandler::find(const string& item) const {
+	return std::lower_bound(collection.begin(), collection.end(), item) - collection.begin();
+}
+
+void CollectionHandler::insert(const string& item) {
+	size_t position = find(item);
+	collection.insert(collection.begin() + position, item);
+	// children()[position] walks the list from the start, the kept rows do not.
+	auto row(position < rows.size() ? model->insert(rows[position]) : model->append());
+	rows.insert(rows.begin() + position, row);
+	(*row)[columns.text] = item;
+	Stats::add(Stats::Counters::COLLECTION_NOTIFICATIONS);
+}
+
+void CollectionHandler::erase(size_t position) {
+	collection.erase(collection.begin() + position);
+	model->erase(rows[position]);
+	rows.erase(rows.begin() + position);
+	Stats::add(Stats::Counters::COLLECTION_NOTIFICATIONS);
 }
@@ -30,6 +30,7 @@ namespace LEDSpicerUI::Ui::Storage {
 
 /**
  * LEDSpicerUI::Ui::Storage::CollectionHandler
+ * Keeps a sorted list of names, every combobox shows the same model so a change is done once.
  */
 class CollectionHandler {
 
@@ -51,6 +52,17 @@ public:
 	 */
 	static void wipe();
 
+	/**
+	 * Holds back the removals from the consumers until flushRemovals, on every collection.
+	 * Used when records are replaced, the consumers keep the items that come back.
+	 */
+	static void deferRemovals();
+
+	/**
+	 * Removes from the consumers the items removed while deferred that did not come back.
+	 */
+	static void flushRemovals();
+
 	/**
 	 * Get the number of registered items.
 	 * @return
@@ -58,13 +70,13 @@ public:
 	const size_t getSize() const;
 
 	/**
-	 * Refresh a single combobox contents with the collection values.
+	 * Binds a combobox to the collection model, the combobox will follow the collection.
 	 * @param comboBox the combobox to refresh.
 	 */
 	void refreshComboBox(Gtk::ComboBoxText* comboBox);
 
 	/**
-	 * Refresh a single combobox contents with the collection values.
+	 * Binds a combobox to a filtered view of the collection model.
 	 * @param comboBox the combobox to refresh.
 	 * @param ignoreList if set will ignore any elements in this list.
 	 */
@@ -116,7 +128,8 @@ public:
 	void registerDestination(BoxButtonCollection* destination);
 
 	/**
-	 * Register a collection consumer.
+	 * Register a collection consumer, it is bound to the collection model.
+	 * Never add or remove items directly into the combobox, that will change the collection model.
 	 * @param destination
 	 */
 	void registerDestination(Gtk::ComboBoxText* destination);
@@ -128,11 +141,16 @@ public:
 	void release(BoxButtonCollection* destination);
 
 	/**
-	 * Removes a collection consumer.
+	 * Removes a collection consumer, it gets an empty model.
 	 * @param destination
 	 */
 	void release(Gtk::ComboBoxText* destination);
 
+	/**
+	 * @return the model shared by all the comboboxes, with the same columns as a ComboBoxText.
+	 */
+	Glib::RefPtr<Gtk::ListStore> getModel();
+
 	vector<string>::iterator begin();
 
 	vector<string>::iterator end();
@@ -151,16 +169,56 @@ protected:
 	/// List of containers.
 	vector<BoxButtonCollection*> destinationGroups;
 
-	/// List of selectors.
-	vector<Gtk::ComboBoxText*> destinationComboBoxes;
+	/// Items removed while the removals are deferred.
+	vector<string> removed;
+
+	/// true while the removals are deferred.
+	static bool deferred;
+
+	/**
+	 * Columns of the model, the same of a ComboBoxText.
+	 */
+	class Columns : public Gtk::TreeModel::ColumnRecord {
+	public:
+		Gtk::TreeModelColumn<Glib::ustring>
+			text,
+			id;
+		Columns() {
+			add(text);
+			add(id);
+		}
+	};
+
+	Columns columns;
+
+	/// Model for the comboboxes, in the same order of the collection.
+	Glib::RefPtr<Gtk::ListStore> model;
+
+	/// The model row of every item, in the same order of the collection, list store rows stay valid while they exist.
+	vector<Gtk::TreeModel::iterator> rows;
 
 	/// Keeps collections instances.
 	static unordered_map<string, CollectionHandler*> collections;
 
 	/**
-	 * Sort and populates comboboxes.
+	 * @param item
+	 * @return the position where the item is or should be, the collection is always sorted.
+	 */
+	size_t find(const string& item) const;
+
+	/**
+	 * Inserts an item in order.
+	 * The position is a binary search and the model row is reached through rows, a list store insert is O(log n),
+	 * the collection and rows still shift their tail, so a load of n items is O(n^2) moves of small objects.
+	 * @param item
+	 */
+	void insert(const string& item);
+
+	/**
+	 * Removes an item at a position, the same costs as insert.
+	 * @param position
 	 */
-	void populateComboboxesSorted();
+	void erase(size_t position);
 
 };
 
@@ -65,41 +65,18 @@ void Data::wipe() {
 }
 
 const string Data::toXML() const {
-	return valuesXML(ignored, fieldsData);
-}
-
-string Data::valuesXML(const vector<string>& ignored, const unordered_map<string, string>& data) {
+	vector<string> keys;
+	keys.reserve(fieldsData.size());
+	for (const auto& v : fieldsData)
+		keys.push_back(v.first);
+	std::sort(keys.begin(), keys.end());
 	string r, el, tab(" ");
-	if (data.size() > 2) {
+	if (keys.size() > 2) {
 		el  = "\n";
 		tab = Defaults::tab();
 	}
-	for (const auto& v : data) {
-		if (std::find(ignored.begin(), ignored.end(), v.first) == ignored.end())
-			r += tab + v.first + "=\"" + v.second + "\"" + el;
-	}
-	return r;
-}
-
-string Data::createOpeningXML(const string& node, const unordered_map<string, string>& data, const vector<string>& ignored, bool empty) {
-	string r(Defaults::tab() + "<" + node);
-	if (data.size() > 2) {
-		r += "\n";
-		Defaults::increaseTab();
-		r += valuesXML(ignored, data);
-		Defaults::reduceTab();
-		r += Defaults::tab();
-	}
-	else {
-		r += valuesXML(ignored, data);
-	}
-	if (empty) {
-		r += "/>\n";
-	}
-	else {
-		r += ">\n";
-		Defaults::increaseTab();
-	}
+	for (const auto& key : keys)
+		r += tab + key + "=\"" + fieldsData.at(key) + "\"" + el;
 	return r;
 }
 
@@ -21,6 +21,7 @@
  */
 
 #include "Message.hpp"
+#include "Trace.hpp"
 
 #ifndef FORM_HPP_
 #define FORM_HPP_ 1
@@ -122,6 +123,7 @@ public:
 
 	/**
 	 * @brief Converts the data into XML string.
+	 * Nodes with a known schema override this, the default writes the attributes sorted by name.
 	 * @return The XML string representation of the box element.
 	 */
 	virtual const string toXML() const;
@@ -131,26 +133,72 @@ protected:
 	/// Data pairs.
 	unordered_map<string, string> fieldsData;
 
-	/// List of ignored data fields.
-	vector<string> ignored;
-
 	/**
-	 *
-	 * @param ignored
+	 * Counts how many attributes from the order list are present in data.
+	 * @param order
 	 * @param data
 	 * @return
 	 */
-	static string valuesXML(const vector<string>& ignored, const unordered_map<string, string>& data);
+	template <size_t N>
+	static size_t countAttributes(const std::array<const char*, N>& order, const unordered_map<string, string>& data) {
+		size_t total = 0;
+		for (const char* attribute : order)
+			total += data.count(attribute);
+		return total;
+	}
 
 	/**
-	 *
+	 * Converts data into XML attributes, following the order list.
+	 * Attributes not in the order list are not written.
+	 * @param order
+	 * @param data
+	 * @return
+	 */
+	template <size_t N>
+	static string valuesXML(const std::array<const char*, N>& order, const unordered_map<string, string>& data) {
+		string r, el, tab(" ");
+		if (countAttributes(order, data) > 2) {
+			el  = "\n";
+			tab = Defaults::tab();
+		}
+		for (const char* attribute : order) {
+			auto v(data.find(attribute));
+			if (v != data.end())
+				r += tab + v->first + "=\"" + v->second + "\"" + el;
+		}
+		return r;
+	}
+
+	/**
+	 * Creates the opening tag of a node with its attributes in the order list.
 	 * @param node
+	 * @param order
 	 * @param data
-	 * @param ignored
-	 * @param empty
+	 * @param empty if true the node will be closed.
 	 * @return
 	 */
-	static string createOpeningXML(const string& node, const unordered_map<string, string>& data, const vector<string>& ignored, bool empty);
+	template <size_t N>
+	static string createOpeningXML(const string& node, const std::array<const char*, N>& order, const unordered_map<string, string>& data, bool empty) {
+		string r(Defaults::tab() + "<" + node);
+		if (countAttributes(order, data) > 2) {
+			r += "\n";
+			Defaults::increaseTab();
+			r += valuesXML(order, data);
+			Defaults::reduceTab();
+			r += Defaults::tab();
+		}
+		else {
+			r += valuesXML(order, data);
+		}
+		if (empty) {
+			r += "/>\n";
+		}
+		else {
+			r += ">\n";
+			Defaults::increaseTab();
+		}
+		return r;
+	}
 
 	/**
 	 *
@@ -24,6 +24,12 @@
 
 using namespace LEDSpicerUI::Ui::Storage;
 
+Device::Device(unordered_map<string, string>& data) :
+	Data(data)
+{
+	resolveType();
+}
+
 Device::~Device() {
 	if (not fieldsData.empty()) {
 		CollectionHandler::getInstance(COLLECTION_DEVICES)->remove(createUniqueId());
@@ -31,12 +37,10 @@ Device::~Device() {
 }
 
 const string Device::createPrettyName() const {
-	string
-		name (fieldsData.at(NAME)),
-		r(Defaults::devicesInfo.at(name).name);
-	if (Defaults::isIdUser(name))
+	string r(Defaults::getInfo(type).name);
+	if (Defaults::isIdUser(type))
 		r += " Id: " + fieldsData.at(ID);
-	if (Defaults::isSerial(name))
+	if (Defaults::isSerial(type))
 		r += " Port: " + (fieldsData.at(PORT).empty() ? "<autodetect>" : fieldsData.at(PORT));
 	return r;
 }
@@ -46,7 +50,7 @@ const string Device::getCssClass() const {
 }
 
 const string Device::createUniqueId() const {
-	return Defaults::createHardwareUniqueId(*getValues());
+	return Defaults::createHardwareUniqueId(type, getValue(ID), getValue(PORT));
 }
 
 void Device::destroy() {
@@ -61,7 +65,8 @@ void Device::activate() {
 }
 
 const string Device::toXML() const {
-	string r(createOpeningXML("device", fieldsData, ignored, false));
+	TRACE_SPAN("toXML");
+	string r(createOpeningXML("device", Defaults::deviceAttributes, fieldsData, false));
 	for (const auto& e : elements) {
 		r += e->getData()->toXML();
 	}
@@ -69,4 +74,39 @@ const string Device::toXML() const {
 	return r;
 }
 
+void Device::resolveType() {
+	type = Defaults::getDeviceType(getValue(NAME));
+	hardwareKey = (type == Defaults::DeviceType::invalid ? 0 : Defaults::createHardwareKey(type, getValue(ID), getValue(PORT)));
+}
+
+Defaults::DeviceType Device::getType() const {
+	return type;
+}
+
+Defaults::HardwareKey Device::getHardwareKey() const {
+	return hardwareKey;
+}
 
+const BoxButtonCollection& Device::getElements() const {
+	return elements;
+}
+
+uint16_t Device::getPins() const {
+	uint16_t pins = Defaults::getInfo(type).pins;
+	if (Defaults::isVariable(type)) {
+		try {
+			pins = std::stoi(getValue(PINS));
+		}
+		catch (...) {}
+	}
+	return pins;
+}
+
+void Device::loadElements(XMLHelper* values) {
+	auto dialogElement(DataDialogs::DialogElement::getInstance());
+	dialogElement->changeNumberOfPins(getPins());
+	activate();
+	dialogElement->load(values);
+	deActivate();
+	dialogElement->changeNumberOfPins(0);
+}
@@ -40,7 +40,11 @@ class Device : public Data {
 
 public:
 
-	using Data::Data;
+	/**
+	 * Creates a new device and resolves its type.
+	 * @param data this values will be moved into the class.
+	 */
+	Device(unordered_map<string, string>& data);
 
 	virtual ~Device();
 
@@ -56,8 +60,45 @@ public:
 
 	const string toXML() const override;
 
+	/**
+	 * Resolves the device type and hardware key from the stored values, needs to be called after changing them.
+	 */
+	void resolveType();
+
+	/**
+	 * @return the device type.
+	 */
+	Defaults::DeviceType getType() const;
+
+	/**
+	 * @return the key that identifies this hardware.
+	 */
+	Defaults::HardwareKey getHardwareKey() const;
+
+	/**
+	 * @return the elements connected to this device.
+	 */
+	const BoxButtonCollection& getElements() const;
+
+	/**
+	 * @return the number of pins, on variable devices the configured LEDs.
+	 */
+	uint16_t getPins() const;
+
+	/**
+	 * Loads elements outside the device form, they are validated the same as the ones from a config file.
+	 * @param values the elements under the device elements collection.
+	 */
+	void loadElements(XMLHelper* values);
+
 protected:
 
+	/// The device type, resolved once from the name.
+	Defaults::DeviceType type = Defaults::DeviceType::invalid;
+
+	/// Packed name, ID and port.
+	Defaults::HardwareKey hardwareKey = 0;
+
 	/// Store a copy of elements from the elements dialog.
 	BoxButtonCollection elements;
 
@@ -43,20 +43,5 @@ const string Element::getCssClass() const {
 }
 
 const string Element::toXML() const {
-	return createOpeningXML("element", fieldsData, ignored, true);
-}
-
-string Element::getPinCssByData(uint8_t pin, Data* data) {
-	string pinS(std::to_string(pin));
-	if (not data->getValue(PIN).empty()       and data->getValue(PIN)       == pinS)
-		return COLOR_PIN;
-	if (not data->getValue(SOLENOID).empty()  and data->getValue(SOLENOID)  == pinS)
-		return COLOR_SOLENOID;
-	if (not data->getValue(RED_PIN).empty()   and data->getValue(RED_PIN)   == pinS)
-		return COLOR_RED;
-	if (not data->getValue(GREEN_PIN).empty() and data->getValue(GREEN_PIN) == pinS)
-		return COLOR_GREEN;
-	if (not data->getValue(BLUE_PIN).empty()  and data->getValue(BLUE_PIN)  == pinS)
-		return COLOR_BLUE;
-	return NO_COLOR;
+	return createOpeningXML("element", Defaults::elementAttributes, fieldsData, true);
 }
@@ -46,8 +46,6 @@ public:
 	const string getCssClass() const override;
 
 	const string toXML() const override;
-
-	static string getPinCssByData(uint8_t pin, Data* data);
 };
 
 } /* namespace */
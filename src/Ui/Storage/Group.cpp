@@ -52,8 +52,13 @@ void Group::activate() {
 	DataDialogs::DialogSelect::getInstance()->setOwner(&elements, this);
 }
 
+const BoxButtonCollection& Group::getElements() const {
+	return elements;
+}
+
 const string Group::toXML() const {
-	string r(createOpeningXML("group", fieldsData, ignored, false));
+	TRACE_SPAN("toXML");
+	string r(createOpeningXML("group", Defaults::groupAttributes, fieldsData, false));
 	for (const auto& e : elements) {
 		r += e->getData()->toXML();
 	}
@@ -51,6 +51,11 @@ public:
 
 	const string toXML() const override;
 
+	/**
+	 * @return the elements in this group.
+	 */
+	const BoxButtonCollection& getElements() const;
+
 protected:
 
 	BoxButtonCollection elements;
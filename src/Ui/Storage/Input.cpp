@@ -38,8 +38,6 @@ Input::Input(unordered_map<string, string>& data) :
 	CollectionHandler::getInstance(COLLECTION_INPUT_MAPS)->registerDestination(&maps);
 	// link linked maps to maps using the trigger.
 	CollectionHandler::getInstance(COLLECTION_INPUT_LINKED_MAPS)->registerDestination(&linkedMaps);
-	// this value is not used as data, only for filename.
-	ignored.push_back(FILENAME);
 }
 
 Input::~Input() {
@@ -76,13 +74,18 @@ void Input::activate() {
 	DataDialogs::DialogInputLinkMaps::getInstance()->setOwner(&linkedMaps, this);
 }
 
+const BoxButtonCollection& Input::getMaps() const {
+	return maps;
+}
+
 const string Input::toXML() const {
+	TRACE_SPAN("toXML");
 	string r("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\
 	<LEDSpicer\
 		version=\"1.0\"\
 		type=\"Input\"\n");
 	Defaults::increaseTab();
-	r += Data::toXML();
+	r += valuesXML(Defaults::inputAttributes, fieldsData);
 	Defaults::reduceTab();
 	r += ">\n";
 	Defaults::increaseTab();
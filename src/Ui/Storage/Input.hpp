@@ -52,6 +52,11 @@ public:
 
 	const string toXML() const override;
 
+	/**
+	 * @return the input maps.
+	 */
+	const BoxButtonCollection& getMaps() const;
+
 protected:
 
 	BoxButtonCollection maps;
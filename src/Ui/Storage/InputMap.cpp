@@ -48,5 +48,5 @@ const string InputMap::getCssClass() const {
 }
 
 const string InputMap::toXML() const {
-	return createOpeningXML("map", fieldsData, ignored, true);
+	return createOpeningXML("map", Defaults::inputMapAttributes, fieldsData, true);
 }
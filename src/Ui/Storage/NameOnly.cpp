@@ -45,5 +45,5 @@ const string NameOnly::getCssClass() const {
 }
 
 const string NameOnly::toXML() const {
-	return createOpeningXML(node, fieldsData, ignored, true);
+	return createOpeningXML(node, Defaults::selectedAttributes, fieldsData, true);
 }
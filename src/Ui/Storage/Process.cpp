@@ -45,7 +45,7 @@ const string Process::getCssClass() const {
 const string Process::toXML() const {
 	string r(Defaults::tab() + "<map\n");
 	Defaults::increaseTab();
-	r += Data::toXML();
+	r += valuesXML(Defaults::processLookupAttributes, fieldsData);
 	Defaults::reduceTab();
 	r += Defaults::tab() + "/>\n";
 	return r;
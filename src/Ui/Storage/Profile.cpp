@@ -29,9 +29,9 @@ Profile::Profile(unordered_map<string, string>& data) : Data(data) {
 	CollectionHandler::getInstance(COLLECTION_ELEMENT)->registerDestination(&alwaysOnElements);
 	CollectionHandler::getInstance(COLLECTION_GROUP)->registerDestination(&alwaysOnGroups);
 	CollectionHandler::getInstance(COLLECTION_INPUT)->registerDestination(&inputs);
-//	CollectionHandler::getInstance(COLLECTION_ANIMATION)->registerDestination(&animationss);
-//	CollectionHandler::getInstance(COLLECTION_ANIMATION)->registerDestination(&startTransitions);
-//	CollectionHandler::getInstance(COLLECTION_ANIMATION)->registerDestination(&endTransitions);
+	CollectionHandler::getInstance(COLLECTION_ANIMATIONS)->registerDestination(&animationss);
+	CollectionHandler::getInstance(COLLECTION_ANIMATIONS)->registerDestination(&startTransitions);
+	CollectionHandler::getInstance(COLLECTION_ANIMATIONS)->registerDestination(&endTransitions);
 }
 
 Profile::~Profile() {
@@ -41,9 +41,9 @@ Profile::~Profile() {
 	CollectionHandler::getInstance(COLLECTION_ELEMENT)->release(&alwaysOnElements);
 	CollectionHandler::getInstance(COLLECTION_GROUP)->release(&alwaysOnGroups);
 	CollectionHandler::getInstance(COLLECTION_INPUT)->release(&inputs);
-//	CollectionHandler::getInstance(COLLECTION_ANIMATION)->release(&animationss);
-//	CollectionHandler::getInstance(COLLECTION_ANIMATION)->release(&startTransitions);
-//	CollectionHandler::getInstance(COLLECTION_ANIMATION)->release(&endTransitions);
+	CollectionHandler::getInstance(COLLECTION_ANIMATIONS)->release(&animationss);
+	CollectionHandler::getInstance(COLLECTION_ANIMATIONS)->release(&startTransitions);
+	CollectionHandler::getInstance(COLLECTION_ANIMATIONS)->release(&endTransitions);
 }
 
 const string Profile::createPrettyName() const {
@@ -60,12 +60,13 @@ const string Profile::getCssClass() const {
 
 
 const string Profile::toXML() const {
+	TRACE_SPAN("toXML");
 	string r("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\
 	<LEDSpicer\
 		version=\"1.0\"\
 		type=\"Profile\"\n");
 	Defaults::increaseTab();
-	r += Data::toXML();
+	r += valuesXML(Defaults::profileAttributes, fieldsData);
 	Defaults::reduceTab();
 	r += ">\n";
 	Defaults::increaseTab();
@@ -77,6 +78,22 @@ const string Profile::toXML() const {
 	return r;
 }
 
+const BoxButtonCollection& Profile::getAlwaysOnElements() const {
+	return alwaysOnElements;
+}
+
+const BoxButtonCollection& Profile::getAlwaysOnGroups() const {
+	return alwaysOnGroups;
+}
+
+const BoxButtonCollection& Profile::getInputs() const {
+	return inputs;
+}
+
+const BoxButtonCollection& Profile::getAnimations() const {
+	return animationss;
+}
+
 void Profile::lateActivate(Selectors selector) {
 	switch (selector) {
 	case Selectors::AlwaysOnElements:
@@ -60,6 +60,26 @@ public:
 
 	void lateActivate(Selectors selector);
 
+	/**
+	 * @return the elements always on, with their colors.
+	 */
+	const BoxButtonCollection& getAlwaysOnElements() const;
+
+	/**
+	 * @return the groups always on, with their colors.
+	 */
+	const BoxButtonCollection& getAlwaysOnGroups() const;
+
+	/**
+	 * @return the inputs that react on this profile.
+	 */
+	const BoxButtonCollection& getInputs() const;
+
+	/**
+	 * @return the animations that run on this profile.
+	 */
+	const BoxButtonCollection& getAnimations() const;
+
 protected:
 
 	BoxButtonCollection
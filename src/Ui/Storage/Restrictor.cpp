@@ -24,6 +24,12 @@
 
 using namespace LEDSpicerUI::Ui::Storage;
 
+Restrictor::Restrictor(unordered_map<string, string>& data) :
+	Data(data)
+{
+	resolveType();
+}
+
 Restrictor::~Restrictor() {
 	if (not fieldsData.empty()) {
 		CollectionHandler::getInstance(COLLECTION_RESTRICTORS)->remove(createUniqueId());
@@ -31,18 +37,16 @@ Restrictor::~Restrictor() {
 }
 
 const string Restrictor::createPrettyName() const {
-	string
-		name (fieldsData.at(NAME)),
-		r(Defaults::restrictorsInfo.at(name).name);
-	if (Defaults::isIdUser(name, false))
+	string r(Defaults::getInfo(type).name);
+	if (Defaults::isIdUser(type))
 		r += " Id: " + fieldsData.at(ID);
-	if (Defaults::isSerial(name, false))
+	if (Defaults::isSerial(type))
 		r += " Port: " + (fieldsData.at(PORT).empty() ? "<autodetect>" : fieldsData.at(PORT));
 	return r;
 }
 
 const string Restrictor::createUniqueId() const {
-	return Defaults::createHardwareUniqueId(*getValues(), false);
+	return Defaults::createHardwareUniqueId(type, getValue(ID), getValue(PORT));
 }
 
 const string Restrictor::getCssClass() const {
@@ -61,7 +65,8 @@ void Restrictor::activate() {
 }
 
 const string Restrictor::toXML() const {
-	string r(createOpeningXML("restrictor", fieldsData, ignored, false));
+	TRACE_SPAN("toXML");
+	string r(createOpeningXML("restrictor", Defaults::restrictorAttributes, fieldsData, false));
 	for (const auto& e : playerMapping) {
 		r += e->getData()->toXML();
 	}
@@ -69,3 +74,19 @@ const string Restrictor::toXML() const {
 	return r;
 }
 
+void Restrictor::resolveType() {
+	type = Defaults::getRestrictorType(getValue(NAME));
+	hardwareKey = (type == Defaults::RestrictorType::invalid ? 0 : Defaults::createHardwareKey(type, getValue(ID), getValue(PORT)));
+}
+
+Defaults::RestrictorType Restrictor::getType() const {
+	return type;
+}
+
+Defaults::HardwareKey Restrictor::getHardwareKey() const {
+	return hardwareKey;
+}
+
+const BoxButtonCollection& Restrictor::getPlayerMapping() const {
+	return playerMapping;
+}
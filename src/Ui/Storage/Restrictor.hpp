@@ -36,10 +36,14 @@ class Restrictor : public Data {
 
 public:
 
-	using Data::Data;
-
 	Restrictor() = delete;
 
+	/**
+	 * Creates a new restrictor and resolves its type.
+	 * @param data this values will be moved into the class.
+	 */
+	Restrictor(unordered_map<string, string>& data);
+
 	virtual ~Restrictor();
 
 	const string createPrettyName() const override;
@@ -54,8 +58,34 @@ public:
 
 	const string toXML() const override;
 
+	/**
+	 * Resolves the restrictor type and hardware key from the stored values, needs to be called after changing them.
+	 */
+	void resolveType();
+
+	/**
+	 * @return the restrictor type.
+	 */
+	Defaults::RestrictorType getType() const;
+
+	/**
+	 * @return the key that identifies this hardware.
+	 */
+	Defaults::HardwareKey getHardwareKey() const;
+
+	/**
+	 * @return the players and joysticks mapped to this restrictor.
+	 */
+	const BoxButtonCollection& getPlayerMapping() const;
+
 protected:
 
+	/// The restrictor type, resolved once from the name.
+	Defaults::RestrictorType type = Defaults::RestrictorType::invalid;
+
+	/// Packed name, ID and port.
+	Defaults::HardwareKey hardwareKey = 0;
+
 	BoxButtonCollection playerMapping;
 
 };
@@ -47,5 +47,5 @@ string const RestrictorMap::getCssClass() const {
 }
 
 const string RestrictorMap::toXML() const {
-	return createOpeningXML("map", fieldsData, ignored, true);
+	return createOpeningXML("map", Defaults::restrictorMapAttributes, fieldsData, true);
 }
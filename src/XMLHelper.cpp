@@ -22,12 +22,25 @@
 
 #include "XMLHelper.hpp"
 
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
 using namespace LEDSpicerUI;
 
+/// Inflate output step.
+static constexpr size_t INFLATE_CHUNK = 256 * 1024;
+
 XMLHelper::XMLHelper(const string& fileName, const string& fileType) {
+	open(fileName, fileType);
+}
+
+void XMLHelper::open(const string& fileName, const string& fileType) {
 
-	if (LoadFile(fileName.c_str()) != tinyxml2::XML_SUCCESS)
-		throw Message("Unable to read the file " + fileName + " " + string(ErrorStr()));
+	load(fileName);
 
 	root = RootElement();
 	if (fileType != XML_FILE_FOREIGN) {
@@ -42,6 +55,151 @@ XMLHelper::XMLHelper(const string& fileName, const string& fileType) {
 	}
 }
 
+void XMLHelper::load(const string& fileName) {
+	string name(fileName);
+	if (access(name.c_str(), F_OK)) {
+		for (auto extension : {".gz", ".zst"}) {
+			if (not access((fileName + extension).c_str(), F_OK)) {
+				name = fileName + extension;
+				break;
+			}
+		}
+	}
+
+	int fd = ::open(name.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		throw Message("Unable to read the file " + name);
+	struct stat info;
+	if (fstat(fd, &info) or not info.st_size) {
+		close(fd);
+		throw Message("Unable to read the file " + name + " is empty");
+	}
+	const size_t size = info.st_size;
+	void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		throw Message("Unable to map the file " + name);
+	madvise(map, size, MADV_SEQUENTIAL);
+	Stats::add(Stats::Counters::XML_FILES);
+	Stats::add(Stats::Counters::XML_BYTES, size);
+
+	// Parse copies the text into its own buffer, the mapping or the inflated text are released once it returns.
+	const auto data = static_cast<const unsigned char*>(map);
+	tinyxml2::XMLError result;
+	try {
+		if (size > 2 and data[0] == 0x1f and data[1] == 0x8b) {
+			string inflated(inflateGzip(static_cast<const char*>(map), size, name));
+			munmap(map, size);
+			map = nullptr;
+			result = Parse(inflated.data(), inflated.size());
+		}
+		else if (size > 4 and data[0] == 0x28 and data[1] == 0xb5 and data[2] == 0x2f and data[3] == 0xfd) {
+			string inflated(inflateZstd(static_cast<const char*>(map), size, name));
+			munmap(map, size);
+			map = nullptr;
+			result = Parse(inflated.data(), inflated.size());
+		}
+		else {
+			result = Parse(static_cast<const char*>(map), size);
+		}
+	}
+	catch (...) {
+		if (map)
+			munmap(map, size);
+		throw;
+	}
+	if (map)
+		munmap(map, size);
+	if (result != tinyxml2::XML_SUCCESS)
+		throw Message("Unable to read the file " + name + " " + string(ErrorStr()));
+}
+
+string XMLHelper::inflateGzip(const char* data, size_t size, const string& fileName) {
+#ifdef HAVE_ZLIB
+	z_stream stream{};
+	// 32 detects gzip or zlib headers.
+	if (inflateInit2(&stream, 15 + 32) != Z_OK)
+		throw Message("Unable to inflate " + fileName);
+	// The trailer size is not trusted, the output grows with what comes out up to the limit.
+	const size_t limit = std::min(size * MAX_DEFLATE_RATIO, MAX_INFLATED_SIZE);
+	string r;
+	stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+	stream.avail_in = size;
+	int status = Z_OK;
+	while (status != Z_STREAM_END or stream.avail_in) {
+		// Concatenated members.
+		if (status == Z_STREAM_END)
+			inflateReset(&stream);
+		const size_t
+			used = r.size(),
+			step = std::min(INFLATE_CHUNK, limit + 1 - used);
+		r.resize(used + step);
+		stream.next_out  = reinterpret_cast<Bytef*>(&r[used]);
+		stream.avail_out = step;
+		status = inflate(&stream, Z_NO_FLUSH);
+		r.resize(used + step - stream.avail_out);
+		if (status != Z_OK and status != Z_STREAM_END) {
+			inflateEnd(&stream);
+			throw Message("Unable to inflate " + fileName + ", the file is damaged");
+		}
+		if (r.size() > limit) {
+			inflateEnd(&stream);
+			throw Message("Unable to inflate " + fileName + ", the file is too big");
+		}
+		if (status == Z_OK and not stream.avail_in and stream.avail_out) {
+			inflateEnd(&stream);
+			throw Message("Unable to inflate " + fileName + ", the file is truncated");
+		}
+	}
+	inflateEnd(&stream);
+	return r;
+#else
+	throw Message(fileName + " is compressed with gzip, and gzip support was not built");
+#endif
+}
+
+string XMLHelper::inflateZstd(const char* data, size_t size, const string& fileName) {
+#ifdef HAVE_ZSTD
+	auto stream(ZSTD_createDStream());
+	if (not stream)
+		throw Message("Unable to inflate " + fileName);
+	// The frame size is not trusted, the output grows with what comes out up to the limit.
+	string r;
+	ZSTD_inBuffer in{data, size, 0};
+	// With the input consumed the decoder can still hold data, it is done when a frame ends with nothing left.
+	while (true) {
+		const size_t
+			used     = r.size(),
+			consumed = in.pos,
+			step     = std::min(INFLATE_CHUNK, MAX_INFLATED_SIZE + 1 - used);
+		r.resize(used + step);
+		ZSTD_outBuffer out{&r[used], step, 0};
+		const size_t status = ZSTD_decompressStream(stream, &out, &in);
+		r.resize(used + out.pos);
+		if (ZSTD_isError(status)) {
+			ZSTD_freeDStream(stream);
+			throw Message("Unable to inflate " + fileName + ", " + ZSTD_getErrorName(status));
+		}
+		if (r.size() > MAX_INFLATED_SIZE) {
+			ZSTD_freeDStream(stream);
+			throw Message("Unable to inflate " + fileName + ", the file is too big");
+		}
+		if (in.pos < in.size)
+			continue;
+		if (not status)
+			break;
+		if (in.pos == consumed and not out.pos) {
+			ZSTD_freeDStream(stream);
+			throw Message("Unable to inflate " + fileName + ", the file is truncated");
+		}
+	}
+	ZSTD_freeDStream(stream);
+	return r;
+#else
+	throw Message(fileName + " is compressed with zstd, and zstd support was not built");
+#endif
+}
+
 unordered_map<string, string> XMLHelper::processNode(tinyxml2::XMLElement* nodeElement) {
 
 	unordered_map<string, string> groupValues;
@@ -70,14 +228,15 @@ tinyxml2::XMLElement* XMLHelper::getRoot() {
 	return root;
 }
 
-void XMLHelper::checkAttributes(
+string XMLHelper::checkAttributes(
 	const vector<string>& attributeList,
 	const unordered_map<string, string>& subjects,
 	const string& place)
 {
-	for (string attribute : attributeList)
+	for (const string& attribute : attributeList)
 		if (not subjects.count(attribute))
-			throw Message("Missing attribute '" + attribute + "' inside " + place);
+			return "Missing attribute '" + attribute + "' inside " + place;
+	return "";
 }
 
 string XMLHelper::valueOf(const unordered_map<string, string>& values, const string& value, string def) {
@@ -91,6 +250,16 @@ string XMLHelper::toXML(const unordered_map<string, string>& values) {
 	return r;
 }
 
+void XMLHelper::write(const string& fileName, const string& xmlData) {
+	try {
+		// Writes aside and renames.
+		Glib::file_set_contents(fileName, xmlData);
+	}
+	catch (const Glib::FileError& e) {
+		throw Message("Failed to write " + fileName + " " + string(e.what()));
+	}
+}
+
 vector<unordered_map<string, string>>& XMLHelper::getData(const string& dataName) {
 	return extractedData[dataName];
 }
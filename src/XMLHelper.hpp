@@ -22,6 +22,14 @@
 
 #include <tinyxml2.h>
 #include "Message.hpp"
+#include "Diagnostics.hpp"
+#include "Stats.hpp"
+
+// for file mapping.
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #ifndef XMLHELPER_HPP_
 #define XMLHELPER_HPP_ 1
@@ -32,6 +40,9 @@ using Ui::Message;
 
 /**
  * LEDSpicerUI::Ui::XMLHelper
+ * Files are mapped and handed to tinyxml2, that keeps its own copy, gzip and zstd files are inflated in memory first.
+ * tinyxml2 only parses whole buffers, so a compressed file peaks at the inflated text plus that copy,
+ * the inflate stops at MAX_INFLATED_SIZE to keep both bounded.
  */
 class XMLHelper : protected tinyxml2::XMLDocument {
 
@@ -77,9 +88,9 @@ public:
 	 * @param attributeList A list of attributes to check.
 	 * @param subjects A map to check.
 	 * @param node where will check.
-	 * @throws Error if an attribute is missing.
+	 * @return the error for the first missing attribute, or empty if none is missing.
 	 */
-	static void checkAttributes(
+	static string checkAttributes(
 		const vector<string>& attributeList,
 		const unordered_map<string, string>& subjects,
 		const string& place
@@ -104,6 +115,32 @@ public:
 	 */
 	static string toXML(const unordered_map<string, string>& values);
 
+	/**
+	 * Converts a map into xml string, following the order list.
+	 * Values not in the order list are not written.
+	 * @param order
+	 * @param values
+	 * @return
+	 */
+	template <size_t N>
+	static string toXML(const std::array<const char*, N>& order, const unordered_map<string, string>& values) {
+		string r;
+		for (const char* attribute : order) {
+			auto v(values.find(attribute));
+			if (v != values.end())
+				r += Defaults::tab() + v->first + "=\"" + v->second + "\"\n";
+		}
+		return r;
+	}
+
+	/**
+	 * Writes a file, the old file is replaced only when the new one is complete.
+	 * @param fileName
+	 * @param xmlData
+	 * @throws Message if the file cannot be written.
+	 */
+	static void write(const string& fileName, const string& xmlData);
+
 	/**
 	 * @param dataName
 	 * @return The stored values for that collection.
@@ -126,6 +163,45 @@ protected:
 	/// Stores the procceded file information by section.
 	unordered_map<string, vector<unordered_map<string, string>>> extractedData;
 
+	/**
+	 * For data that does not come from a XML file, or when the file is opened later.
+	 */
+	XMLHelper() = default;
+
+	/**
+	 * Opens the XML file.
+	 * @param fileName
+	 * @param fileType XML_FILE_FOREIGN skips the LEDSpicer root checks.
+	 * @throws Error if the file is missing, the body is missing or the version is different.
+	 */
+	void open(const string& fileName, const string& fileType);
+
+	/**
+	 * Maps and parses a file, compressed files are detected by content.
+	 * When the file is missing a .gz or .zst copy is used.
+	 * @param fileName
+	 * @throws Message if the file cannot be read or parsed.
+	 */
+	void load(const string& fileName);
+
+	/**
+	 * @param data gzip or zlib stream.
+	 * @param size
+	 * @param fileName for errors.
+	 * @return the inflated data.
+	 * @throws Message if the stream is damaged or inflates past the limits.
+	 */
+	static string inflateGzip(const char* data, size_t size, const string& fileName);
+
+	/**
+	 * @param data zstd frames.
+	 * @param size
+	 * @param fileName for errors.
+	 * @return the inflated data.
+	 * @throws Message if the stream is damaged or inflates past MAX_INFLATED_SIZE.
+	 */
+	static string inflateZstd(const char* data, size_t size, const string& fileName);
+
 };
 
 } /* namespace LEDSpicerUI */